@@ -0,0 +1,201 @@
+#include "Benchmark.hpp"
+#include "unicore/math/Math.hpp"
+#include "unicore/system/MemoryTracker.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace unicore
+{
+	namespace
+	{
+#if !defined(UNICORE_USE_MEMORY_TRACKING)
+		std::atomic<UInt64> s_alloc_count{ 0 };
+		std::atomic<UInt64> s_alloc_bytes{ 0 };
+#endif
+
+		List<Benchmark::Info>& get_registry()
+		{
+			// Never destroyed, filled by static initializers
+			static const auto registry = new List<Benchmark::Info>();
+			return *registry;
+		}
+
+#if !defined(UNICORE_USE_MEMORY_TRACKING)
+		void* counted_alloc(std::size_t size) noexcept
+		{
+			s_alloc_count.fetch_add(1, std::memory_order_relaxed);
+			s_alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+			return std::malloc(size > 0 ? size : 1);
+		}
+#endif
+	}
+
+	// BenchmarkState /////////////////////////////////////////////////////////////
+	void BenchmarkState::counter(StringView name, Double value)
+	{
+		for (auto& item : _counters)
+		{
+			if (item.name == name)
+			{
+				item.value = value;
+				return;
+			}
+		}
+
+		_counters.push_back({ String(name), value });
+	}
+
+	void BenchmarkState::start()
+	{
+		_start_allocations = Benchmark::allocations();
+		_start = Timer::now();
+	}
+
+	void BenchmarkState::stop()
+	{
+		if (!_start.has_value())
+			return;
+
+		_elapsed = Timer::now() - _start.value();
+		_start.reset();
+
+		const auto allocations = Benchmark::allocations();
+		_allocations.count = allocations.count - _start_allocations.count;
+		_allocations.bytes = allocations.bytes - _start_allocations.bytes;
+	}
+
+	// Benchmark //////////////////////////////////////////////////////////////////
+	const void* volatile Benchmark::_sink = nullptr;
+
+	Bool Benchmark::add(const Char* name, Func func)
+	{
+		get_registry().push_back({ name, func });
+		return true;
+	}
+
+	const List<Benchmark::Info>& Benchmark::get_all()
+	{
+		return get_registry();
+	}
+
+	BenchmarkResult Benchmark::run(const Info& info, const BenchmarkSettings& settings)
+	{
+		// Grows iterations until run takes at least target time
+		const auto measure = [&info](UInt64 iterations, const TimeSpan& target)
+		{
+			while (true)
+			{
+				BenchmarkState state(iterations);
+				info.func(state);
+
+				const auto elapsed = state.elapsed();
+				if (state.failed() || elapsed >= target || iterations >= 1000000000)
+					return state;
+
+				const auto ratio = elapsed > TimeSpanConst::Zero
+					? target.total_seconds() / elapsed.total_seconds() : 10.0;
+				const auto scale = Math::clamp(ratio * 1.2, 1.5, 10.0);
+				iterations = static_cast<UInt64>(static_cast<Double>(iterations) * scale) + 1;
+			}
+		};
+
+		const auto warmup = measure(1, settings.warmup);
+		if (warmup.failed())
+		{
+			BenchmarkResult result;
+			result.name = info.name;
+			result.error = warmup.error();
+			return result;
+		}
+
+		// Estimate iterations for min_time from warmup speed
+		const auto per_op = warmup.elapsed().total_seconds() / static_cast<Double>(warmup.iterations());
+		const auto estimate = per_op > 0
+			? static_cast<UInt64>(settings.min_time.total_seconds() / per_op) : warmup.iterations();
+
+		const auto state = measure(Math::max<UInt64>(estimate, 1), settings.min_time);
+		const auto iterations = static_cast<Double>(state.iterations());
+
+		BenchmarkResult result;
+		result.name = info.name;
+		result.iterations = state.iterations();
+		result.ns_per_op = static_cast<Double>(state.elapsed().data().count()) / iterations;
+		result.bytes_per_op = static_cast<Double>(state.allocations().bytes) / iterations;
+		result.allocs_per_op = static_cast<Double>(state.allocations().count) / iterations;
+		result.counters = state.counters();
+		result.error = state.error();
+		return result;
+	}
+
+	BenchmarkAllocations Benchmark::allocations()
+	{
+#if defined(UNICORE_USE_MEMORY_TRACKING)
+		const auto counters = MemoryTracker::total();
+		return { counters.alloc_count, counters.alloc_bytes };
+#else
+		return {
+			s_alloc_count.load(std::memory_order_relaxed),
+			s_alloc_bytes.load(std::memory_order_relaxed)
+		};
+#endif
+	}
+}
+
+// Replaced global allocation functions count every allocation.
+// With memory tracking operator new is already replaced by MemoryTracker.
+// Aligned versions are left to the standard library.
+#if !defined(UNICORE_USE_MEMORY_TRACKING)
+void* operator new(std::size_t size)
+{
+	if (const auto ptr = unicore::counted_alloc(size))
+		return ptr;
+
+	throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	return unicore::counted_alloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	return unicore::counted_alloc(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+	std::free(ptr);
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,140 @@
+#pragma once
+#include "unicore/system/Timer.hpp"
+
+namespace unicore
+{
+	// Extra value of benchmark, printed after its row
+	struct BenchmarkCounter
+	{
+		String name;
+		Double value = 0;
+	};
+
+	// Counters of global operator new (all threads) since program start.
+	// Memory::alloc goes to malloc directly and is not counted.
+	struct BenchmarkAllocations
+	{
+		UInt64 count = 0;
+		UInt64 bytes = 0;
+	};
+
+	// Measurement starts with first loop() call, code before the loop
+	// is setup and code after it is teardown:
+	//   while (state.loop()) { ... }
+	class BenchmarkState
+	{
+	public:
+		explicit BenchmarkState(UInt64 iterations)
+			: _iterations(iterations), _remaining(iterations) {}
+
+		UC_NODISCARD UInt64 iterations() const { return _iterations; }
+
+		bool loop()
+		{
+			if (failed())
+				return false;
+
+			if (_remaining == _iterations)
+				start();
+
+			if (_remaining > 0)
+			{
+				_remaining--;
+				return true;
+			}
+
+			stop();
+			return false;
+		}
+
+		UC_NODISCARD const TimeSpan& elapsed() const { return _elapsed; }
+		UC_NODISCARD const BenchmarkAllocations& allocations() const { return _allocations; }
+
+		// Marks run as failed (wrong result), benchmark is not repeated
+		// and unicore_benchmarks exits with error
+		void fail(StringView error) { _error = error; }
+
+		UC_NODISCARD Bool failed() const { return !_error.empty(); }
+		UC_NODISCARD const String& error() const { return _error; }
+
+		// Reports domain value (bytes per frame, hit rate), last set wins
+		void counter(StringView name, Double value);
+
+		UC_NODISCARD const List<BenchmarkCounter>& counters() const { return _counters; }
+
+	protected:
+		const UInt64 _iterations;
+		UInt64 _remaining;
+
+		Optional<Timer> _start;
+		BenchmarkAllocations _start_allocations;
+
+		TimeSpan _elapsed = TimeSpanConst::Zero;
+		BenchmarkAllocations _allocations;
+		String _error;
+		List<BenchmarkCounter> _counters;
+
+		void start();
+		void stop();
+	};
+
+	struct BenchmarkResult
+	{
+		String name;
+		UInt64 iterations = 0;
+		Double ns_per_op = 0;
+		Double bytes_per_op = 0;
+		Double allocs_per_op = 0;
+		List<BenchmarkCounter> counters;
+		// Not empty if benchmark failed its check
+		String error;
+	};
+
+	struct BenchmarkSettings
+	{
+		// Every benchmark runs at least that long
+		TimeSpan min_time = TimeSpan::from_milliseconds(200);
+		// Run before measurement, also used to estimate iterations
+		TimeSpan warmup = TimeSpan::from_milliseconds(50);
+		// Run only benchmarks which names contain filter
+		String filter;
+	};
+
+	class Benchmark
+	{
+	public:
+		using Func = void(*)(BenchmarkState&);
+
+		struct Info
+		{
+			const Char* name;
+			Func func;
+		};
+
+		static Bool add(const Char* name, Func func);
+		UC_NODISCARD static const List<Info>& get_all();
+
+		static BenchmarkResult run(const Info& info, const BenchmarkSettings& settings);
+
+		UC_NODISCARD static BenchmarkAllocations allocations();
+
+		// Keeps result of computation from being optimized out
+		template<typename T>
+		static void keep(const T& value)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			asm volatile("" : : "g"(&value) : "memory");
+#else
+			_sink = &value;
+#endif
+		}
+
+	protected:
+		static const void* volatile _sink;
+	};
+
+#define UNICORE_BENCHMARK(func, name) \
+	static void func(BenchmarkState& state); \
+	UC_UNUSED static const Bool func##_registered = Benchmark::add(name, &func); \
+	static void func(BenchmarkState& state)
+}
\ No newline at end of file
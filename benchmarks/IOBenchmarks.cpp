@@ -0,0 +1,196 @@
+#include "Benchmark.hpp"
+#include "unicore/io/FileSystem.hpp"
+#include "unicore/io/Logger.hpp"
+#include "unicore/resource/BinaryData.hpp"
+#include "unicore/resource/ResourceCache.hpp"
+#include "unicore/resource/ResourceLoader.hpp"
+#include "unicore/system/StringBuilder.hpp"
+
+namespace unicore
+{
+	namespace
+	{
+		constexpr int FileCount = 1000;
+		constexpr int LargeFileCount = 100000;
+
+		Path make_file_path(StringView prefix, int index)
+		{
+			return Path(StringBuilder::format("{}/folder{}/file{}.bin", prefix, index % 10, index));
+		}
+
+		// Files exist only as index entries, same as archive providers
+		class IndexFileProvider : public CachedFileProvider
+		{
+		public:
+			explicit IndexFileProvider(StringView prefix, int count = FileCount)
+			{
+				for (int i = 0; i < count; i++)
+					add_entry(make_file_path(prefix, i), i);
+			}
+
+		protected:
+			UC_NODISCARD Optional<FileStats> stats_index(intptr_t index) const override
+			{
+				FileStats stats;
+				stats.size = index * 16;
+				stats.type = FileType::File;
+				return stats;
+			}
+
+			UC_NODISCARD Shared<ReadFile> open_read_index(intptr_t index) override
+			{
+				return nullptr;
+			}
+		};
+
+		class BinaryDataFactory : public ResourceLoaderTyped<
+			ResourceLoaderTypePolicy::Single<BinaryData>,
+			ResourceLoaderPathPolicy::NotEmpty>
+		{
+		public:
+			UC_NODISCARD Shared<Resource> load(const Context& context) override
+			{
+				return std::make_shared<BinaryData>(MemoryChunk(16));
+			}
+		};
+
+		// Views keep precomputed hash, lookups do not build Path
+		List<PathView> make_views(const List<Path>& paths)
+		{
+			List<PathView> views;
+			views.reserve(paths.size());
+			for (const auto& path : paths)
+				views.emplace_back(path);
+			return views;
+		}
+
+		template<int Provider>
+		void file_system_stats(BenchmarkState& state)
+		{
+			// Silent logger
+			MultiLogger logger;
+			FileSystem fs(logger);
+			fs.add_read(std::make_shared<IndexFileProvider>("assets"));
+			fs.add_read(std::make_shared<IndexFileProvider>("data"));
+
+			List<Path> paths;
+			for (int i = 0; i < FileCount; i++)
+				paths.push_back(make_file_path(Provider == 0 ? "assets" : Provider == 1 ? "data" : "missing", i));
+
+			Size index = 0;
+			while (state.loop())
+			{
+				const auto stats = fs.stats(paths[index++ % paths.size()]);
+				Benchmark::keep(stats);
+			}
+		}
+	}
+
+	// ResourceCache //////////////////////////////////////////////////////////////
+	UNICORE_BENCHMARK(resource_cache_load_hit, "ResourceCache::load/hit/1000")
+	{
+		MultiLogger logger;
+		ResourceCache cache(logger);
+		cache.add_loader(std::make_shared<BinaryDataFactory>());
+
+		List<Path> paths;
+		List<Shared<BinaryData>> loaded;
+		for (int i = 0; i < FileCount; i++)
+		{
+			paths.push_back(make_file_path("assets", i));
+			loaded.push_back(cache.load<BinaryData>(paths.back()));
+		}
+
+		Size index = 0;
+		Bool missed = false;
+		while (state.loop())
+		{
+			const auto position = index++ % paths.size();
+			const auto data = cache.load<BinaryData>(paths[position]);
+			missed |= data != loaded[position];
+			Benchmark::keep(data);
+		}
+
+		if (missed)
+			state.fail("Cached resource was loaded again");
+
+		loaded.clear();
+		cache.unload_all();
+	}
+
+	UNICORE_BENCHMARK(resource_cache_load_hit_large, "ResourceCache::load/hit/PathView/100k")
+	{
+		MultiLogger logger;
+		ResourceCache cache(logger);
+		cache.add_loader(std::make_shared<BinaryDataFactory>());
+
+		List<Path> paths;
+		List<Shared<BinaryData>> loaded;
+		for (int i = 0; i < LargeFileCount; i++)
+		{
+			paths.push_back(make_file_path("assets", i));
+			loaded.push_back(cache.load<BinaryData>(paths.back()));
+		}
+
+		const auto views = make_views(paths);
+
+		Size index = 0;
+		Bool missed = false;
+		while (state.loop())
+		{
+			const auto position = index++ % views.size();
+			const auto data = cache.load<BinaryData>(views[position]);
+			missed |= data != loaded[position];
+			Benchmark::keep(data);
+		}
+
+		if (missed)
+			state.fail("Cached resource was loaded again");
+
+		loaded.clear();
+		cache.unload_all();
+	}
+
+	// CachedFileProvider /////////////////////////////////////////////////////////
+	UNICORE_BENCHMARK(cached_file_provider_stats, "CachedFileProvider::stats/PathView/100k")
+	{
+		const IndexFileProvider provider("assets", LargeFileCount);
+
+		List<Path> paths;
+		for (int i = 0; i < LargeFileCount; i++)
+			paths.push_back(make_file_path("assets", i));
+
+		const auto views = make_views(paths);
+
+		Size index = 0;
+		while (state.loop())
+		{
+			const auto stats = provider.stats(views[index++ % views.size()]);
+			Benchmark::keep(stats);
+		}
+	}
+
+	UNICORE_BENCHMARK(cached_file_provider_stats_missing, "CachedFileProvider::stats/PathView/missing/100k")
+	{
+		const IndexFileProvider provider("assets", LargeFileCount);
+
+		List<Path> paths;
+		for (int i = 0; i < LargeFileCount; i++)
+			paths.push_back(make_file_path("data", i));
+
+		const auto views = make_views(paths);
+
+		Size index = 0;
+		while (state.loop())
+		{
+			const auto stats = provider.stats(views[index++ % views.size()]);
+			Benchmark::keep(stats);
+		}
+	}
+
+	// FileSystem /////////////////////////////////////////////////////////////////
+	UC_UNUSED static const Bool file_system_registered =
+		Benchmark::add("FileSystem::stats/first", &file_system_stats<0>) &&
+		Benchmark::add("FileSystem::stats/second", &file_system_stats<1>) &&
+		Benchmark::add("FileSystem::stats/missing", &file_system_stats<2>);
+}
\ No newline at end of file
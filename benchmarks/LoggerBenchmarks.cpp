@@ -0,0 +1,188 @@
+#include "Benchmark.hpp"
+#include "unicore/io/AsyncLogger.hpp"
+#include "unicore/io/FileLogger.hpp"
+
+namespace unicore
+{
+	namespace
+	{
+		constexpr Size FileBufferSize = 64 * 1024;
+
+		// Counts written bytes, every write call is one "syscall"
+		class NullWriteFile : public WriteFile
+		{
+		public:
+			UInt64 write_count = 0;
+			UInt64 flush_count = 0;
+
+			UC_NODISCARD int64_t size() const override { return static_cast<int64_t>(_size); }
+			int64_t seek(int64_t offset, SeekMethod method) override { return 0; }
+
+			UC_NODISCARD bool eof() const override { return true; }
+			bool read(void* buffer, size_t size, size_t* bytes_read) override { return false; }
+
+			bool flush() override
+			{
+				flush_count++;
+				return true;
+			}
+
+			bool write(const void* buffer, size_t size, size_t* bytes_written) override
+			{
+				Benchmark::keep(buffer);
+				write_count++;
+				_size += size;
+				if (bytes_written)
+					*bytes_written = size;
+				return true;
+			}
+
+		protected:
+			UInt64 _size = 0;
+		};
+
+		// Keeps last message
+		class LastMessageLogger : public Logger
+		{
+		public:
+			String text;
+
+			void write(LogType type, const StringView message) override { text = message; }
+		};
+
+		AsyncLoggerSettings make_settings(AsyncLoggerPolicy policy)
+		{
+			AsyncLoggerSettings settings;
+			settings.policy = policy;
+			settings.flush_on_crash = false;
+			return settings;
+		}
+
+		// Same message as deferred benchmarks, formatted on calling thread
+		void log_message(Logger& logger, UInt64 index)
+		{
+			UC_LOG_INFO(logger) << "Loaded " << "textures/atlas.png" << " in " << index << " ms, scale " << 1.5f;
+		}
+
+		void add_flush_counter(BenchmarkState& state, const NullWriteFile& file)
+		{
+			state.counter("target flushes per 1k", 1000.0 * static_cast<Double>(file.flush_count) / state.iterations());
+		}
+
+		template<AsyncLoggerPolicy Policy>
+		void async_logger_log(BenchmarkState& state)
+		{
+			const auto file = std::make_shared<NullWriteFile>();
+			FileLogger file_logger(file, FileBufferSize);
+			AsyncLogger logger(file_logger, make_settings(Policy));
+
+			UInt64 index = 0;
+			while (state.loop())
+				logger.log(LogType::Info, "Loaded {} in {} ms, scale {}", "textures/atlas.png", index++, 1.5f);
+
+			logger.flush();
+			add_flush_counter(state, *file);
+		}
+	}
+
+	// Synchronous ////////////////////////////////////////////////////////////////
+	UNICORE_BENCHMARK(file_logger_write, "FileLogger::write")
+	{
+		FileLogger logger(std::make_shared<NullWriteFile>());
+
+		UInt64 index = 0;
+		while (state.loop())
+			log_message(logger, index++);
+	}
+
+	UNICORE_BENCHMARK(file_logger_write_buffered, "FileLogger::write/buffered")
+	{
+		FileLogger logger(std::make_shared<NullWriteFile>(), FileBufferSize);
+
+		UInt64 index = 0;
+		while (state.loop())
+			log_message(logger, index++);
+	}
+
+	UNICORE_BENCHMARK(proxy_logger_write, "ProxyLogger::write")
+	{
+		FileLogger file_logger(std::make_shared<NullWriteFile>());
+		ProxyLogger logger("[FS] ", file_logger);
+
+		UInt64 index = 0;
+		while (state.loop())
+			log_message(logger, index++);
+	}
+
+	// AsyncLogger ////////////////////////////////////////////////////////////////
+	// Block policy shows sustained rate, caller waits for background thread
+	// when ring is full. Drop policy shows cost of call on calling thread.
+	UNICORE_BENCHMARK(async_logger_write, "AsyncLogger::write/block")
+	{
+		const auto file = std::make_shared<NullWriteFile>();
+		FileLogger file_logger(file, FileBufferSize);
+		AsyncLogger logger(file_logger, make_settings(AsyncLoggerPolicy::Block));
+
+		UInt64 index = 0;
+		while (state.loop())
+			log_message(logger, index++);
+
+		logger.flush();
+		add_flush_counter(state, *file);
+	}
+
+	UNICORE_BENCHMARK(async_logger_log_block, "AsyncLogger::log/block")
+	{
+		async_logger_log<AsyncLoggerPolicy::Block>(state);
+	}
+
+	UNICORE_BENCHMARK(async_logger_log_drop, "AsyncLogger::log/drop")
+	{
+		async_logger_log<AsyncLoggerPolicy::Drop>(state);
+	}
+
+	// Arguments larger than record go to heap, none of them is lost
+	UNICORE_BENCHMARK(async_logger_log_oversized, "AsyncLogger::log/oversized")
+	{
+		LastMessageLogger target;
+		AsyncLogger logger(target, make_settings(AsyncLoggerPolicy::Block));
+
+		const String text(300, 'b');
+		const auto expected = text + " tail 5";
+
+		while (state.loop())
+			logger.log(LogType::Info, "{} tail {}", text, 5);
+
+		logger.flush();
+		if (target.text != expected)
+			state.fail("Arguments after oversized string were lost");
+	}
+
+	UNICORE_BENCHMARK(async_logger_log_threads, "AsyncLogger::log/block/4 threads")
+	{
+		FileLogger file_logger(std::make_shared<NullWriteFile>(), FileBufferSize);
+		AsyncLogger logger(file_logger, make_settings(AsyncLoggerPolicy::Block));
+
+		std::atomic<Bool> stop{ false };
+		List<std::thread> threads;
+		for (int i = 0; i < 3; i++)
+		{
+			threads.emplace_back([&logger, &stop]
+			{
+				UInt64 index = 0;
+				while (!stop.load(std::memory_order_relaxed))
+					logger.log(LogType::Info, "Worker {} step {}", "job", index++);
+			});
+		}
+
+		UInt64 index = 0;
+		while (state.loop())
+			logger.log(LogType::Info, "Loaded {} in {} ms, scale {}", "textures/atlas.png", index++, 1.5f);
+
+		stop = true;
+		for (auto& thread : threads)
+			thread.join();
+
+		logger.flush();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include "Benchmark.hpp"
+#if defined(UNICORE_USE_RAYCAST)
+#include "unicore/math/Random.hpp"
+#include "unicore/raycast/Raycast.hpp"
+
+namespace unicore
+{
+	namespace
+	{
+		// Closed box with random pillars, about 5% of cells are solid
+		class GridRaycastWorld : public IRaycastWorld
+		{
+		public:
+			static constexpr int Size = 256;
+
+			GridRaycastWorld()
+				: _cells(Size * Size, false)
+			{
+				SeededRandom random(7);
+				for (int y = 0; y < Size; y++)
+				{
+					for (int x = 0; x < Size; x++)
+					{
+						const auto border = x == 0 || y == 0 || x == Size - 1 || y == Size - 1;
+						_cells[y * Size + x] = border || random.range(100u) < 5;
+					}
+				}
+			}
+
+			UC_NODISCARD bool is_solid(const Vector2i& index) const override
+			{
+				if (index.x < 0 || index.y < 0 || index.x >= Size || index.y >= Size)
+					return true;
+
+				return _cells[index.y * Size + index.x];
+			}
+
+		protected:
+			List<bool> _cells;
+		};
+	}
+
+	// Raycast ////////////////////////////////////////////////////////////////////
+	UNICORE_BENCHMARK(raycast_cast_ray, "Raycast::cast_ray/256")
+	{
+		const GridRaycastWorld world;
+
+		// One screen of rays from the center of the map
+		List<Ray2> rays;
+		const Vector2f origin(GridRaycastWorld::Size / 2.f + 0.5f);
+		for (int i = 0; i < 320; i++)
+		{
+			const auto angle = static_cast<Float>(i) / 320 * 2 * Math::Pi;
+			rays.emplace_back(origin, Vector2f(Math::cos(angle), Math::sin(angle)));
+		}
+
+		Size index = 0;
+		while (state.loop())
+		{
+			const auto hit = Raycast::cast_ray(rays[index++ % rays.size()], world);
+			Benchmark::keep(hit);
+		}
+	}
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,378 @@
+#include "Benchmark.hpp"
+#if defined(UNICORE_USE_REMOTEUI)
+#include "unicore/remoteui/Document.hpp"
+#include "unicore/remoteui/DocumentStream.hpp"
+#include "unicore/system/StringBuilder.hpp"
+
+namespace unicore
+{
+	namespace
+	{
+		constexpr int GroupCount = 100;
+		constexpr int ItemCount = 100;
+
+		// Document layout before slot array: node info, actions and children
+		// in separate ordered maps, for old vs new comparison
+		class MapDocument
+		{
+		public:
+			using Index = remoteui::ElementIndex;
+
+			Index create_group(remoteui::GroupType type,
+				const remoteui::ElementOptions& options, Index parent = remoteui::ElementIndex_Invalid)
+			{
+				auto copy_options = options;
+				copy_options.attributes[remoteui::Attribute::Type] = type;
+				return create_node(remoteui::ElementTag::Group, copy_options, parent);
+			}
+
+			Index create_visual(remoteui::VisualType type,
+				const remoteui::ElementOptions& options, Index parent = remoteui::ElementIndex_Invalid)
+			{
+				auto copy_options = options;
+				copy_options.attributes[remoteui::Attribute::Type] = type;
+				return create_node(remoteui::ElementTag::Visual, copy_options, parent);
+			}
+
+			Index create_node(remoteui::ElementTag tag,
+				const remoteui::ElementOptions& options, Index parent)
+			{
+				const auto index = Index(_last_index++);
+				auto& info = _node_infos[index];
+				info.tag = tag;
+				info.parent = parent;
+				info.attributes = options.attributes;
+
+				if (!options.actions.empty())
+					_node_actions[index] = options.actions;
+
+				if (parent != remoteui::ElementIndex_Invalid)
+					_node_children[parent].push_back(index);
+				else _roots.push_back(index);
+
+				return index;
+			}
+
+			UC_NODISCARD StringView get_node_name(Index index) const
+			{
+				StringView name;
+				if (const auto it = _node_infos.find(index); it != _node_infos.end())
+				{
+					if (const auto attr = it->second.attributes.find(remoteui::Attribute::Name);
+						attr != it->second.attributes.end())
+						attr->second.try_get_string(name);
+				}
+				return name;
+			}
+
+			UC_NODISCARD Index query(const Predicate<Index>& predicate) const
+			{
+				return internal_query(remoteui::ElementIndex_Invalid, predicate);
+			}
+
+			void remove_node(Index index)
+			{
+				if (const auto it = _node_children.find(index); it != _node_children.end())
+				{
+					for (const auto child : it->second)
+						remove_node(child);
+					_node_children.erase(it);
+				}
+
+				_node_actions.erase(index);
+				_node_infos.erase(index);
+				_roots.erase(std::remove(_roots.begin(), _roots.end(), index), _roots.end());
+			}
+
+		protected:
+			struct NodeInfo
+			{
+				remoteui::ElementTag tag = remoteui::ElementTag::Group;
+				Index parent = remoteui::ElementIndex_Invalid;
+				remoteui::AttributeDict attributes;
+			};
+
+			List<Index> _roots;
+			Dictionary<Index, NodeInfo> _node_infos;
+			Dictionary<Index, remoteui::UIActionDict> _node_actions;
+			Dictionary<Index, List<Index>> _node_children;
+			Index::TypeValue _last_index = 0;
+
+			UC_NODISCARD Index internal_query(Index index, const Predicate<Index>& predicate) const
+			{
+				if (index != remoteui::ElementIndex_Invalid && predicate(index))
+					return index;
+
+				const List<Index>* children = &_roots;
+				if (index != remoteui::ElementIndex_Invalid)
+				{
+					const auto it = _node_children.find(index);
+					children = it != _node_children.end() ? &it->second : nullptr;
+				}
+
+				if (children)
+				{
+					for (const auto child : *children)
+					{
+						if (const auto find = internal_query(child, predicate); find != remoteui::ElementIndex_Invalid)
+							return find;
+					}
+				}
+
+				return remoteui::ElementIndex_Invalid;
+			}
+		};
+
+		// Options of all nodes are built once, so create benchmarks
+		// measure document and not formatting of names
+		struct NodeOptions
+		{
+			List<remoteui::ElementOptions> groups;
+			List<remoteui::ElementOptions> items;
+		};
+
+		const NodeOptions& get_node_options()
+		{
+			using namespace remoteui;
+
+			static const auto options = []
+			{
+				NodeOptions result;
+				for (int i = 0; i < GroupCount; i++)
+				{
+					result.groups.push_back({ { { Attribute::Name, StringBuilder::format("group_{}", i) } } });
+					for (int j = 0; j < ItemCount; j++)
+					{
+						result.items.push_back({ { { Attribute::Name, StringBuilder::format("item_{}", i * ItemCount + j) },
+							{ Attribute::Text, StringBuilder::format("Text {}", j) } } });
+					}
+				}
+				return result;
+			}();
+
+			return options;
+		}
+
+		// 10k text nodes in 100 groups, every node has unique name
+		template<typename DocumentType>
+		auto fill_document(DocumentType& document)
+		{
+			using namespace remoteui;
+
+			const auto& options = get_node_options();
+			const auto root = document.create_group(GroupType::Vertical, {});
+			for (int i = 0; i < GroupCount; i++)
+			{
+				const auto group = document.create_group(GroupType::Horizontal, options.groups[i], root);
+				for (int j = 0; j < ItemCount; j++)
+					document.create_visual(VisualType::Text, options.items[i * ItemCount + j], group);
+			}
+
+			return root;
+		}
+	}
+
+	// Document ///////////////////////////////////////////////////////////////////
+	UNICORE_BENCHMARK(document_query, "remoteui::Document::query/10k")
+	{
+		remoteui::Document document;
+		fill_document(document);
+
+		// Last node, whole tree is visited
+		const auto predicate = [](const remoteui::Element& element)
+		{
+			return element.name() == "item_9999";
+		};
+
+		while (state.loop())
+		{
+			const auto element = document.query(predicate);
+			Benchmark::keep(element);
+		}
+	}
+
+	UNICORE_BENCHMARK(document_query_baseline, "remoteui::Document::query/10k/maps")
+	{
+		MapDocument document;
+		fill_document(document);
+
+		const auto predicate = [&document](MapDocument::Index index)
+		{
+			return document.get_node_name(index) == "item_9999";
+		};
+
+		while (state.loop())
+		{
+			const auto index = document.query(predicate);
+			Benchmark::keep(index);
+		}
+	}
+
+	UNICORE_BENCHMARK(document_find_by_name, "remoteui::Document::find_by_name/10k")
+	{
+		remoteui::Document document;
+		fill_document(document);
+
+		List<String> names;
+		for (int i = 0; i < GroupCount * ItemCount; i += 97)
+			names.push_back(StringBuilder::format("item_{}", i));
+
+		Size index = 0;
+		while (state.loop())
+		{
+			const auto element = document.find_by_name(names[index++ % names.size()]);
+			Benchmark::keep(element);
+		}
+	}
+
+	UNICORE_BENCHMARK(document_find_all_by_tag, "remoteui::Document::find_all_by_tag/10k")
+	{
+		remoteui::Document document;
+		fill_document(document);
+
+		List<remoteui::Element> elements;
+		while (state.loop())
+		{
+			elements.clear();
+			document.find_all_by_tag(remoteui::ElementTag::Group, elements);
+			Benchmark::keep(elements);
+		}
+	}
+
+	// Same options as nodes already have, every attribute is compared
+	// and nothing changes, as when UI code rebuilds options each frame
+	UNICORE_BENCHMARK(document_apply_options, "remoteui::Document::apply_options/10k")
+	{
+		remoteui::Document document;
+		fill_document(document);
+
+		List<remoteui::Element> items;
+		document.find_all_by_tag(remoteui::ElementTag::Visual, items);
+
+		List<remoteui::ElementOptions> options(items.size());
+		for (Size i = 0; i < items.size(); i++)
+			document.get_node_attributes(items[i], options[i].attributes);
+
+		while (state.loop())
+		{
+			for (Size i = 0; i < items.size(); i++)
+				document.apply_options(items[i], options[i]);
+		}
+	}
+
+	// DocumentEncoder ////////////////////////////////////////////////////////////
+	// Edits of busy debug UI per frame: counters rewritten twice (second write
+	// is coalesced), values updated with intermediate steps, rows toggled,
+	// one row removed and recreated.
+	UNICORE_BENCHMARK(document_encoder_flush_stress, "remoteui::DocumentEncoder::flush/stress")
+	{
+		using namespace remoteui;
+
+		constexpr Size TextCount = 200;
+		constexpr Size ValueCount = 100;
+		constexpr Size HiddenCount = 50;
+
+		const auto document = std::make_shared<Document>();
+		fill_document(*document);
+
+		List<Element> groups, items;
+		document->find_all_by_tag(ElementTag::Group, groups);
+		document->find_all_by_tag(ElementTag::Visual, items);
+
+		DocumentEncoder encoder;
+		encoder.set_document(document);
+
+		// Initial frame is whole document, not part of measurement
+		List<Byte> data;
+		encoder.flush(data);
+		const auto start = encoder.stats();
+
+		Size frame = 0;
+		while (state.loop())
+		{
+			for (Size i = 0; i < TextCount; i++)
+			{
+				const auto& item = items[(frame * 7 + i * 31) % items.size()];
+				document->set_node_attribute(item, Attribute::Text, StringBuilder::format("Count {}", frame));
+				document->set_node_attribute(item, Attribute::Text, StringBuilder::format("Count {}", frame + 1));
+			}
+
+			for (Size i = 0; i < ValueCount; i++)
+			{
+				const auto& item = items[(frame * 13 + i * 53) % items.size()];
+				for (int step = 0; step < 3; step++)
+					document->set_node_attribute(item, Attribute::Value, static_cast<Int>(frame + step));
+			}
+
+			for (Size i = 0; i < HiddenCount; i++)
+			{
+				const auto& item = items[(frame + i * 97) % items.size()];
+				document->set_node_hidden(item, (frame & 1) == 0);
+			}
+
+			const auto& group = groups[1 + frame % (groups.size() - 1)];
+			const auto row = document->create_visual(VisualType::Text,
+				{ { { Attribute::Text, StringBuilder::format("Row {}", frame) } } }, group);
+			document->remove_node(document->get_node_child(group, 0));
+			Benchmark::keep(row);
+
+			data.clear();
+			encoder.flush(data);
+			Benchmark::keep(data);
+			frame++;
+		}
+
+		const auto& stats = encoder.stats();
+		const auto frames = static_cast<Double>(stats.frames - start.frames);
+		if (frames > 0)
+		{
+			state.counter("bytes/frame", static_cast<Double>(stats.bytes - start.bytes) / frames);
+			state.counter("coalesced/frame", static_cast<Double>(stats.coalesced - start.coalesced) / frames);
+		}
+	}
+
+	// Create benchmarks include destruction of document, remove ones
+	// add removal of root: teardown cost is difference between them
+	UNICORE_BENCHMARK(document_create, "remoteui::Document::create/10k")
+	{
+		while (state.loop())
+		{
+			remoteui::Document document;
+			fill_document(document);
+			Benchmark::keep(document);
+		}
+	}
+
+	UNICORE_BENCHMARK(document_create_baseline, "remoteui::Document::create/10k/maps")
+	{
+		while (state.loop())
+		{
+			MapDocument document;
+			fill_document(document);
+			Benchmark::keep(document);
+		}
+	}
+
+	UNICORE_BENCHMARK(document_remove, "remoteui::Document::create+remove/10k")
+	{
+		while (state.loop())
+		{
+			remoteui::Document document;
+			const auto root = fill_document(document);
+			if (!document.remove_node(root) || !document.get_roots().empty())
+				state.fail("Document was not cleared");
+			Benchmark::keep(document);
+		}
+	}
+
+	UNICORE_BENCHMARK(document_remove_baseline, "remoteui::Document::create+remove/10k/maps")
+	{
+		while (state.loop())
+		{
+			MapDocument document;
+			document.remove_node(fill_document(document));
+			Benchmark::keep(document);
+		}
+	}
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,610 @@
+#include "Benchmark.hpp"
+#include "unicore/math/Random.hpp"
+#include "unicore/io/MemoryFile.hpp"
+#include "unicore/resource/BinaryData.hpp"
+#include "unicore/renderer/Font.hpp"
+#include "unicore/renderer/SpriteBatch.hpp"
+#include "unicore/renderer/PrimitiveBatch.hpp"
+#include "unicore/renderer/Canvas.hpp"
+#include "unicore/renderer/TiledCanvas.hpp"
+#include "unicore/renderer/SurfaceContainer.hpp"
+#include "unicore/system/JobSystem.hpp"
+#if defined(UNICORE_USE_STB_IMAGE) && defined(UNICORE_USE_STB_IMAGE_WRITE)
+#include "unicore/stb/StbSurfaceWriter.hpp"
+#include <stb_image.h>
+#endif
+#include <cstring>
+
+namespace unicore
+{
+	namespace
+	{
+		class BenchmarkTexture : public Texture
+		{
+		public:
+			explicit BenchmarkTexture(const Vector2i& size)
+				: _size(size) {}
+
+			UC_NODISCARD size_t get_system_memory_use() const override { return sizeof(BenchmarkTexture); }
+			UC_NODISCARD size_t get_video_memory_use() const override { return 0; }
+			UC_NODISCARD const Vector2i& size() const override { return _size; }
+
+		protected:
+			Vector2i _size;
+		};
+
+		// Accepts all draw calls and only counts vertices
+		class NullPipeline : public sdl2::PipelineRender
+		{
+		public:
+			UInt64 vertices = 0;
+
+			void set_draw_color(const Color4b& color) override { _color = color; }
+			UC_NODISCARD const Color4b& get_draw_color() const override { return _color; }
+
+			void draw_pointi(const Vector2i& p) override { vertices++; }
+			void draw_pointf(const Vector2f& p) override { vertices++; }
+			void draw_pointsi(const Vector2i* points, unsigned count) override { vertices += count; }
+			void draw_pointsf(const Vector2f* points, unsigned count) override { vertices += count; }
+
+			void draw_linei(const Vector2i& p1, const Vector2i& p2) override { vertices += 2; }
+			void draw_linef(const Vector2f& p1, const Vector2f& p2) override { vertices += 2; }
+			void draw_poly_linei(const Vector2i* points, unsigned count) override { vertices += count; }
+			void draw_poly_linef(const Vector2f* points, unsigned count) override { vertices += count; }
+
+			void draw_recti(const Recti& rect, bool filled) override { vertices += 4; }
+			void draw_rectf(const Rectf& rect, bool filled) override { vertices += 4; }
+			void draw_rectsi(const Recti* rects, unsigned count, bool filled) override { vertices += count * 4; }
+			void draw_rectsf(const Rectf* rects, unsigned count, bool filled) override { vertices += count * 4; }
+
+			void draw_trianglesf(const VertexColor2f* data, unsigned num_vertices) override
+			{
+				vertices += num_vertices;
+			}
+
+			void draw_trianglesf(const VertexColorTexture2f* data, unsigned num_vertices,
+				const Texture* texture) override
+			{
+				vertices += num_vertices;
+			}
+
+			bool copyi(const Shared<Texture>& texture,
+				const Optional<Recti>& src_rect, const Optional<Recti>& dst_rect) override
+			{
+				vertices += 4;
+				return true;
+			}
+
+			bool copyf(const Shared<Texture>& texture,
+				const Optional<Recti>& src_rect, const Optional<Rectf>& dst_rect) override
+			{
+				vertices += 4;
+				return true;
+			}
+
+			bool copy_exi(const Shared<Texture>& texture,
+				const Optional<Recti>& src_rect, const Optional<Recti>& dst_rect,
+				Degrees angle, const Optional<Vector2i>& center, sdl2::RenderFlip flip) override
+			{
+				vertices += 4;
+				return true;
+			}
+
+			bool copy_exf(const Shared<Texture>& texture,
+				const Optional<Recti>& src_rect, const Optional<Rectf>& dst_rect,
+				Degrees angle, const Optional<Vector2f>& center, sdl2::RenderFlip flip) override
+			{
+				vertices += 4;
+				return true;
+			}
+
+		protected:
+			Color4b _color = ColorConst4b::White;
+		};
+
+		// Every char is 8x16 quad
+		class BenchmarkGeometryFont : public GeometryFont
+		{
+		public:
+			UC_NODISCARD Size get_system_memory_use() const override { return sizeof(BenchmarkGeometryFont); }
+			UC_NODISCARD float get_height() const override { return 16; }
+			UC_NODISCARD float calc_width(StringView32 text) const override { return static_cast<float>(text.size()) * 8; }
+
+			size_t generate(const Vector2f& position, StringView32 text,
+				const Color4b& color, List<QuadColor2f>& quad_list) const override
+			{
+				for (Size i = 0; i < text.size(); i++)
+				{
+					const Rectf rect(position.x + static_cast<Float>(i) * 8, position.y, 8, 16);
+					quad_list.push_back({ {
+						{ rect.top_left(), color }, { rect.top_right(), color },
+						{ rect.bottom_right(), color }, { rect.bottom_left(), color } } });
+				}
+				return text.size();
+			}
+		};
+
+		// Every char is 8x16 quad of one texture
+		class BenchmarkTexturedFont : public TexturedFont
+		{
+		public:
+			explicit BenchmarkTexturedFont(const Shared<Texture>& texture)
+				: _texture(texture) {}
+
+			UC_NODISCARD Size get_system_memory_use() const override { return sizeof(BenchmarkTexturedFont); }
+			UC_NODISCARD float get_height() const override { return 16; }
+			UC_NODISCARD float calc_width(StringView32 text) const override { return static_cast<float>(text.size()) * 8; }
+
+			void generate(const Vector2f& position, StringView32 text, const Color4b& color,
+				Dictionary<Shared<Texture>, List<QuadColorTexture2f>>& quad_dict) override
+			{
+				auto& quad_list = quad_dict[_texture];
+				for (Size i = 0; i < text.size(); i++)
+				{
+					const Rectf rect(position.x + static_cast<Float>(i) * 8, position.y, 8, 16);
+					quad_list.push_back({ {
+						{ rect.top_left(), color }, { rect.top_right(), color },
+						{ rect.bottom_right(), color }, { rect.bottom_left(), color } } });
+				}
+			}
+
+		protected:
+			Shared<Texture> _texture;
+		};
+
+		constexpr UInt32 SpriteCount = 1000;
+		constexpr UInt32 TextureCount = 4;
+
+		// Sprites are grouped by texture, every group is one batch
+		void fill_sprites(SpriteBatch& batch, const List<Shared<Texture>>& textures)
+		{
+			batch.clear();
+			for (UInt32 i = 0; i < SpriteCount; i++)
+			{
+				const auto& texture = textures[i * TextureCount / SpriteCount];
+				const Rectf rect(static_cast<Float>(i % 40) * 20, static_cast<Float>(i / 40) * 20, 16, 16);
+				batch.draw(rect, ColorConst4b::White, texture);
+			}
+			batch.flush();
+		}
+
+		List<Shared<Texture>> create_textures()
+		{
+			List<Shared<Texture>> textures;
+			for (UInt32 i = 0; i < TextureCount; i++)
+				textures.push_back(std::make_shared<BenchmarkTexture>(Vector2i(64)));
+			return textures;
+		}
+
+		void fill_primitives(PrimitiveBatch& batch)
+		{
+			batch.clear();
+			for (int i = 0; i < 100; i++)
+			{
+				const Vector2f center(static_cast<Float>(i % 10) * 50, static_cast<Float>(i / 10) * 50);
+				batch.set_color(Color4b(i * 2, 255 - i * 2, 128));
+				batch.draw_circle(center, 20, i % 2 == 0);
+				batch.draw_rect(Rectf(center.x - 10, center.y - 10, 20, 20), i % 3 == 0);
+				batch.draw_line(center, center + Vector2f(30, 15));
+			}
+			batch.flush();
+		}
+
+		List<Vector2i> random_points(UInt32 count, const Vector2i& size)
+		{
+			SeededRandom random(42);
+			List<Vector2i> points;
+			for (UInt32 i = 0; i < count; i++)
+				points.emplace_back(random.range(0, size.x), random.range(0, size.y));
+			return points;
+		}
+
+		Shared<BinaryData> read_back(WriteMemoryFile& file)
+		{
+			MemoryChunk chunk(static_cast<Size>(file.size()));
+			file.seek(0, SeekMethod::Begin);
+			file.read(chunk.data(), chunk.size(), nullptr);
+			return std::make_shared<BinaryData>(std::move(chunk));
+		}
+
+		Shared<BinaryData> write_container(const Surface& surface, SurfaceContainer::Compression compression)
+		{
+			SurfaceContainer::WriteOptions options;
+			options.compression = compression;
+
+			WriteMemoryFile file;
+			SurfaceContainer::write(file, surface, options);
+			return read_back(file);
+		}
+
+		// Same image for every container and PNG load benchmark
+		const DynamicSurface& load_asset()
+		{
+			static const auto surface = []
+			{
+				auto result = std::make_unique<DynamicSurface>(512, 512);
+				Canvas<Color4b> canvas(*result);
+				canvas.fill_circle(Vector2i(256), 200, ColorConst4b::Red);
+				return result;
+			}();
+			return *surface;
+		}
+	}
+
+	// SpriteBatch ////////////////////////////////////////////////////////////////
+	UNICORE_BENCHMARK(sprite_batch_draw, "SpriteBatch::draw/1000")
+	{
+		const auto textures = create_textures();
+		SpriteBatch batch;
+
+		while (state.loop())
+		{
+			fill_sprites(batch, textures);
+			Benchmark::keep(batch);
+		}
+	}
+
+	UNICORE_BENCHMARK(sprite_batch_render, "SpriteBatch::render/1000")
+	{
+		const auto textures = create_textures();
+		SpriteBatch batch;
+		fill_sprites(batch, textures);
+
+		NullPipeline pipeline;
+		while (state.loop())
+			batch.render(pipeline);
+
+		Benchmark::keep(pipeline.vertices);
+	}
+
+	// PrimitiveBatch /////////////////////////////////////////////////////////////
+	UNICORE_BENCHMARK(primitive_batch_render, "PrimitiveBatch::render/300")
+	{
+		PrimitiveBatch batch;
+		fill_primitives(batch);
+
+		NullPipeline pipeline;
+		while (state.loop())
+			batch.render(pipeline);
+
+		Benchmark::keep(pipeline.vertices);
+	}
+
+	// Transient frame data ///////////////////////////////////////////////////////
+	// Typical UI frame: shapes, paths and aligned text. Shows
+	// allocations that are made every frame by batch helpers.
+	UNICORE_BENCHMARK(transient_frame, "Frame/transient")
+	{
+		const auto texture = std::make_shared<BenchmarkTexture>(Vector2i(64));
+		const auto geometry_font = std::make_shared<BenchmarkGeometryFont>();
+		const auto textured_font = std::make_shared<BenchmarkTexturedFont>(texture);
+		const TextBlock block(geometry_font, U"First line\nSecond line\nThird line");
+
+		List<Vector2f> path;
+		for (int i = 0; i < 64; i++)
+			path.emplace_back(static_cast<Float>(i) * 10, static_cast<Float>(i % 2) * 20);
+
+		PrimitiveBatch primitives;
+		SpriteBatch sprites;
+		NullPipeline pipeline;
+
+		while (state.loop())
+		{
+			primitives.clear();
+			for (int i = 0; i < 20; i++)
+			{
+				const Vector2f center(static_cast<Float>(i) * 40, 100);
+				primitives.draw_circle(center, 16, i % 2 == 0);
+				primitives.draw_text(*geometry_font, center, U"Label\nvalue", TextAlign::Center);
+			}
+			primitives.draw_path(path, {});
+			primitives.flush();
+
+			sprites.clear();
+			for (int i = 0; i < 20; i++)
+			{
+				const Vector2f pos(static_cast<Float>(i) * 40, 200);
+				sprites.print(textured_font, pos, U"Textured text", ColorConst4b::White);
+				sprites.print(block, pos + Vector2f(0, 40), TextAlign::TopMiddle, ColorConst4b::White);
+			}
+			sprites.flush();
+
+			primitives.render(pipeline);
+			sprites.render(pipeline);
+		}
+
+		Benchmark::keep(pipeline.vertices);
+	}
+
+	// Canvas /////////////////////////////////////////////////////////////////////
+	UNICORE_BENCHMARK(canvas_draw_line, "Canvas::draw_line/64")
+	{
+		DynamicSurface surface(1024, 1024);
+		Canvas<Color4b> canvas(surface);
+		const auto points = random_points(65, surface.size());
+
+		while (state.loop())
+		{
+			for (Size i = 1; i < points.size(); i++)
+				canvas.draw_line(points[i - 1], points[i], ColorConst4b::Red);
+		}
+
+		Benchmark::keep(surface);
+	}
+
+	UNICORE_BENCHMARK(canvas_fill_circle, "Canvas::fill_circle/r100")
+	{
+		DynamicSurface surface(1024, 1024);
+		Canvas<Color4b> canvas(surface);
+
+		while (state.loop())
+			canvas.fill_circle(Vector2i(512), 100, ColorConst4b::Green);
+
+		Benchmark::keep(surface);
+	}
+
+	UNICORE_BENCHMARK(canvas_fill_polygon, "Canvas::fill_polygon/16")
+	{
+		DynamicSurface surface(1024, 1024);
+		Canvas<Color4b> canvas(surface);
+		const auto points = random_points(16, surface.size());
+
+		while (state.loop())
+			canvas.fill_polygon(points.data(), static_cast<unsigned>(points.size()), ColorConst4b::Green);
+
+		Benchmark::keep(surface);
+	}
+
+	UNICORE_BENCHMARK(canvas_fill, "Canvas::fill/2048")
+	{
+		DynamicSurface surface(2048, 2048);
+		Canvas<Color4b> canvas(surface);
+
+		while (state.loop())
+			canvas.fill(ColorConst4b::Blue);
+
+		Benchmark::keep(surface);
+	}
+
+	// TiledCanvas ////////////////////////////////////////////////////////////////
+	// Same operations on serial Canvas and on TiledCanvas with explicit
+	// pool sizes. Tiled result is compared with serial one after the loop.
+	namespace
+	{
+		constexpr int TiledSize = 4096;
+
+		enum class CanvasOp
+		{
+			Fill,
+			FillCallback,
+			Copy,
+		};
+
+		const Canvas<Color4b>::CallbackFunction& pattern_callback()
+		{
+			static const Canvas<Color4b>::CallbackFunction func =
+				[](Canvas<Color4b>& canvas, const Vector2i& pos)
+				{
+					const auto value = static_cast<UInt8>(pos.x ^ pos.y);
+					canvas.draw_point(pos, Color4b(value, static_cast<UInt8>(pos.x), static_cast<UInt8>(pos.y), 255));
+					return true;
+				};
+			return func;
+		}
+
+		const Surface& copy_source()
+		{
+			static const auto surface = []
+			{
+				auto result = std::make_unique<DynamicSurface>(TiledSize, TiledSize);
+				Canvas<Color4b> canvas(*result);
+				canvas.fill(pattern_callback());
+				return result;
+			}();
+			return *surface;
+		}
+
+		template<CanvasOp Op, typename CanvasType>
+		void apply_canvas_op(CanvasType& canvas)
+		{
+			if constexpr (Op == CanvasOp::Fill)
+				canvas.fill(ColorConst4b::Blue);
+			else if constexpr (Op == CanvasOp::FillCallback)
+				canvas.fill(pattern_callback());
+			else
+				canvas.copy_buffer(Vector2i(1, 1), copy_source());
+		}
+
+		// Serial result, computed once per operation
+		template<CanvasOp Op>
+		const DynamicSurface& canvas_reference()
+		{
+			static const auto surface = []
+			{
+				auto result = std::make_unique<DynamicSurface>(TiledSize, TiledSize);
+				Canvas<Color4b> canvas(*result);
+				apply_canvas_op<Op>(canvas);
+				return result;
+			}();
+			return *surface;
+		}
+
+		template<CanvasOp Op>
+		void canvas_serial(BenchmarkState& state)
+		{
+			DynamicSurface surface(TiledSize, TiledSize);
+			Canvas<Color4b> canvas(surface);
+
+			while (state.loop())
+				apply_canvas_op<Op>(canvas);
+
+			Benchmark::keep(surface);
+		}
+
+		template<CanvasOp Op, unsigned Threads>
+		void canvas_tiled(BenchmarkState& state)
+		{
+			const auto& reference = canvas_reference<Op>();
+
+			DynamicSurface surface(TiledSize, TiledSize);
+			ThreadPool pool(Threads);
+			TiledCanvas<Color4b> canvas(surface, pool);
+
+			while (state.loop())
+				apply_canvas_op<Op>(canvas);
+
+			if (surface.size_bytes() != reference.size_bytes() ||
+				std::memcmp(surface.data(), reference.data(), surface.size_bytes()) != 0)
+				state.fail("Tiled result differs from serial Canvas");
+		}
+	}
+
+	UNICORE_BENCHMARK(canvas_fill_4096, "Canvas::fill/4096") { canvas_serial<CanvasOp::Fill>(state); }
+	UNICORE_BENCHMARK(tiled_canvas_fill_1, "TiledCanvas::fill/4096/1") { canvas_tiled<CanvasOp::Fill, 1>(state); }
+	UNICORE_BENCHMARK(tiled_canvas_fill_2, "TiledCanvas::fill/4096/2") { canvas_tiled<CanvasOp::Fill, 2>(state); }
+	UNICORE_BENCHMARK(tiled_canvas_fill_4, "TiledCanvas::fill/4096/4") { canvas_tiled<CanvasOp::Fill, 4>(state); }
+	UNICORE_BENCHMARK(tiled_canvas_fill_8, "TiledCanvas::fill/4096/8") { canvas_tiled<CanvasOp::Fill, 8>(state); }
+
+	UNICORE_BENCHMARK(canvas_fill_callback_4096, "Canvas::fill_callback/4096") { canvas_serial<CanvasOp::FillCallback>(state); }
+	UNICORE_BENCHMARK(tiled_canvas_fill_callback_1, "TiledCanvas::fill_callback/4096/1") { canvas_tiled<CanvasOp::FillCallback, 1>(state); }
+	UNICORE_BENCHMARK(tiled_canvas_fill_callback_2, "TiledCanvas::fill_callback/4096/2") { canvas_tiled<CanvasOp::FillCallback, 2>(state); }
+	UNICORE_BENCHMARK(tiled_canvas_fill_callback_4, "TiledCanvas::fill_callback/4096/4") { canvas_tiled<CanvasOp::FillCallback, 4>(state); }
+	UNICORE_BENCHMARK(tiled_canvas_fill_callback_8, "TiledCanvas::fill_callback/4096/8") { canvas_tiled<CanvasOp::FillCallback, 8>(state); }
+
+	UNICORE_BENCHMARK(canvas_copy_4096, "Canvas::copy_buffer/4096") { canvas_serial<CanvasOp::Copy>(state); }
+	UNICORE_BENCHMARK(tiled_canvas_copy_1, "TiledCanvas::copy_buffer/4096/1") { canvas_tiled<CanvasOp::Copy, 1>(state); }
+	UNICORE_BENCHMARK(tiled_canvas_copy_2, "TiledCanvas::copy_buffer/4096/2") { canvas_tiled<CanvasOp::Copy, 2>(state); }
+	UNICORE_BENCHMARK(tiled_canvas_copy_4, "TiledCanvas::copy_buffer/4096/4") { canvas_tiled<CanvasOp::Copy, 4>(state); }
+	UNICORE_BENCHMARK(tiled_canvas_copy_8, "TiledCanvas::copy_buffer/4096/8") { canvas_tiled<CanvasOp::Copy, 8>(state); }
+
+	// Surface ////////////////////////////////////////////////////////////////////
+	UNICORE_BENCHMARK(surface_convert, "PixelConvert::convert/abgr-argb/1024")
+	{
+		DynamicSurface surface(1024, 1024);
+		List<UInt32> pixels(1024 * 1024);
+
+		while (state.loop())
+		{
+			PixelConvert::convert(pixel_format_argb, pixels.data(), PixelConvert::color4b_format,
+				static_cast<const UInt32*>(surface.data()), pixels.size());
+		}
+
+		Benchmark::keep(pixels);
+	}
+
+	// Whole 4096 surface, serial and split by rows with JobSystem::parallel_for.
+	// Parallel result is compared with serial one after the loop.
+	namespace
+	{
+		constexpr UInt32 ConvertRowBatch = 64;
+
+		void convert_rows(const Surface& src, UInt32* dest, UInt32 begin, UInt32 end)
+		{
+			const auto width = static_cast<Size>(src.size().x);
+			PixelConvert::convert(pixel_format_argb, dest + begin * width, src.format(),
+				static_cast<const UInt32*>(src.data()) + begin * width, (end - begin) * width);
+		}
+
+		const List<UInt32>& convert_reference()
+		{
+			static const auto pixels = []
+			{
+				const auto& src = copy_source();
+				List<UInt32> result(src.size().area());
+				convert_rows(src, result.data(), 0, static_cast<UInt32>(src.size().y));
+				return result;
+			}();
+			return pixels;
+		}
+	}
+
+	UNICORE_BENCHMARK(surface_convert_serial, "PixelConvert::convert/abgr-argb/4096/serial")
+	{
+		const auto& src = copy_source();
+		List<UInt32> pixels(src.size().area());
+
+		while (state.loop())
+			convert_rows(src, pixels.data(), 0, static_cast<UInt32>(src.size().y));
+
+		Benchmark::keep(pixels);
+	}
+
+	UNICORE_BENCHMARK(surface_convert_parallel, "PixelConvert::convert/abgr-argb/4096/parallel_for")
+	{
+		const auto& src = copy_source();
+		const auto& reference = convert_reference();
+		List<UInt32> pixels(src.size().area());
+
+		JobSystem jobs;
+		while (state.loop())
+		{
+			jobs.parallel_for(static_cast<UInt32>(src.size().y), ConvertRowBatch,
+				[&src, &pixels](UInt32 begin, UInt32 end)
+				{
+					convert_rows(src, pixels.data(), begin, end);
+				});
+		}
+
+		if (pixels != reference)
+			state.fail("parallel_for result differs from serial convert");
+	}
+
+	UNICORE_BENCHMARK(surface_to_colors, "PixelConvert::to_colors/argb/1024")
+	{
+		List<UInt32> pixels(1024 * 1024, 0x80FF4020);
+		List<Color4b> colors(pixels.size());
+
+		while (state.loop())
+			PixelConvert::to_colors(pixel_format_argb, pixels.data(), colors.data(), pixels.size());
+
+		Benchmark::keep(colors);
+	}
+
+	UNICORE_BENCHMARK(surface_container_load_raw, "SurfaceContainer::load/none/512")
+	{
+		const auto data = write_container(load_asset(), SurfaceContainer::Compression::None);
+
+		while (state.loop())
+		{
+			const auto loaded = SurfaceContainer::load(data);
+			Benchmark::keep(loaded);
+		}
+	}
+
+	UNICORE_BENCHMARK(surface_container_load_lz4, "SurfaceContainer::load/lz4/512")
+	{
+		const auto data = write_container(load_asset(), SurfaceContainer::Compression::Lz4);
+
+		while (state.loop())
+		{
+			const auto loaded = SurfaceContainer::load(data);
+			Benchmark::keep(loaded);
+		}
+	}
+
+#if defined(UNICORE_USE_STB_IMAGE) && defined(UNICORE_USE_STB_IMAGE_WRITE)
+	// Decode of the same image as StbSurfaceLoader does it
+	UNICORE_BENCHMARK(stb_surface_load_png, "stb_image::load/png/512")
+	{
+		WriteMemoryFile file;
+		StbSurfaceWriter::write_png(file, load_asset());
+		const auto data = read_back(file);
+
+		while (state.loop())
+		{
+			int w, h, n;
+			const auto pixels = stbi_load_from_memory(static_cast<const stbi_uc*>(data->data()),
+				static_cast<int>(data->size()), &w, &h, &n, 4);
+			if (!pixels)
+			{
+				state.fail(stbi_failure_reason());
+				break;
+			}
+
+			const auto loaded = std::make_shared<Surface>(
+				Vector2i(w, h), MemoryChunk(pixels, w * h * 4, &stbi_image_free));
+			Benchmark::keep(loaded);
+		}
+	}
+#endif
+}
\ No newline at end of file
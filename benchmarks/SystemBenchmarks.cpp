@@ -0,0 +1,519 @@
+#include "Benchmark.hpp"
+#include "unicore/math/Hash.hpp"
+#include "unicore/math/Vector2.hpp"
+#include "unicore/io/Path.hpp"
+#include "unicore/system/Atom.hpp"
+#include "unicore/system/Event.hpp"
+#include "unicore/system/FixedStepScheduler.hpp"
+#include "unicore/system/FrameArena.hpp"
+#include "unicore/system/JobSystem.hpp"
+#include "unicore/system/PackedVariant.hpp"
+#include "unicore/system/PoolAllocator.hpp"
+#include "unicore/system/StringBuilder.hpp"
+#include "unicore/system/Unicode.hpp"
+#include "unicore/system/Variant.hpp"
+#include <cstring>
+
+namespace unicore
+{
+	namespace
+	{
+		constexpr Size CorpusSize = 4096;
+
+		String make_corpus(StringView32 text)
+		{
+			String32 corpus;
+			while (corpus.size() * 2 < CorpusSize)
+				corpus.append(text);
+			return Unicode::to_utf8(corpus);
+		}
+
+		const String& ascii_corpus()
+		{
+			static const auto corpus = make_corpus(U"The quick brown fox jumps over the lazy dog. ");
+			return corpus;
+		}
+
+		const String& cjk_corpus()
+		{
+			static const auto corpus = make_corpus(
+				U"\u65E5\u672C\u8A9E\u306E\u30C6\u30AD\u30B9\u30C8\u3002\u4E2D\u6587\u5B57\u7B26\u3002");
+			return corpus;
+		}
+
+		const String& emoji_corpus()
+		{
+			static const auto corpus = make_corpus(
+				U"\U0001F600\U0001F680 ok \U0001F44D\U0001F3FD\U0001F389 ");
+			return corpus;
+		}
+
+		template<const String&(*Corpus)()>
+		void utf8_to_utf32(BenchmarkState& state)
+		{
+			const auto& corpus = Corpus();
+			String32 output;
+
+			while (state.loop())
+			{
+				output.clear();
+				Unicode::append(corpus, output);
+				Benchmark::keep(output);
+			}
+		}
+
+		template<const String&(*Corpus)()>
+		void utf32_to_utf8(BenchmarkState& state)
+		{
+			const auto input = Unicode::to_utf32(Corpus());
+			String output;
+
+			while (state.loop())
+			{
+				output.clear();
+				Unicode::append(input, output);
+				Benchmark::keep(output);
+			}
+		}
+
+		template<const String&(*Corpus)()>
+		void utf8_to_utf16(BenchmarkState& state)
+		{
+			const auto& corpus = Corpus();
+			String16 output;
+
+			while (state.loop())
+			{
+				output.clear();
+				Unicode::append(corpus, output);
+				Benchmark::keep(output);
+			}
+		}
+
+		struct Listener
+		{
+			UInt64 sum = 0;
+
+			void on_value(Int value) { sum += value; }
+		};
+
+		template<UInt32 Count>
+		void event_invoke(BenchmarkState& state)
+		{
+			Event<Int> event;
+			List<Listener> listeners(Count);
+			for (auto& listener : listeners)
+				event.template add<&Listener::on_value>(&listener);
+
+			Int value = 0;
+			while (state.loop())
+				event.invoke(value++);
+
+			Benchmark::keep(listeners);
+		}
+	}
+
+	// Crc32 //////////////////////////////////////////////////////////////////////
+	UNICORE_BENCHMARK(crc32_compute, "Crc32::compute_bytes/64KiB")
+	{
+		List<Byte> data(64 * 1024);
+		for (Size i = 0; i < data.size(); i++)
+			data[i] = static_cast<Byte>(i * 31);
+
+		while (state.loop())
+		{
+			const auto crc = Crc32::compute_bytes(data.data(), data.size());
+			Benchmark::keep(crc);
+		}
+	}
+
+	// Unicode ////////////////////////////////////////////////////////////////////
+	UC_UNUSED static const Bool unicode_registered =
+		Benchmark::add("Unicode::append/utf8-utf32/ascii", &utf8_to_utf32<ascii_corpus>) &&
+		Benchmark::add("Unicode::append/utf8-utf32/cjk", &utf8_to_utf32<cjk_corpus>) &&
+		Benchmark::add("Unicode::append/utf8-utf32/emoji", &utf8_to_utf32<emoji_corpus>) &&
+		Benchmark::add("Unicode::append/utf32-utf8/ascii", &utf32_to_utf8<ascii_corpus>) &&
+		Benchmark::add("Unicode::append/utf32-utf8/cjk", &utf32_to_utf8<cjk_corpus>) &&
+		Benchmark::add("Unicode::append/utf32-utf8/emoji", &utf32_to_utf8<emoji_corpus>) &&
+		Benchmark::add("Unicode::append/utf8-utf16/ascii", &utf8_to_utf16<ascii_corpus>) &&
+		Benchmark::add("Unicode::append/utf8-utf16/cjk", &utf8_to_utf16<cjk_corpus>) &&
+		Benchmark::add("Unicode::append/utf8-utf16/emoji", &utf8_to_utf16<emoji_corpus>);
+
+	// Atom ///////////////////////////////////////////////////////////////////////
+	UNICORE_BENCHMARK(atom_find, "Atom::find/hit")
+	{
+		List<String> names;
+		for (int i = 0; i < 1000; i++)
+		{
+			names.push_back(StringBuilder::format("benchmark_atom_{}", i));
+			UC_UNUSED const Atom atom(names.back());
+		}
+
+		Size index = 0;
+		while (state.loop())
+		{
+			const auto atom = Atom::find(names[index++ % names.size()]);
+			Benchmark::keep(atom);
+		}
+	}
+
+	// Strings with equal FNV-1a hash land in the same lookup bucket
+	// and must stay separate atoms
+	UNICORE_BENCHMARK(atom_find_collision, "Atom::find/collision")
+	{
+		constexpr StringView first = "atom_109219";
+		constexpr StringView second = "atom_1543100";
+		static_assert(HashString::calc(first) == HashString::calc(second));
+
+		const Atom first_atom(first);
+		// Benchmark runs several times, second can be interned already
+		const auto found = Atom::find(second);
+		Bool valid = !found.has_value() || found.value() != first_atom;
+
+		const Atom second_atom(second);
+		valid &= first_atom != second_atom &&
+			first_atom.str() == first && second_atom.str() == second &&
+			Atom(first) == first_atom && Atom(second) == second_atom;
+
+		Size index = 0;
+		while (state.loop())
+		{
+			const auto use_first = (index++ & 1) == 0;
+			const auto atom = Atom::find(use_first ? first : second);
+			valid &= atom.has_value() && atom.value() == (use_first ? first_atom : second_atom);
+			Benchmark::keep(atom);
+		}
+
+		if (!valid)
+			state.fail("Colliding strings were merged into one atom");
+	}
+
+	// Path ///////////////////////////////////////////////////////////////////////
+	UNICORE_BENCHMARK(path_join, "Path::operator/")
+	{
+		const Path base("assets/textures");
+		const StringView file("sprites/player.png");
+
+		while (state.loop())
+		{
+			const auto path = base / file;
+			Benchmark::keep(path);
+		}
+	}
+
+	UNICORE_BENCHMARK(path_parent, "Path::parent_path")
+	{
+		const Path path("assets/textures/sprites/player.png");
+
+		while (state.loop())
+		{
+			const auto parent = path.parent_path();
+			Benchmark::keep(parent);
+		}
+	}
+
+	UNICORE_BENCHMARK(path_lookup, "HashDictionary<Path>::find/1000")
+	{
+		HashDictionary<Path, Int> dictionary;
+		List<Path> paths;
+		for (int i = 0; i < 1000; i++)
+		{
+			paths.emplace_back(StringBuilder::format("assets/folder{}/file{}.png", i % 10, i));
+			dictionary.emplace(paths.back(), i);
+		}
+
+		Size index = 0;
+		while (state.loop())
+		{
+			const auto it = dictionary.find(paths[index++ % paths.size()]);
+			Benchmark::keep(it->second);
+		}
+	}
+
+	// StringBuilder //////////////////////////////////////////////////////////////
+	UNICORE_BENCHMARK(string_builder_append, "StringBuilder::append/numbers")
+	{
+		Int value = 0;
+		while (state.loop())
+		{
+			StringBuilder builder;
+			builder << "Frame " << value++ << " at " << Vector2f(1.5f, 2.5f) << ' ';
+			builder.append_float(3.14159, 3);
+			Benchmark::keep(builder);
+		}
+
+		if (state.allocations().count != 0)
+			state.fail("Number formatting allocated memory");
+	}
+
+	// Only allocation is returned String, text does not fit its SSO buffer
+	UNICORE_BENCHMARK(string_builder_format, "StringBuilder::format")
+	{
+		Int value = 0;
+		while (state.loop())
+		{
+			const auto text = StringBuilder::format("Loaded {} from {} in {} ms", value++, "player.png", 1.5f);
+			Benchmark::keep(text);
+		}
+
+		if (state.allocations().count > state.iterations())
+			state.fail("Formatting allocated more than result String");
+	}
+
+	UNICORE_BENCHMARK(string_builder_format_to, "StringBuilder::format_to/numbers")
+	{
+		Int value = 0;
+		StringBuilder builder;
+		Char buffer[64];
+		while (state.loop())
+		{
+			builder.clear();
+			StringBuilder::format_to(builder, "Frame {} at {} dt {}", value, Vector2f(1.5f, 2.5f), 0.016);
+			StringBuilder::format_to(buffer, sizeof(buffer), "Loaded {} in {} ms", value++, 1.5f);
+			Benchmark::keep(builder);
+			Benchmark::keep(buffer);
+		}
+
+		if (state.allocations().count != 0)
+			state.fail("Number formatting allocated memory");
+	}
+
+	// Event //////////////////////////////////////////////////////////////////////
+	UC_UNUSED static const Bool event_registered =
+		Benchmark::add("Event::invoke/1", &event_invoke<1>) &&
+		Benchmark::add("Event::invoke/8", &event_invoke<8>) &&
+		Benchmark::add("Event::invoke/64", &event_invoke<64>);
+
+	UNICORE_BENCHMARK(event_add_remove, "Event::add+remove")
+	{
+		Event<Int> event;
+		Listener listener;
+
+		while (state.loop())
+		{
+			const auto handle = event.add<&Listener::on_value>(&listener);
+			event.remove(handle);
+		}
+	}
+
+	// Variant ////////////////////////////////////////////////////////////////////
+	UNICORE_BENCHMARK(variant_copy, "Variant::copy/int+string")
+	{
+		const Variant a(42);
+		const Variant b(StringView("player_name"));
+
+		while (state.loop())
+		{
+			Variant copy_a = a;
+			Variant copy_b = b;
+			Benchmark::keep(copy_a);
+			Benchmark::keep(copy_b);
+		}
+	}
+
+	UNICORE_BENCHMARK(packed_variant_copy, "PackedVariant::copy/int+string")
+	{
+		const PackedVariant a(42);
+		const PackedVariant b(StringView("player_name"));
+
+		while (state.loop())
+		{
+			PackedVariant copy_a = a;
+			PackedVariant copy_b = b;
+			Benchmark::keep(copy_a);
+			Benchmark::keep(copy_b);
+		}
+	}
+
+	// Equal values built separately, strings are compared by content
+	UNICORE_BENCHMARK(variant_equals, "Variant::operator==/int+string")
+	{
+		const Variant a(42), b(42);
+		const Variant c(StringView("player_name")), d(StringView("player_name"));
+
+		while (state.loop())
+		{
+			Benchmark::keep(a == b);
+			Benchmark::keep(c == d);
+		}
+	}
+
+	UNICORE_BENCHMARK(packed_variant_equals, "PackedVariant::equals/int+string")
+	{
+		const PackedVariant a(42), b(42);
+		const PackedVariant c(StringView("player_name")), d(StringView("player_name"));
+
+		while (state.loop())
+		{
+			Benchmark::keep(a.equals(b));
+			Benchmark::keep(c.equals(d));
+		}
+	}
+
+	// Stored value against incoming one, as in remoteui attribute update
+	UNICORE_BENCHMARK(packed_variant_equals_variant, "PackedVariant::equals/Variant/int+string")
+	{
+		const PackedVariant a(42);
+		const PackedVariant c(StringView("player_name"));
+		const Variant b(42);
+		const Variant d(StringView("player_name"));
+
+		while (state.loop())
+		{
+			Benchmark::keep(a.equals(b));
+			Benchmark::keep(c.equals(d));
+		}
+	}
+
+	// Allocators /////////////////////////////////////////////////////////////////
+	UNICORE_BENCHMARK(list_push, "List::push_back/256")
+	{
+		while (state.loop())
+		{
+			List<Vector2f> points;
+			for (int i = 0; i < 256; i++)
+				points.emplace_back(static_cast<Float>(i), 0.f);
+			Benchmark::keep(points);
+		}
+	}
+
+	UNICORE_BENCHMARK(arena_list_push, "ArenaList::push_back/256")
+	{
+		while (state.loop())
+		{
+			ArenaScope scope;
+			ArenaList<Vector2f> points;
+			for (int i = 0; i < 256; i++)
+				points.emplace_back(static_cast<Float>(i), 0.f);
+			Benchmark::keep(points);
+		}
+	}
+
+	UNICORE_BENCHMARK(new_delete, "new+delete/64")
+	{
+		struct Item { UInt64 data[8]; };
+
+		Array<Item*, 64> items{};
+		while (state.loop())
+		{
+			for (auto& item : items)
+				item = new Item();
+			for (const auto item : items)
+				delete item;
+			Benchmark::keep(items);
+		}
+	}
+
+	UNICORE_BENCHMARK(pool_create_destroy, "PoolAllocator::create+destroy/64")
+	{
+		struct Item { UInt64 data[8]; };
+
+		PoolAllocator<Item> pool;
+		Array<Item*, 64> items{};
+		while (state.loop())
+		{
+			for (auto& item : items)
+				item = pool.create();
+			for (const auto item : items)
+				pool.destroy(item);
+			Benchmark::keep(items);
+		}
+	}
+
+	// FixedStepScheduler /////////////////////////////////////////////////////////
+	// Headless determinism check: 10k ticks of bouncing body with exact and
+	// with jittered frame times have to end in bitwise equal state.
+	namespace
+	{
+		constexpr UInt64 SimulationTicks = 10000;
+
+		struct SimulationBody
+		{
+			Vector2f position = Vector2f(100, 100);
+			Vector2f velocity = Vector2f(317, -211);
+
+			void step(Float delta)
+			{
+				position += velocity * delta;
+				if ((position.x < 0 && velocity.x < 0) || (position.x > 800 && velocity.x > 0))
+					velocity.x = -velocity.x;
+				if ((position.y < 0 && velocity.y < 0) || (position.y > 600 && velocity.y > 0))
+					velocity.y = -velocity.y;
+			}
+		};
+
+		// Frame times in 1..40 ms from seeded LCG, seed 0 gives exact steps
+		SimulationBody run_simulation(FixedStepScheduler& scheduler, UInt32 seed, TimeSpan& elapsed)
+		{
+			SimulationBody body;
+			const auto delta = static_cast<Float>(scheduler.step().total_seconds());
+
+			UInt64 ticks = 0;
+			elapsed = TimeSpanConst::Zero;
+			while (ticks < SimulationTicks)
+			{
+				auto frame = scheduler.step();
+				if (seed != 0)
+				{
+					seed = seed * 1664525u + 1013904223u;
+					frame = TimeSpan::from_microseconds(1000 + (seed >> 8) % 39000);
+				}
+
+				elapsed += frame;
+				const auto steps = scheduler.advance(frame);
+				for (unsigned i = 0; i < steps && ticks < SimulationTicks; i++, ticks++)
+					body.step(delta);
+			}
+
+			return body;
+		}
+	}
+
+	UNICORE_BENCHMARK(fixed_step_determinism, "FixedStepScheduler::advance/10k ticks")
+	{
+		FixedStepScheduler reference_scheduler;
+		TimeSpan reference_elapsed;
+		const auto reference = run_simulation(reference_scheduler, 0, reference_elapsed);
+
+		UInt32 seed = 1;
+		Bool valid = true;
+		while (state.loop())
+		{
+			FixedStepScheduler scheduler;
+			TimeSpan elapsed;
+			const auto body = run_simulation(scheduler, seed++, elapsed);
+
+			// Every nanosecond is either stepped, kept or dropped
+			const auto accounted = TimeSpan(scheduler.step().data() * static_cast<Int64>(scheduler.tick())) +
+				scheduler.accumulator() + scheduler.dropped();
+
+			valid &= std::memcmp(&body, &reference, sizeof(body)) == 0 &&
+				accounted == elapsed && scheduler.dropped() == TimeSpanConst::Zero;
+			Benchmark::keep(body);
+		}
+
+		// Long frame runs max_steps, rest of whole steps is dropped
+		FixedStepScheduler scheduler;
+		const auto steps = scheduler.advance(TimeSpan(scheduler.step().data() * 100));
+		valid &= steps == scheduler.max_steps() &&
+			scheduler.dropped() == TimeSpan(scheduler.step().data() * (100 - scheduler.max_steps()));
+
+		if (!valid)
+			state.fail("Fixed step simulation is not deterministic");
+	}
+
+	// JobSystem //////////////////////////////////////////////////////////////////
+	UNICORE_BENCHMARK(job_schedule_wait, "JobSystem::schedule+wait")
+	{
+		JobSystem jobs;
+		UInt64 counter = 0;
+
+		while (state.loop())
+		{
+			const auto handle = jobs.schedule([&counter] { counter++; });
+			jobs.wait(handle);
+		}
+
+		Benchmark::keep(counter);
+	}
+}
\ No newline at end of file
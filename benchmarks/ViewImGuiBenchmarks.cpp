@@ -0,0 +1,144 @@
+#include "Benchmark.hpp"
+#if defined(UNICORE_USE_REMOTEUI) && defined(UNICORE_USE_IMGUI)
+#include "unicore/io/Logger.hpp"
+#include "unicore/remoteui/Document.hpp"
+#include "unicore/remoteui/ViewImGui.hpp"
+#include "unicore/system/StringBuilder.hpp"
+
+namespace unicore
+{
+	namespace
+	{
+		constexpr int RowCount = 10000;
+
+		// Headless ImGui: no devices, fixed step, draw data is discarded
+		class NullLogger : public Logger
+		{
+		public:
+			void write(LogType type, const StringView text) override {}
+		};
+
+		class NullTime : public Time
+		{
+		public:
+			UC_NODISCARD const TimeSpan& elapsed() const override { return _elapsed; }
+			UC_NODISCARD const TimeSpan& delta() const override { return _delta; }
+
+		protected:
+			TimeSpan _elapsed = TimeSpanConst::Zero;
+			TimeSpan _delta = TimeSpan::from_milliseconds(16);
+		};
+
+		class NullMouseDevice : public MouseDevice
+		{
+		public:
+			UC_NODISCARD Bool button(uint8_t button) const override { return false; }
+			UC_NODISCARD const Vector2i& position() const override { return _value; }
+			UC_NODISCARD const Vector2i& wheel() const override { return _value; }
+
+		protected:
+			Vector2i _value = VectorConst2i::Zero;
+		};
+
+		class NullKeyboardDevice : public KeyboardDevice
+		{
+		public:
+			UC_NODISCARD Bool key(KeyCode code) const override { return false; }
+			UC_NODISCARD KeyModFlags mods() const override { return KeyModFlags::Zero; }
+			UC_NODISCARD const String32& text() const override { return _text; }
+
+		protected:
+			String32 _text;
+		};
+
+		class NullTouchDevice : public TouchDevice
+		{
+		public:
+			UC_NODISCARD const List<TouchFinger>& fingers() const override { return _fingers; }
+
+		protected:
+			List<TouchFinger> _fingers;
+		};
+
+		class NullInput : public Input
+		{
+		public:
+			NullInput() : _mouse(_mouse_device), _keyboard(_keyboard_device), _touch(_touch_device) {}
+
+			UC_NODISCARD const MouseDeviceState& mouse() const override { return _mouse; }
+			UC_NODISCARD const KeyboardDeviceState& keyboard() const override { return _keyboard; }
+			UC_NODISCARD const TouchDeviceState& touch() const override { return _touch; }
+
+		protected:
+			NullMouseDevice _mouse_device;
+			NullKeyboardDevice _keyboard_device;
+			NullTouchDevice _touch_device;
+
+			MouseDeviceState _mouse;
+			KeyboardDeviceState _keyboard;
+			TouchDeviceState _touch;
+		};
+
+		class NullImGuiRender : public ImGuiRender
+		{
+		public:
+			explicit NullImGuiRender(Logger& logger) : ImGuiRender(logger) {}
+
+			void begin_frame(ImGui::IO& io) override
+			{
+				io.DisplaySize = ImVec2(1280, 720);
+				io.DisplayFramebufferScale = ImVec2(1, 1);
+
+				// Font atlas is built without texture
+				if (!io.Fonts->IsBuilt())
+				{
+					unsigned char* pixels;
+					int width, height;
+					io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+				}
+			}
+
+			void render(const ImDrawData* data) override {}
+		};
+
+		// One list box with 10k text rows, only visible rows are rendered
+		void fill_list(remoteui::Document& document)
+		{
+			using namespace remoteui;
+
+			const auto list = document.create_group(GroupType::List,
+				{ { { Attribute::Width, 600 }, { Attribute::Height, 600 } } });
+			for (int i = 0; i < RowCount; i++)
+			{
+				document.create_visual(VisualType::Text,
+					{ { { Attribute::Text, StringBuilder::format("Row {}", i) } } }, list);
+			}
+		}
+	}
+
+	// ViewImGui //////////////////////////////////////////////////////////////////
+	UNICORE_BENCHMARK(view_imgui_render_list, "remoteui::ViewImGui::render/list/10k")
+	{
+		NullLogger logger;
+		NullTime time;
+		NullInput input;
+		NullImGuiRender render(logger);
+		ImGuiContext context(render, time, input, logger);
+
+		const auto document = std::make_shared<remoteui::Document>();
+		fill_list(*document);
+
+		remoteui::ViewImGui view(context, logger);
+		view.set_size(Vector2f(640, 680));
+		view.set_document(document);
+
+		while (state.loop())
+		{
+			context.frame_begin();
+			view.render();
+			context.frame_end();
+			Benchmark::keep(view);
+		}
+	}
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,152 @@
+// Micro-benchmarks of core hot paths
+// usage: unicore_benchmarks [--filter TEXT] [--json FILE]
+//   [--min-time MS] [--warmup MS] [--list]
+#include "Benchmark.hpp"
+#include "unicore/system/StringBuilder.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <thread>
+
+using namespace unicore;
+
+static void append_json_string(StringBuilder& builder, StringView text)
+{
+	builder << '"';
+	for (const auto c : text)
+	{
+		if (c == '"' || c == '\\')
+			builder << '\\';
+		builder << c;
+	}
+	builder << '"';
+}
+
+// One benchmark per line, so files of two commits can be compared with diff
+static bool write_json(const char* path, const List<BenchmarkResult>& results)
+{
+	StringBuilder builder;
+	builder << "{\n";
+#if defined(UNICORE_DEBUG)
+	builder << "\"build\": \"debug\",\n";
+#else
+	builder << "\"build\": \"release\",\n";
+#endif
+	builder << "\"threads\": " << std::thread::hardware_concurrency() << ",\n";
+	builder << "\"benchmarks\": [\n";
+
+	for (Size i = 0; i < results.size(); i++)
+	{
+		const auto& result = results[i];
+		builder << "{\"name\": ";
+		append_json_string(builder, result.name);
+		builder << ", \"iterations\": " << result.iterations << ", \"ns_per_op\": ";
+		builder.append_float(result.ns_per_op, 2);
+		builder << ", \"bytes_per_op\": ";
+		builder.append_float(result.bytes_per_op, 2);
+		builder << ", \"allocs_per_op\": ";
+		builder.append_float(result.allocs_per_op, 2);
+		if (!result.counters.empty())
+		{
+			builder << ", \"counters\": {";
+			for (Size j = 0; j < result.counters.size(); j++)
+			{
+				if (j > 0)
+					builder << ", ";
+				append_json_string(builder, result.counters[j].name);
+				builder << ": ";
+				builder.append_float(result.counters[j].value, 2);
+			}
+			builder << '}';
+		}
+		if (!result.error.empty())
+		{
+			builder << ", \"error\": ";
+			append_json_string(builder, result.error);
+		}
+		builder << (i + 1 < results.size() ? "},\n" : "}\n");
+	}
+
+	builder << "]\n}\n";
+
+	std::ofstream stream(path, std::ios::binary);
+	stream.write(builder.c_str(), static_cast<std::streamsize>(builder.size()));
+	return static_cast<bool>(stream);
+}
+
+int main(int argc, char* argv[])
+{
+	BenchmarkSettings settings;
+	const char* json_path = nullptr;
+	bool list = false;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const StringView arg(argv[i]);
+		const bool has_value = i + 1 < argc;
+
+		if (arg == "--filter" && has_value)
+			settings.filter = argv[++i];
+		else if (arg == "--json" && has_value)
+			json_path = argv[++i];
+		else if (arg == "--min-time" && has_value)
+			settings.min_time = TimeSpan::from_milliseconds(std::atoi(argv[++i]));
+		else if (arg == "--warmup" && has_value)
+			settings.warmup = TimeSpan::from_milliseconds(std::atoi(argv[++i]));
+		else if (arg == "--list")
+			list = true;
+		else
+		{
+			std::fprintf(stderr, "usage: unicore_benchmarks [--filter TEXT] [--json FILE] "
+				"[--min-time MS] [--warmup MS] [--list]\n");
+			return 1;
+		}
+	}
+
+	List<BenchmarkResult> results;
+	bool failed = false;
+	if (!list)
+	{
+		std::printf("%-48s %12s %14s %12s %10s\n",
+			"Benchmark", "Iterations", "ns/op", "B/op", "allocs/op");
+	}
+
+	for (const auto& info : Benchmark::get_all())
+	{
+		if (!settings.filter.empty() && StringView(info.name).find(settings.filter) == StringView::npos)
+			continue;
+
+		if (list)
+		{
+			std::printf("%s\n", info.name);
+			continue;
+		}
+
+		const auto result = Benchmark::run(info, settings);
+		if (result.error.empty())
+		{
+			std::printf("%-48s %12llu %14.2f %12.2f %10.2f\n", result.name.c_str(),
+				static_cast<unsigned long long>(result.iterations),
+				result.ns_per_op, result.bytes_per_op, result.allocs_per_op);
+
+			for (const auto& counter : result.counters)
+				std::printf("    %s = %.2f\n", counter.name.c_str(), counter.value);
+		}
+		else
+		{
+			std::printf("%-48s FAILED: %s\n", result.name.c_str(), result.error.c_str());
+			failed = true;
+		}
+		std::fflush(stdout);
+
+		results.push_back(result);
+	}
+
+	if (json_path && !write_json(json_path, results))
+	{
+		std::fprintf(stderr, "Failed to write %s\n", json_path);
+		return 1;
+	}
+
+	return failed ? 1 : 0;
+}
\ No newline at end of file
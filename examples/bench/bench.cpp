@@ -0,0 +1,393 @@
+#include "bench.hpp"
+#include "UnicoreMain.hpp"
+#include "InitPlugins.hpp"
+#include "unicore/io/FileProvider.hpp"
+#include "unicore/io/FileLoader.hpp"
+#include "unicore/io/FileSystem.hpp"
+#include "unicore/io/File.hpp"
+#include "unicore/renderer/Surface.hpp"
+#include "unicore/renderer/Font.hpp"
+#include "unicore/system/StringBuilder.hpp"
+#if defined(UNICORE_USE_STB_IMAGE_WRITE)
+#include "unicore/stb/StbSurfaceWriter.hpp"
+#endif
+#include <cstdlib>
+
+namespace unicore
+{
+	static constexpr Vector2i ScreenSize = Vector2i(800, 600);
+	static constexpr TimeSpan FrameDelta = TimeSpan::from_microseconds(16667);
+
+	static Double to_milliseconds(const TimeSpan& time)
+	{
+		return static_cast<Double>(time.data().count()) / 1000000.0;
+	}
+
+	BenchApp::BenchApp(const CoreSettings& settings)
+		: SDLApplication(create_settings(settings, "Bench",
+			{ false, ScreenSize, DisplayWindowFlag::Headless }))
+		, _time(FrameDelta)
+		, _fixed_step(FrameDelta)
+		, _ui_logger("[UI] ", logger)
+		, _ui_render(renderer, _ui_logger)
+		, _ui_context(_ui_render, _time, input, _ui_logger)
+	{
+		init_plugins(*this);
+	}
+
+	void BenchApp::on_init()
+	{
+		if (!parse_args())
+		{
+			quit(2);
+			return;
+		}
+
+		if (_settings.latency > 0)
+		{
+			// Examples are loaded and captured on main thread
+			if (!_settings.example.has_value() ||
+				_settings.dump_path.has_value() || _settings.compare_path.has_value())
+			{
+				UC_LOG_ERROR(logger) << "--latency needs --example and no --dump or --compare";
+				quit(2);
+				return;
+			}
+
+			set_frame_latency(_settings.latency);
+		}
+
+		_archive = resources.load<ReadFileProvider>("negative.7z"_path);
+		if (_archive)
+			resources.add_loader(std::make_shared<ReadFileLoader>(*_archive));
+
+		_font = resources.load<Font>("ubuntu.regular.ttf"_path);
+
+		_ui_render.init(renderer);
+
+		frame_stats.set_capacity(_settings.frames);
+		_screen = std::make_shared<DynamicSurface>(renderer.screen_size());
+
+		const auto& examples = ExampleCatalog::get_all();
+		const auto first = _settings.example.value_or(0);
+		if (first >= examples.size())
+		{
+			UC_LOG_ERROR(logger) << "Invalid example index " << first;
+			quit(2);
+			return;
+		}
+
+		UC_LOG_INFO(logger) << "Running " << _settings.frames << " frames at "
+			<< renderer.screen_size() << ", latency " << static_cast<UInt32>(frame_latency());
+
+		if (!start_example(first))
+			quit(1);
+	}
+
+	void BenchApp::on_update()
+	{
+		if (!_example || _finished)
+			return;
+
+		if (_frame == _settings.warmup + _settings.frames && frame_latency() > 0)
+		{
+			// Update runs on worker, example can still be drawn
+			_finished = true;
+			jobs.schedule_main([this]
+			{
+				finish_example();
+				_example = nullptr;
+				quit(_failed > 0 ? 1 : 0);
+			});
+			return;
+		}
+
+		if (_frame == _settings.warmup + _settings.frames)
+		{
+			finish_example();
+
+			const auto next = _example_index + 1;
+			if (_settings.example.has_value() || next >= ExampleCatalog::get_all().size())
+			{
+				_example = nullptr;
+				quit(_failed > 0 ? 1 : 0);
+				return;
+			}
+
+			if (!start_example(next))
+			{
+				quit(1);
+				return;
+			}
+		}
+
+		// Stats of warmup frames are dropped
+		if (_frame == _settings.warmup)
+			frame_stats.clear();
+
+		_time.update();
+		const auto steps = _fixed_step.advance(_time.delta());
+		for (unsigned i = 0; i < steps; i++)
+			_example->fixed_update(_fixed_step.step());
+
+		_ui_context.frame_begin();
+		_example->update();
+		_ui_context.frame_end();
+
+		_frame++;
+	}
+
+	void BenchApp::on_draw()
+	{
+		renderer.clear(ColorConst4b::Black);
+
+		if (_example)
+			_example->draw();
+
+		// ImGui frame is built by update on worker at the same time
+		if (frame_latency() == 0)
+			_ui_context.render();
+
+		if (capture_frame())
+			renderer.read_pixels(*_screen);
+	}
+
+	Bool BenchApp::parse_args()
+	{
+		const auto parse_uint = [this](const String& value, UInt32& result)
+		{
+			char* end = nullptr;
+			const auto number = std::strtoul(value.c_str(), &end, 10);
+			if (value.empty() || *end != 0)
+			{
+				UC_LOG_ERROR(logger) << "Invalid number " << value;
+				return false;
+			}
+
+			result = static_cast<UInt32>(number);
+			return true;
+		};
+
+		for (size_t i = 0; i < args.size(); i++)
+		{
+			const auto& name = args[i];
+			if (i + 1 >= args.size())
+			{
+				UC_LOG_ERROR(logger) << "Missing value of " << name;
+				return false;
+			}
+
+			const auto& value = args[++i];
+			UInt32 number = 0;
+
+			if (name == "--frames")
+			{
+				if (!parse_uint(value, number) || number == 0)
+					return false;
+				_settings.frames = number;
+			}
+			else if (name == "--warmup")
+			{
+				if (!parse_uint(value, number))
+					return false;
+				_settings.warmup = number;
+			}
+			else if (name == "--example")
+			{
+				if (!parse_uint(value, number))
+					return false;
+				_settings.example = number;
+			}
+			else if (name == "--tolerance")
+			{
+				if (!parse_uint(value, number))
+					return false;
+				_settings.tolerance = static_cast<UInt8>(Math::min(number, 255u));
+			}
+			else if (name == "--latency")
+			{
+				if (!parse_uint(value, number) || number > MaxFrameLatency)
+				{
+					UC_LOG_ERROR(logger) << "Latency has to be 0.." << static_cast<UInt32>(MaxFrameLatency);
+					return false;
+				}
+				_settings.latency = static_cast<UInt8>(number);
+			}
+			else if (name == "--spawn")
+			{
+				if (!parse_uint(value, number))
+					return false;
+				_settings.spawn = number;
+			}
+			else if (name == "--dump")
+				_settings.dump_path = Path(value);
+			else if (name == "--compare")
+				_settings.compare_path = Path(value);
+			else if (name == "--csv")
+				_settings.csv_path = Path(value);
+			else
+			{
+				UC_LOG_ERROR(logger) << "Unknown argument " << name;
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	Bool BenchApp::capture_frame() const
+	{
+		// Frame is not read without capture, update can change it on worker
+		return (_settings.dump_path.has_value() || _settings.compare_path.has_value()) &&
+			_frame == _settings.warmup + _settings.frames;
+	}
+
+	Bool BenchApp::start_example(UInt32 index)
+	{
+		const auto& info = ExampleCatalog::get_all()[index];
+
+		// Same input for every run
+		_time.reset();
+		_random.set_seed(index);
+		_fixed_step.reset();
+		frame_stats.clear();
+		_frame = 0;
+
+		_example_index = index;
+		_example = info.factory({ logger, _random, _time, input, renderer, platform, _font, _ui_context, _fixed_step, *this });
+		if (!_example)
+		{
+			UC_LOG_ERROR(logger) << "Failed to create example " << info.title;
+			return false;
+		}
+
+		_example->load(resources);
+		if (_settings.spawn > 0)
+			_example->spawn(_settings.spawn);
+		return true;
+	}
+
+	void BenchApp::finish_example()
+	{
+		const auto& info = ExampleCatalog::get_all()[_example_index];
+		report_stats(info.title);
+
+		const auto name = StringBuilder::format("example{}", _example_index + 1);
+
+		if (_settings.csv_path.has_value())
+		{
+			const auto path = _settings.csv_path.value() / (name + ".csv");
+			if (!frame_stats.write_csv(file_system, path))
+				UC_LOG_ERROR(logger) << "Failed to write " << path;
+		}
+
+		check_frame(Path(name + ".png"));
+	}
+
+	void BenchApp::report_stats(StringView title) const
+	{
+		const auto frame = frame_stats.summary(&FrameSample::frame);
+		const auto update = frame_stats.summary(&FrameSample::update);
+		const auto draw = frame_stats.summary(&FrameSample::draw);
+
+		RendererStats render;
+		for (UInt32 i = 0; i < frame_stats.size(); i++)
+		{
+			const auto& stats = frame_stats.get(i).render;
+			render.draw_calls += stats.draw_calls;
+			render.vertices += stats.vertices;
+			render.texture_switches += stats.texture_switches;
+		}
+
+		const auto count = Math::max(frame_stats.size(), 1u);
+
+		StringBuilder builder;
+		builder << title << ": frame ms avg ";
+		builder.append_float(to_milliseconds(frame.avg), 3);
+		builder << " p50 ";
+		builder.append_float(to_milliseconds(frame.p50), 3);
+		builder << " p95 ";
+		builder.append_float(to_milliseconds(frame.p95), 3);
+		builder << " p99 ";
+		builder.append_float(to_milliseconds(frame.p99), 3);
+		builder << " max ";
+		builder.append_float(to_milliseconds(frame.max), 3);
+		builder << ", update avg ";
+		builder.append_float(to_milliseconds(update.avg), 3);
+		builder << ", draw avg ";
+		builder.append_float(to_milliseconds(draw.avg), 3);
+		builder << ", per frame: draw calls " << render.draw_calls / count
+			<< ", vertices " << render.vertices / count
+			<< ", texture switches " << render.texture_switches / count;
+
+		UC_LOG_INFO(logger) << builder;
+	}
+
+	void BenchApp::check_frame(const Path& name)
+	{
+		if (_settings.dump_path.has_value())
+		{
+			const auto path = _settings.dump_path.value() / name;
+#if defined(UNICORE_USE_STB_IMAGE_WRITE)
+			const auto file = file_system.create_new(path);
+			if (file && StbSurfaceWriter::write_png(*file, *_screen))
+				UC_LOG_INFO(logger) << "Saved " << path;
+			else UC_LOG_ERROR(logger) << "Failed to write " << path;
+#else
+			UC_LOG_ERROR(logger) << "PNG writer is not available";
+#endif
+		}
+
+		if (_settings.compare_path.has_value())
+		{
+			const auto path = _settings.compare_path.value() / name;
+			const auto golden = resources.load<Surface>(path);
+			if (!golden)
+			{
+				UC_LOG_ERROR(logger) << "Failed to load " << path;
+				_failed++;
+				return;
+			}
+
+			if (golden->size() != _screen->size())
+			{
+				UC_LOG_ERROR(logger) << "Size mismatch " << path << " "
+					<< golden->size() << " != " << _screen->size();
+				_failed++;
+				return;
+			}
+
+			UInt32 mismatch = 0;
+			Color4b a, b;
+			const auto& size = _screen->size();
+			for (int y = 0; y < size.y; y++)
+			{
+				for (int x = 0; x < size.x; x++)
+				{
+					if (!golden->get(x, y, a) || !_screen->get(x, y, b))
+						continue;
+
+					if (Math::abs(a.r - b.r) > _settings.tolerance ||
+						Math::abs(a.g - b.g) > _settings.tolerance ||
+						Math::abs(a.b - b.b) > _settings.tolerance ||
+						Math::abs(a.a - b.a) > _settings.tolerance)
+						mismatch++;
+				}
+			}
+
+			if (mismatch > 0)
+			{
+				UC_LOG_ERROR(logger) << "Frame differs from " << path << " in " << mismatch << " pixels";
+				_failed++;
+			}
+		}
+	}
+
+	void BenchApp::quit(int exit_code)
+	{
+		_exit_code = exit_code;
+		platform.looper.quit();
+	}
+
+	UNICORE_MAIN_CORE(BenchApp);
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+#pragma once
+#include "unicore/app/SDLApplication.hpp"
+#include "unicore/platform/Time.hpp"
+#include "unicore/io/Path.hpp"
+#include "unicore/imgui/ImGuiContext.hpp"
+#include "unicore/imgui/ImGuiRender.hpp"
+#include "example.hpp"
+
+namespace unicore
+{
+	class ReadFileProvider;
+	class DynamicSurface;
+
+	// Advances by fixed delta every frame,
+	// so examples draw same frames on every run
+	class BenchTime : public Time
+	{
+		UC_OBJECT(BenchTime, Time)
+	public:
+		explicit BenchTime(const TimeSpan& delta)
+			: _delta(delta) {}
+
+		UC_NODISCARD const TimeSpan& elapsed() const override { return _elapsed; }
+		UC_NODISCARD const TimeSpan& delta() const override { return _delta; }
+
+		void update() { _elapsed += _delta; }
+		void reset() { _elapsed = TimeSpanConst::Zero; }
+
+	protected:
+		TimeSpan _delta;
+		TimeSpan _elapsed = TimeSpanConst::Zero;
+	};
+
+	struct BenchSettings
+	{
+		UInt32 frames = 300;
+		// Frames before measurement, not included in stats
+		UInt32 warmup = 10;
+		Optional<UInt32> example;
+		// Write last frame of every example as PNG
+		Optional<Path> dump_path;
+		// Compare last frame with PNG written by dump
+		Optional<Path> compare_path;
+		// Write FrameStats of every example as CSV
+		Optional<Path> csv_path;
+		// Max channel difference for compare
+		UInt8 tolerance = 2;
+		// Frames between update and draw, 0 - serial loop
+		UInt8 latency = 0;
+		// Objects added to stress examples after load
+		UInt32 spawn = 0;
+	};
+
+	// Runs testbed examples for a number of frames with headless renderer,
+	// reports FrameStats of each and checks frames against golden images.
+	// With latency update runs on worker while previous frame is drawn,
+	// only one example can run and frames are not captured.
+	// Usage: unicore_bench [--frames N] [--warmup N] [--example N]
+	//   [--dump DIR] [--compare DIR] [--csv DIR] [--tolerance N]
+	//   [--latency N] [--spawn N]
+	class BenchApp : public SDLApplication
+	{
+	public:
+		explicit BenchApp(const CoreSettings& settings);
+
+	protected:
+		BenchSettings _settings;
+		BenchTime _time;
+		SeededRandom _random;
+		FixedStepScheduler _fixed_step;
+
+		Shared<Font> _font;
+		Shared<ReadFileProvider> _archive;
+
+		ProxyLogger _ui_logger;
+		ImGuiRender2D _ui_render;
+		ImGuiContext _ui_context;
+
+		Unique<Example> _example;
+		UInt32 _example_index = 0;
+		UInt32 _frame = 0;
+		UInt32 _failed = 0;
+		Bool _finished = false;
+
+		Shared<DynamicSurface> _screen;
+
+		void on_init() override;
+		void on_update() override;
+		void on_draw() override;
+
+		Bool parse_args();
+		UC_NODISCARD Bool capture_frame() const;
+
+		Bool start_example(UInt32 index);
+		void finish_example();
+		void report_stats(StringView title) const;
+		void check_frame(const Path& name);
+
+		void quit(int exit_code);
+	};
+}
\ No newline at end of file
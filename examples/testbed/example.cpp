@@ -11,5 +11,7 @@ namespace unicore
 		, input(context.input)
 		, renderer(context.renderer)
 		, platform(context.platform)
+		, fixed_step(context.fixed_step)
+		, app(context.app)
 	{}
 }
\ No newline at end of file
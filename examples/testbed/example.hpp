@@ -13,6 +13,9 @@ namespace unicore
 	class Input;
 	class IResourceCache;
 	class ImGuiContext;
+	class FixedStepScheduler;
+	class TimeSpan;
+	class RendererApplication;
 
 	class Font;
 
@@ -26,6 +29,8 @@ namespace unicore
 		Platform& platform;
 		Shared<Font> font;
 		ImGuiContext& imgui;
+		const FixedStepScheduler& fixed_step;
+		const RendererApplication& app;
 	};
 
 	class Example : public Object
@@ -37,13 +42,19 @@ namespace unicore
 		Input& input;
 		sdl2::Pipeline& renderer;
 		Platform& platform;
+		const FixedStepScheduler& fixed_step;
+		const RendererApplication& app;
 
 		explicit Example(const ExampleContext& context);
 
 		virtual void load(IResourceCache& resources) {}
+		virtual void fixed_update(const TimeSpan& step) {}
 		virtual void update() = 0;
 		virtual void draw() const = 0;
 
+		// Adds count of objects to stress examples
+		virtual void spawn(UInt32 count) {}
+
 		virtual void get_text(List<String32>& lines) {}
 		virtual void get_comment(String32& comment) {}
 
@@ -1,5 +1,6 @@
 #include "example02.hpp"
 #include "unicore/system/StringBuilder.hpp"
+#include "unicore/system/FixedStepScheduler.hpp"
 #include "unicore/resource/ResourceCache.hpp"
 #include "unicore/platform/Time.hpp"
 #include "unicore/platform/Input.hpp"
@@ -13,6 +14,9 @@ namespace unicore
 
 	void Entity::update(const Vector2i& size, float delta)
 	{
+		prev_center = center;
+		prev_angle = angle;
+
 		center += velocity * delta;
 
 		if (
@@ -31,8 +35,16 @@ namespace unicore
 		angle += angle_speed * delta;
 	}
 
+	Transform2f Entity::interpolate(float alpha) const
+	{
+		return Transform2f::lerp(
+			{ prev_center, prev_angle, scale },
+			{ center, angle, scale }, alpha);
+	}
+
 	Example02::Example02(const ExampleContext& context)
 		: Example(context)
+		, _sprite_batch(context.app)
 	{
 	}
 
@@ -50,6 +62,14 @@ namespace unicore
 #endif
 	}
 
+	void Example02::fixed_update(const TimeSpan& step)
+	{
+		const auto& screen_size = app.update_screen_size();
+		const auto delta = static_cast<float>(step.total_seconds());
+		for (auto& entity : _entites)
+			entity.update(screen_size, delta);
+	}
+
 	void Example02::update()
 	{
 		// SPAWN ENTITIES ////////////////////////////////////////////////////////////
@@ -65,26 +85,32 @@ namespace unicore
 		}
 		else _add_time = TimeSpanConst::Zero;
 
-		// UPDATE ENTITIES ///////////////////////////////////////////////////////////
-		auto& screen_size = renderer.screen_size();
-		const auto delta = static_cast<float>(time.delta().total_seconds());
-		for (auto& entity : _entites)
-			entity.update(screen_size, delta);
-
 		// UPDATE SPRITE BATCH /////////////////////////////////////////////////////
-		auto& size = renderer.screen_size();
-		_sprite_batch.clear();
+		// Entities are moved in fixed_update, draw state between last two steps
+		auto& size = app.update_screen_size();
+		const auto alpha = fixed_step.alpha();
+		auto& sprite_batch = _sprite_batch.update();
+		sprite_batch.clear();
 
 		for (const auto& entity : _entites)
-			_sprite_batch.draw(_tex, entity.center, entity.angle, entity.scale, entity.color);
-		_sprite_batch.draw(_tex, { static_cast<float>(size.x) - 32, 32 });
+		{
+			const auto tr = entity.interpolate(alpha);
+			sprite_batch.draw(_tex, tr.move, tr.angle, tr.scale, entity.color);
+		}
+		sprite_batch.draw(_tex, { static_cast<float>(size.x) - 32, 32 });
 
-		_sprite_batch.flush();
+		sprite_batch.flush();
 	}
 
 	void Example02::draw() const
 	{
-		_sprite_batch.render(renderer);
+		_sprite_batch.draw().render(renderer);
+	}
+
+	void Example02::spawn(UInt32 count)
+	{
+		if (_tex)
+			spawn_entities(count);
 	}
 
 	void Example02::get_text(List<String32>& lines)
@@ -119,6 +145,9 @@ namespace unicore
 		entity.angle = random.radians();
 		entity.angle_speed = Degrees(random.range(45.f, 300.f) * random.sign<float>());
 
+		entity.prev_center = entity.center;
+		entity.prev_angle = entity.angle;
+
 		_entites.push_back(entity);
 	}
 
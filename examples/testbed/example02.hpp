@@ -1,6 +1,8 @@
 #pragma once
 #include "example.hpp"
+#include "unicore/app/RendererApplication.hpp"
 #include "unicore/system/TimeSpan.hpp"
+#include "unicore/math/Transform2.hpp"
 #include "unicore/renderer/SpriteBatch.hpp"
 
 namespace unicore
@@ -18,7 +20,13 @@ namespace unicore
 
 		Color4b color;
 
+		// State before last fixed step
+		Vector2f prev_center;
+		Radians prev_angle;
+
 		void update(const Vector2i& size, float delta);
+
+		UC_NODISCARD Transform2f interpolate(float alpha) const;
 	};
 
 	class Example02 : public Example
@@ -27,9 +35,12 @@ namespace unicore
 		explicit Example02(const ExampleContext& context);
 
 		void load(IResourceCache& resources) override;
+		void fixed_update(const TimeSpan& step) override;
 		void update() override;
 		void draw() const override;
 
+		void spawn(UInt32 count) override;
+
 		void get_text(List<String32>& lines) override;
 		void get_comment(String32& comment) override;
 
@@ -38,7 +49,8 @@ namespace unicore
 	protected:
 		Shared<Texture> _tex;
 
-		SpriteBatch _sprite_batch;
+		// Filled by update, can be drawn while next frame is updated
+		FrameData<SpriteBatch> _sprite_batch;
 		List<Entity> _entites;
 
 		TimeSpan _add_time = TimeSpanConst::Zero;
@@ -46,4 +58,4 @@ namespace unicore
 		void spawn_entity(const Vector2f& position, const Vector2i& size);
 		void spawn_entities(unsigned count);
 	};
-}
+}
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "unicore/renderer/Surface.hpp"
 #include "unicore/renderer/Font.hpp"
 #include "unicore/io/FileLoader.hpp"
+#include "unicore/io/FileSystem.hpp"
 #include "unicore/remoteui/DocumentParseXML.hpp"
 
 namespace unicore
@@ -121,18 +122,58 @@ namespace unicore
 
 		_ui_context.frame_begin();
 
-		const auto fps_str = StringBuilder::format(U"FPS: {}", fps());
-		const auto draw_str = StringBuilder::format(U"Draw: {}", _draw_calls);
-		const auto screen_str = StringBuilder::format(U"Screen: {}", screen_size);
+#if defined(UNICORE_USE_PROFILER)
+		if (input.keyboard().down_changed(KeyCode::F1))
+			_show_profiler = !_show_profiler;
+
+		if (input.keyboard().down_changed(KeyCode::F2))
+		{
+			if (Profiler::write_chrome_trace(file_system, "trace.json"_path))
+				UC_LOG_INFO(logger) << "Profiler trace saved to trace.json";
+			else UC_LOG_ERROR(logger) << "Failed to save profiler trace";
+		}
+
+		if (_show_profiler)
+			_profiler.render(&_show_profiler);
+#endif
+
+		if (input.keyboard().down_changed(KeyCode::F3))
+			_show_frame_stats = !_show_frame_stats;
+
+		if (input.keyboard().down_changed(KeyCode::F4))
+		{
+			if (frame_stats.write_csv(file_system, "frame_stats.csv"_path))
+				UC_LOG_INFO(logger) << "Frame stats saved to frame_stats.csv";
+			else UC_LOG_ERROR(logger) << "Failed to save frame stats";
+		}
+
+		if (_show_frame_stats)
+			_frame_stats_view.render(frame_stats, &_show_frame_stats);
+
+		if (input.keyboard().down_changed(KeyCode::F5))
+			_show_memory = !_show_memory;
+
+		if (_show_memory)
+			_memory_view.render(&resources, &_show_memory);
+
+		_stats_batch.clear();
+		_stats_graph.draw(_stats_batch, frame_stats,
+			Rectf(0, static_cast<Float>(screen_size.y) - 60, 200, 40));
+		_stats_batch.flush();
 
 		if (_font)
 		{
 			const float height = _font->get_height();
 
-			_sprite_batch
-				.print(_font, { 0, 0 }, fps_str)
-				.print(_font, { 0, height * 1 }, draw_str)
-				.print(_font, { 0, height * 2 }, screen_str);
+			StringBuilder::format_to(_text, U"FPS: {}", fps());
+			_sprite_batch.print(_font, { 0, 0 }, _text);
+
+			const auto render_stats = frame_stats.empty() ? RendererStats{} : frame_stats.last().render;
+			StringBuilder::format_to(_text, U"Draw: {}", render_stats.draw_calls);
+			_sprite_batch.print(_font, { 0, height * 1 }, _text);
+
+			StringBuilder::format_to(_text, U"Screen: {}", screen_size);
+			_sprite_batch.print(_font, { 0, height * 2 }, _text);
 		}
 
 		// EXAMPLE ////////////////////////////////////////////////////////////
@@ -141,7 +182,6 @@ namespace unicore
 			_example->update();
 
 			const auto& example_info = examples[_example_index];
-			const auto title_str = StringBuilder::format(U"Example: {}", example_info.title);
 
 			_lines.clear();
 			_example->get_text(_lines);
@@ -153,8 +193,8 @@ namespace unicore
 			{
 				const float height = _font->get_height();
 
-				_sprite_batch
-					.print(_font, { 250, 0 }, title_str);
+				StringBuilder::format_to(_text, U"Example: {}", example_info.title);
+				_sprite_batch.print(_font, { 250, 0 }, _text);
 
 				for (unsigned i = 0; i < _lines.size(); i++)
 				{
@@ -176,6 +216,12 @@ namespace unicore
 		_ui_context.frame_end();
 	}
 
+	void MyApp::on_fixed_update(const TimeSpan& step)
+	{
+		if (_example)
+			_example->fixed_update(step);
+	}
+
 	void MyApp::on_draw()
 	{
 		renderer.clear(ColorConst4b::Black);
@@ -184,10 +230,9 @@ namespace unicore
 			_example->draw();
 
 		_sprite_batch.render(renderer);
+		_stats_batch.render(renderer);
 
 		_ui_context.render();
-
-		_draw_calls = renderer.draw_calls();
 	}
 
 	void MyApp::on_drop_file(const Path& path)
@@ -204,7 +249,7 @@ namespace unicore
 		{
 			auto& info = ExampleCatalog::get_all()[index];
 
-			auto example = info.factory({ logger, _random, time, input, renderer, platform, _font, _ui_context });
+			auto example = info.factory({ logger, _random, time, input, renderer, platform, _font, _ui_context, fixed_step, *this });
 			if (!example)
 			{
 				UC_LOG_ERROR(logger) << "Failed to create example " << info.title << ":" << index;
@@ -1,8 +1,13 @@
 #pragma once
 #include "unicore/app/SDLApplication.hpp"
 #include "unicore/renderer/SpriteBatch.hpp"
+#include "unicore/renderer/PrimitiveBatch.hpp"
+#include "unicore/renderer/FrameStatsGraph.hpp"
 #include "unicore/imgui/ImGuiContext.hpp"
 #include "unicore/imgui/ImGuiRender.hpp"
+#include "unicore/imgui/ImGuiProfiler.hpp"
+#include "unicore/imgui/ImGuiFrameStats.hpp"
+#include "unicore/imgui/ImGuiMemoryStats.hpp"
 #include "unicore/remoteui/Document.hpp"
 #include "unicore/remoteui/ViewImGui.hpp"
 #include "example.hpp"
@@ -25,20 +30,29 @@ namespace unicore
 		SpriteBatch _sprite_batch;
 		DefaultRandom _random;
 
-		uint32_t _draw_calls = 0;
+		PrimitiveBatch _stats_batch;
+		FrameStatsGraph _stats_graph;
 
 		List<String32> _lines;
+		String32 _text;
 
 		ProxyLogger _ui_logger;
 
 		ImGuiRender2D _ui_render;
 		ImGuiContext _ui_context;
+		ImGuiProfiler _profiler;
+		bool _show_profiler = false;
+		ImGuiFrameStats _frame_stats_view;
+		bool _show_frame_stats = false;
+		ImGuiMemoryStats _memory_view;
+		bool _show_memory = false;
 
 		Shared<remoteui::Document> _ui_document;
 		Shared<remoteui::ViewImGui> _ui_view;
 
 		void on_init() override;
 		void on_update() override;
+		void on_fixed_update(const TimeSpan& step) override;
 		void on_draw() override;
 
 		void on_drop_file(const Path& path) override;
@@ -5,6 +5,7 @@
 #include <vector>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <any>
 #include <bitset>
 #include <string>
@@ -71,6 +72,14 @@ static_assert(false, "Unknown platform");
 #	define UNICORE_RELEASE
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define UNICORE_CPU_SSE2
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#	define UNICORE_CPU_NEON
+#endif
+
 namespace unicore
 {
 	using namespace std::string_literals;
@@ -204,6 +213,9 @@ namespace unicore
 	template<typename TKey, typename TValue, class Sort = comparison::Less<TKey>>
 	using DictionaryMulti = std::multimap<TKey, TValue, Sort>;
 
+	template<typename TKey, typename TValue, class Hash = std::hash<TKey>>
+	using HashDictionary = std::unordered_map<TKey, TValue, Hash>;
+
 	template<typename T>
 	using BasicString = std::basic_string<T>;
 	using String = BasicString<Char>;
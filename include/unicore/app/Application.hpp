@@ -1,5 +1,7 @@
 #pragma once
 #include "unicore/platform/Platform.hpp"
+#include "unicore/system/JobSystem.hpp"
+#include "unicore/system/FixedStepScheduler.hpp"
 
 namespace unicore
 {
@@ -8,6 +10,8 @@ namespace unicore
 	struct CoreSettings
 	{
 		Platform& platform;
+		// Command line arguments without program name
+		List<String> args = {};
 	};
 
 	class Application
@@ -23,6 +27,12 @@ namespace unicore
 		Input& input;
 		FileSystem& file_system;
 		ResourceCache& resources;
+		JobSystem jobs;
+		FixedStepScheduler fixed_step;
+		const List<String> args;
+
+		// Returned from main after looper is stopped
+		UC_NODISCARD int exit_code() const { return _exit_code; }
 
 		virtual void init();
 		virtual void update();
@@ -37,12 +47,20 @@ namespace unicore
 		}
 
 	protected:
+		// Updates platform state, returns true when on_update is required
+		Bool update_platform();
+		// Calls on_fixed_update for pending fixed steps, then on_update
+		void update_simulation();
+
 		virtual void on_init() = 0;
 		virtual void on_update() = 0;
+		virtual void on_fixed_update(const TimeSpan& step) {}
 
 		virtual void on_drop_file(const Path& path) {}
 
 		ModuleContainer _modules;
+		unsigned _fixed_steps = 0;
+		int _exit_code = 0;
 
 	private:
 		List<Unique<Plugin>> _plugins;
@@ -1,8 +1,8 @@
 #pragma once
 #include "unicore/app/DisplayApplication.hpp"
 #include "unicore/system/TimeSpan.hpp"
-#include "unicore/renderer/FPSCounter.hpp"
-#include "unicore/renderer/Renderer.hpp"
+#include "unicore/system/Timer.hpp"
+#include "unicore/renderer/FrameStats.hpp"
 
 namespace unicore
 {
@@ -13,10 +13,30 @@ namespace unicore
 		using RendererFactory = std::function<Renderer& (Logger& logger, Display& display)>;
 
 		Renderer& renderer;
+		FrameStats frame_stats;
+
+		static constexpr UInt8 MaxFrameLatency = 2;
 
 		explicit RendererApplication(const DisplayCoreSettings& settings, const RendererFactory& renderer_factory);
 
-		UC_NODISCARD constexpr int fps() const { return _fps_counter.current(); }
+		// Average over frame_stats window
+		UC_NODISCARD int fps() const;
+
+		// 0 - on_update and on_draw are called one after another (default).
+		// 1..MaxFrameLatency - on_update runs on JobSystem worker while
+		// main thread draws frame that was updated latency frames ago.
+		// Data shared by update and draw has to be kept in FrameData,
+		// main thread only work from on_update goes to jobs.schedule_main.
+		void set_frame_latency(UInt8 latency);
+		UC_NODISCARD constexpr UInt8 frame_latency() const { return _frame_latency; }
+
+		// Slot of FrameData written by on_update and read by on_draw
+		UC_NODISCARD constexpr UInt8 update_slot() const { return _update_slot; }
+		UC_NODISCARD constexpr UInt8 draw_slot() const { return _draw_slot; }
+
+		// Screen size copied on main thread before on_update starts,
+		// read it instead of renderer.screen_size() from on_update
+		UC_NODISCARD const Vector2i& update_screen_size() const { return _screen_size[_update_slot]; }
 
 		void update() override;
 
@@ -24,9 +44,41 @@ namespace unicore
 		virtual void frame();
 
 	protected:
-		FPSCounter _fps_counter;
+		FrameSample _frame_sample;
+		Optional<Timer> _frame_start;
+
+		UInt8 _frame_latency = 0;
+		UInt8 _update_slot = 0;
+		UInt8 _draw_slot = 0;
+		UInt64 _update_count = 0;
+		Array<Vector2i, MaxFrameLatency + 1> _screen_size;
 
 		virtual void on_draw() = 0;
+
+		void frame_pipelined();
+	};
+
+	// Copy of data for every frame in flight, so pipelined on_update
+	// never writes data that is read by on_draw at the same time.
+	// Holds a single copy used by both when latency is 0.
+	template<typename T>
+	class FrameData
+	{
+	public:
+		explicit FrameData(const RendererApplication& app)
+			: _app(app)
+		{
+		}
+
+		UC_NODISCARD T& update() { return _items[_app.update_slot()]; }
+		UC_NODISCARD const T& draw() const { return _items[_app.draw_slot()]; }
+
+		UC_NODISCARD T& operator[](UInt8 slot) { return _items[slot]; }
+		UC_NODISCARD const T& operator[](UInt8 slot) const { return _items[slot]; }
+
+	protected:
+		const RendererApplication& _app;
+		Array<T, RendererApplication::MaxFrameLatency + 1> _items;
 	};
 
 	template<typename RendererType,
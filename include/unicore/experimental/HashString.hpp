@@ -3,21 +3,44 @@
 
 namespace unicore
 {
+	// Compile-time 32-bit FNV-1a hash of string. Different strings can
+	// have the same hash, use Atom where exact comparison is required.
 	class HashString
 	{
 	public:
-		constexpr explicit HashString(size_t value)
+		using ValueType = UInt32;
+
+		static constexpr ValueType OffsetBasis = 0x811C9DC5U;
+		static constexpr ValueType Prime = 0x01000193U;
+
+		constexpr HashString() = default;
+
+		constexpr explicit HashString(ValueType value)
 			: _value(value) {}
 
-		UC_NODISCARD constexpr size_t value() const { return _value; }
+		constexpr HashString(StringView data)
+			: _value(calc_value(data)) {}
+
+		UC_NODISCARD constexpr ValueType value() const { return _value; }
 
 		static constexpr HashString calc(StringView data)
 		{
-			return HashString(0);
+			return HashString(calc_value(data));
+		}
+
+		static constexpr ValueType calc_value(StringView data, ValueType hash = OffsetBasis)
+		{
+			for (const auto c : data)
+			{
+				hash ^= static_cast<UInt8>(c);
+				hash *= Prime;
+			}
+
+			return hash;
 		}
 
 	protected:
-		size_t _value;
+		ValueType _value = OffsetBasis;
 	};
 
 	static constexpr bool operator==(const HashString& a, const HashString& b)
@@ -54,4 +77,19 @@ namespace unicore
 	{
 		return HashString::calc(StringView(path, len));
 	}
+
+	static_assert(""_hash.value() == 0x811C9DC5U);
+	static_assert("a"_hash.value() == 0xE40C292CU);
+}
+
+namespace std
+{
+	template<>
+	struct hash<unicore::HashString>
+	{
+		size_t operator()(const unicore::HashString& value) const noexcept
+		{
+			return value.value();
+		}
+	};
 }
\ No newline at end of file
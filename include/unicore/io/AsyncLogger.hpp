@@ -0,0 +1,227 @@
+#pragma once
+#include "unicore/io/Logger.hpp"
+#include "unicore/system/Timer.hpp"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace unicore
+{
+	enum class AsyncLoggerPolicy : UInt8
+	{
+		// Message is lost and counted when ring is full
+		Drop,
+		// Caller waits until background thread frees record
+		Block,
+	};
+
+	struct AsyncLoggerSettings
+	{
+		// Count of records in ring, rounded up to power of two
+		Size capacity = 4096;
+		AsyncLoggerPolicy policy = AsyncLoggerPolicy::Drop;
+		// Prefixes messages with seconds since logger creation
+		Bool timestamps = false;
+		// Longest time formatted messages wait in target before flush
+		TimeSpan flush_interval = TimeSpan::from_milliseconds(50);
+		// Installs crash handler on first AsyncLogger creation
+		Bool flush_on_crash = true;
+	};
+
+	// Moves formatting and writing of messages to background thread.
+	// Messages are fixed size binary records in lock-free ring: write()
+	// copies text, log() stores only format pointer and packed arguments.
+	// Background thread is woken when quarter of ring is filled and polls
+	// ring every flush_interval otherwise. Target is flushed after half
+	// of ring was formatted or flush_interval passed, so buffered
+	// FileLogger writes file rarely. Target is called from one thread
+	// at a time.
+	class AsyncLogger : public Logger
+	{
+		UC_OBJECT(AsyncLogger, Logger)
+	public:
+		// Size of record with header, longer text of write() and
+		// arguments of log() that do not fit are copied to heap
+		static constexpr Size RecordSize = 256;
+
+		explicit AsyncLogger(Logger& target, const AsyncLoggerSettings& settings = {});
+		~AsyncLogger() override;
+
+		UC_TYPE_DELETE_MOVE_COPY(AsyncLogger);
+
+		UC_NODISCARD const AsyncLoggerSettings& settings() const { return _settings; }
+		UC_NODISCARD Size capacity() const { return _mask + 1; }
+		// Messages lost with Drop policy
+		UC_NODISCARD UInt64 dropped() const { return _dropped.load(std::memory_order_relaxed); }
+		// Messages in ring that are not formatted yet
+		UC_NODISCARD Size pending() const
+		{
+			const auto head = _head.load(std::memory_order_relaxed);
+			return _tail.load(std::memory_order_relaxed) - head;
+		}
+
+		void write(LogType type, const StringView text) override;
+
+		// Writes all messages logged before call to target on calling thread
+		void flush() override;
+
+		// Deferred formatting, "{}" in format are replaced with args on
+		// background thread. Format has to be string literal. Supported
+		// args are numbers, bool, char and strings (copied). Other types
+		// have to be formatted by caller.
+		template<typename ... Args>
+		void log(LogType type, const char* format, const Args& ... args)
+		{
+			Size position;
+			if (const auto record = acquire(position))
+			{
+				record->type = type;
+				record->format = format;
+				record->time = _settings.timestamps ? now() : 0;
+
+				ArgWriter writer{ record->data };
+				(pack(writer, args), ...);
+				record->text = reinterpret_cast<char*>(writer.heap);
+				record->size = writer.size;
+
+				commit(record, position);
+			}
+		}
+
+		// Writes pending messages of all loggers on calling thread.
+		// Called from std::terminate handler, also safe to call manually.
+		static void flush_all();
+
+		// Flushes all loggers on std::terminate. Formatting is not
+		// async-signal-safe, so fatal signals (SIGSEGV, SIGABRT, SIGFPE,
+		// SIGILL) only write count of lost messages to stderr. Previous
+		// handler is called after that.
+		static void install_crash_handler();
+
+	protected:
+		enum class ArgType : UInt8
+		{
+			Int,
+			UInt,
+			Float,
+			Double,
+			Bool,
+			Char,
+			String,
+		};
+
+		static constexpr Size HeaderSize = 40;
+		static constexpr Size PayloadSize = RecordSize - HeaderSize;
+
+		struct alignas(64) Record
+		{
+			std::atomic<Size> sequence{ 0 };
+			Int64 time = 0;
+			// Nullptr for text records
+			const char* format = nullptr;
+			// Heap copy of long text or of arguments
+			char* text = nullptr;
+			UInt32 size = 0;
+			LogType type = LogType::Info;
+			Byte data[PayloadSize];
+		};
+
+		// Writes to record data, moves to heap when arguments do not fit
+		struct ArgWriter
+		{
+			Byte* data;
+			UInt32 size = 0;
+			Size capacity = PayloadSize;
+			// Owned by record after commit
+			Byte* heap = nullptr;
+
+			void put(ArgType type, const void* value, Size count);
+			void grow(Size count);
+		};
+
+		Logger& _target;
+		const AsyncLoggerSettings _settings;
+		const Timer _start;
+
+		Unique<Record[]> _records;
+		Size _mask = 0;
+
+		// Producers reserve records with CAS on tail,
+		// head is changed only with _consume_mutex locked
+		alignas(64) std::atomic<Size> _tail{ 0 };
+		alignas(64) std::atomic<Size> _head{ 0 };
+		std::atomic<UInt64> _dropped{ 0 };
+		UInt64 _reported_dropped = 0;
+
+		// Records formatted since last target flush, used by background thread
+		Size _unflushed = 0;
+		Timer _flush_time;
+
+		std::mutex _consume_mutex;
+		StringBuilder _builder;
+
+		std::mutex _mutex;
+		std::condition_variable _cv;
+		std::atomic<Bool> _sleeping{ false };
+		Bool _stop = false;
+		std::thread _thread;
+
+		UC_NODISCARD Record* acquire(Size& position);
+		void commit(Record* record, Size position);
+		void wake();
+
+		UC_NODISCARD Bool has_pending() const;
+		// Formats available records, _consume_mutex has to be locked
+		Size consume();
+		void format(const Record& record);
+		// Skips logger if consumer is locked for too long
+		void try_flush();
+		// _consume_mutex has to be locked
+		void flush_target();
+
+		void thread_loop();
+
+		static Int64 now() { return Timer::now().data().time_since_epoch().count(); }
+
+		template<typename T>
+		static void pack(ArgWriter& writer, const T& value)
+		{
+			if constexpr (std::is_same_v<T, bool>)
+			{
+				writer.put(ArgType::Bool, &value, sizeof(value));
+			}
+			else if constexpr (sfinae::is_char_v<T>)
+			{
+				const auto c = static_cast<Char32>(value);
+				writer.put(ArgType::Char, &c, sizeof(c));
+			}
+			else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+			{
+				const auto i = static_cast<Int64>(value);
+				writer.put(ArgType::Int, &i, sizeof(i));
+			}
+			else if constexpr (std::is_integral_v<T>)
+			{
+				const auto i = static_cast<UInt64>(value);
+				writer.put(ArgType::UInt, &i, sizeof(i));
+			}
+			else if constexpr (std::is_same_v<T, float>)
+			{
+				writer.put(ArgType::Float, &value, sizeof(value));
+			}
+			else if constexpr (std::is_floating_point_v<T>)
+			{
+				const auto d = static_cast<double>(value);
+				writer.put(ArgType::Double, &d, sizeof(d));
+			}
+			else
+			{
+				static_assert(std::is_convertible_v<const T&, StringView>,
+					"Unsupported AsyncLogger argument, format it before logging");
+				const StringView text(value);
+				writer.put(ArgType::String, text.data(), text.size());
+			}
+		}
+	};
+}
\ No newline at end of file
@@ -5,6 +5,7 @@ namespace unicore
 {
 	class MemoryChunk;
 	class BinaryData;
+	class BasicBinaryData;
 
 	enum class SeekMethod
 	{
@@ -34,6 +35,11 @@ namespace unicore
 		bool read(MemoryChunk& chunk, size_t* bytes_read = nullptr);
 
 		Shared<BinaryData> as_data();
+
+		// Whole file contents without copying when the file can be
+		// mapped into memory, falls back to as_data() otherwise.
+		// Mapping is copy-on-write, changes never reach the file.
+		virtual Shared<BasicBinaryData> map();
 	};
 
 	class WriteFile : public ReadFile
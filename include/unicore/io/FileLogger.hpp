@@ -6,16 +6,23 @@ namespace unicore
 {
 	class WriteFile;
 
+	// Every message is written with one file write. With buffer_size
+	// messages are collected until buffer exceeds it or flush is called.
 	class FileLogger : public Logger
 	{
 		UC_OBJECT(FileLogger, Logger)
 	public:
-		explicit FileLogger(const Shared<WriteFile>& file);
+		explicit FileLogger(const Shared<WriteFile>& file, Size buffer_size = 0);
+		~FileLogger() override;
 
 		void write(LogType type, const StringView text) override;
+		void flush() override;
 
 	protected:
 		Shared<WriteFile> _file;
-		FileWriter _writer;
+		const Size _buffer_size;
+		StringBuilder _buffer;
+
+		void write_buffer();
 	};
 }
\ No newline at end of file
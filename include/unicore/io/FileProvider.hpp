@@ -48,11 +48,11 @@ namespace unicore
 	public:
 		UC_NODISCARD size_t get_system_memory_use() const override;
 
-		UC_NODISCARD virtual Optional<FileStats> stats(const Path& path) const = 0;
-		UC_NODISCARD virtual bool exists(const Path& path) const;
+		UC_NODISCARD virtual Optional<FileStats> stats(PathView path) const = 0;
+		UC_NODISCARD virtual bool exists(PathView path) const;
 
-		UC_NODISCARD bool is_file(const Path& path) const;
-		UC_NODISCARD bool is_directory(const Path& path) const;
+		UC_NODISCARD bool is_file(PathView path) const;
+		UC_NODISCARD bool is_directory(PathView path) const;
 
 		virtual uint16_t enumerate_entries(const Path& path, StringView search_pattern,
 			List<String>& name_list, const EnumerateOptions& options = {}) const = 0;
@@ -82,8 +82,8 @@ namespace unicore
 	{
 		UC_OBJECT(ReadFileProvider, FileProvider)
 	public:
-		UC_NODISCARD virtual Shared<ReadFile> open_read(const Path& path) = 0;
-		UC_NODISCARD virtual Shared<MemoryChunk> read_chunk(const Path& path);
+		UC_NODISCARD virtual Shared<ReadFile> open_read(PathView path) = 0;
+		UC_NODISCARD virtual Shared<MemoryChunk> read_chunk(PathView path);
 
 	protected:
 		static bool enumerate_test_flags(FileType type, EnumerateFlags flags);
@@ -115,19 +115,19 @@ namespace unicore
 
 		UC_NODISCARD size_t get_system_memory_use() const override;
 
-		UC_NODISCARD Optional<FileStats> stats(const Path& path) const override;
-		UC_NODISCARD bool exists(const Path& path) const override;
+		UC_NODISCARD Optional<FileStats> stats(PathView path) const override;
+		UC_NODISCARD bool exists(PathView path) const override;
 
 		uint16_t enumerate_entries(const Path& path, StringView search_pattern,
 			List<String>& name_list, const EnumerateOptions& options) const override;
 
-		Shared<ReadFile> open_read(const Path& path) override;
+		Shared<ReadFile> open_read(PathView path) override;
 
 	protected:
 		ReadFileProvider& _provider;
 		Path _base;
 
-		UC_NODISCARD Path make_path(const Path& path) const { return _base / path; }
+		UC_NODISCARD Path make_path(PathView path) const { return _base / path; }
 	};
 
 	// CachedFileProvider /////////////////////////////////////////////////////////
@@ -137,13 +137,13 @@ namespace unicore
 	public:
 		UC_NODISCARD size_t get_system_memory_use() const override;
 
-		UC_NODISCARD bool exists(const Path& path) const override;
-		UC_NODISCARD Optional<FileStats> stats(const Path& path) const override;
+		UC_NODISCARD bool exists(PathView path) const override;
+		UC_NODISCARD Optional<FileStats> stats(PathView path) const override;
 
 		uint16_t enumerate_entries(const Path& path, StringView search_pattern,
 			List<String>& name_list, const EnumerateOptions& options) const override;
 
-		Shared<ReadFile> open_read(const Path& path) override;
+		Shared<ReadFile> open_read(PathView path) override;
 
 	protected:
 		UC_NODISCARD virtual Optional<FileStats> stats_index(intptr_t index) const = 0;
@@ -13,12 +13,12 @@ namespace unicore
 		void add_read(const Shared<ReadFileProvider>& provider);
 		void set_write(const Shared<WriteFileProvider>& provider);
 
-		UC_NODISCARD Optional<FileStats> stats(const Path& path) const override;
+		UC_NODISCARD Optional<FileStats> stats(PathView path) const override;
 
 		uint16_t enumerate_entries(const Path& path, StringView search_pattern,
 			List<String>& name_list, const EnumerateOptions& options) const override;
 
-		UC_NODISCARD Shared<ReadFile> open_read(const Path& path) override;
+		UC_NODISCARD Shared<ReadFile> open_read(PathView path) override;
 
 		bool create_directory(const Path& path) override;
 		bool delete_directory(const Path& path, bool recursive) override;
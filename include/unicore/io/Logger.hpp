@@ -2,6 +2,7 @@
 #include "unicore/system/Object.hpp"
 #include "unicore/system/Debug.hpp"
 #include "unicore/system/StringBuilder.hpp"
+#include "unicore/system/MemoryTracker.hpp"
 
 namespace unicore
 {
@@ -18,6 +19,8 @@ namespace unicore
 		UC_OBJECT(Logger, Object)
 	public:
 		virtual void write(LogType type, const StringView text) = 0;
+		// Writes buffered messages, if logger has any
+		virtual void flush() {}
 
 		inline void info(const StringView text) { write(LogType::Info, text); }
 		inline void debug(const StringView text) { write(LogType::Debug, text); }
@@ -37,6 +40,7 @@ namespace unicore
 		MultiLogger(std::initializer_list<Logger*> args);
 
 		void write(LogType type, const StringView text) override;
+		void flush() override;
 	};
 
 	class PrintLogger : public Logger
@@ -46,13 +50,13 @@ namespace unicore
 		void write(LogType type, const StringView text) override;
 	};
 
-	// TODO: Add format library to implement
 	class ProxyLogger : public Logger
 	{
 	public:
 		ProxyLogger(const StringView prefix, Logger& logger);
 
 		void write(LogType type, const StringView text) override;
+		void flush() override;
 
 	protected:
 		String _prefix;
@@ -87,6 +91,10 @@ namespace unicore
 	protected:
 		Logger& _logger;
 		const LogType _type;
+#if defined(UNICORE_USE_MEMORY_TRACKING)
+		// Message building and writing is counted as Logger memory
+		const MemoryScope _memory_scope;
+#endif
 	};
 }
 
@@ -18,6 +18,8 @@ namespace unicore
 		UC_NODISCARD bool eof() const override;
 		bool read(void* buffer, size_t size, size_t* bytes_read) override;
 
+		Shared<BasicBinaryData> map() override;
+
 	protected:
 		Shared<MemoryChunk> _chunk;
 		int64_t _position = 0;
@@ -4,6 +4,50 @@
 
 namespace unicore
 {
+	class Path;
+
+	// Non-owning view of normalized path with precomputed hash.
+	// Used for lookups to avoid building temporary Path objects.
+	class PathView
+	{
+	public:
+		constexpr PathView() = default;
+
+		PathView(const Path& path);
+
+		// String must be in normalized form (as Path::data())
+		explicit PathView(StringView path)
+			: _data(path), _hash(calc_hash(path)) {}
+
+		UC_NODISCARD bool empty() const { return _data.empty(); }
+
+		UC_NODISCARD size_t hash() const { return _hash; }
+		UC_NODISCARD StringView data() const { return _data; }
+
+		UC_NODISCARD bool starts_with(PathView path) const;
+
+		UC_NODISCARD PathView parent_path() const;
+		UC_NODISCARD StringView filename() const;
+		UC_NODISCARD StringView extension() const;
+
+		UC_NODISCARD bool equals(PathView other) const
+		{
+			return _hash == other._hash && _data == other._data;
+		}
+
+		bool operator==(PathView other) const { return equals(other); }
+		bool operator!=(PathView other) const { return !equals(other); }
+
+		static size_t calc_hash(StringView str)
+		{
+			return !str.empty() ? HashFunc<StringView>{}(str) : 0;
+		}
+
+	protected:
+		StringView _data;
+		size_t _hash = 0;
+	};
+
 	// TODO: Replace with filesystem::path
 	class Path
 	{
@@ -16,6 +60,9 @@ namespace unicore
 		explicit Path(StringView16 path);
 		explicit Path(StringView32 path);
 
+		// Copy of already normalized path, hash is reused
+		explicit Path(PathView path);
+
 		// Copy constructor
 		Path(const Path& other) = default;
 
@@ -70,11 +117,13 @@ namespace unicore
 		bool operator>(const Path& other) const { return compare(other) > 0; }
 
 		Path operator/(const String& file) const;
-		Path operator/(const Path& path) const;
+		Path operator/(PathView path) const;
 
 		void native_path(String& nativePath) const;
 		UC_NODISCARD String native_path() const;
 
+		static String combine_native(PathView base, PathView path);
+
 		UC_NODISCARD Path to_lower() const;
 
 		static Path combine(StringView a, StringView b);
@@ -91,15 +140,21 @@ namespace unicore
 		String _data;
 		size_t _hash;
 
-		Path(StringView path, size_t hash);
+		Path(String&& data, size_t hash);
 
 		static String::size_type find_filename_pos(StringView str);
 		static String::size_type find_extension_pos(StringView str);
 
 		static String prepare(StringView str);
-		static size_t calc_hash(StringView str);
+
+		friend class PathView;
 	};
 
+	inline PathView::PathView(const Path& path)
+		: _data(path.data()), _hash(path.hash())
+	{
+	}
+
 	static Path operator/(const Path& path, StringView file)
 	{
 		return Path::combine(path.data(), file);
@@ -117,9 +172,36 @@ namespace unicore
 
 
 	extern UNICODE_STRING_BUILDER_FORMAT(const Path&);
+	extern UNICODE_STRING_BUILDER_FORMAT(const PathView&);
 
 	UNICORE_MAKE_HASH(Path)
 	{
-		return make(value.data());
+		return value.hash();
 	}
+
+	UNICORE_MAKE_HASH(PathView)
+	{
+		return value.hash();
+	}
+}
+
+namespace std
+{
+	template<>
+	struct hash<unicore::Path>
+	{
+		size_t operator()(const unicore::Path& value) const noexcept
+		{
+			return value.hash();
+		}
+	};
+
+	template<>
+	struct hash<unicore::PathView>
+	{
+		size_t operator()(const unicore::PathView& value) const noexcept
+		{
+			return value.hash();
+		}
+	};
 }
\ No newline at end of file
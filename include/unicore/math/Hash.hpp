@@ -132,7 +132,7 @@ namespace unicore
 		}
 
 		template<typename T, typename... Args>
-		static size_t make(T first, Args... args)
+		static size_t make(const T& first, const Args&... args)
 		{
 			const size_t value = make<T>(first) ^ (make(args...) << 1);
 			return value;
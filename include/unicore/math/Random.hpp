@@ -93,4 +93,19 @@ namespace unicore
 	protected:
 		std::random_device _rd;
 	};
+
+	// Same seed gives same sequence, used for reproducible runs
+	class SeededRandom : public Random
+	{
+	public:
+		explicit SeededRandom(uint32_t seed = 0) : _engine(seed) {}
+
+		void set_seed(uint32_t seed) { _engine.seed(seed); }
+
+		uint32_t next() override;
+		float next_float_01() override;
+
+	protected:
+		std::mt19937 _engine;
+	};
 }
\ No newline at end of file
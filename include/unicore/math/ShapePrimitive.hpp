@@ -1,5 +1,6 @@
 #pragma once
 #include "unicore/math/Rect.hpp"
+#include "unicore/system/FrameArena.hpp"
 
 namespace unicore
 {
@@ -14,6 +15,8 @@ namespace unicore
 		// CIRCLE //////////////////////////////////////////////////////////////////
 		static void circle(List<Vector2f>& out,
 			const Vector2f& center, float radius, unsigned segments = 0);
+		static void circle(ArenaList<Vector2f>& out,
+			const Vector2f& center, float radius, unsigned segments = 0);
 
 		static List<Vector2f> circle(
 			const Vector2f& center, float radius, unsigned segments = 0);
@@ -21,6 +24,8 @@ namespace unicore
 		// ELLIPSE /////////////////////////////////////////////////////////////////
 		static void ellipse(List<Vector2f>& out,
 			const Vector2f& center, const Vector2f& radius, unsigned segments = 0);
+		static void ellipse(ArenaList<Vector2f>& out,
+			const Vector2f& center, const Vector2f& radius, unsigned segments = 0);
 
 		static List<Vector2f> ellipse(
 			const Vector2f& center, const Vector2f& radius, unsigned segments = 0);
@@ -28,6 +33,8 @@ namespace unicore
 		// STAR ////////////////////////////////////////////////////////////////////
 		static void star(List<Vector2f>& out, const Vector2f& center,
 			unsigned count, float radius, float radius_inner = 0);
+		static void star(ArenaList<Vector2f>& out, const Vector2f& center,
+			unsigned count, float radius, float radius_inner = 0);
 
 		static List<Vector2f> star(const Vector2f& center,
 			unsigned count, float radius, float radius_inner = 0);
@@ -36,6 +43,9 @@ namespace unicore
 		static void bezier3(List<Vector2f>& out,
 			const Vector2f& p0, const Vector2f& p1, const Vector2f& p2,
 			unsigned segments = 0);
+		static void bezier3(ArenaList<Vector2f>& out,
+			const Vector2f& p0, const Vector2f& p1, const Vector2f& p2,
+			unsigned segments = 0);
 
 		static List<Vector2f> bezier3(
 			const Vector2f& p0, const Vector2f& p1, const Vector2f& p2,
@@ -46,6 +56,10 @@ namespace unicore
 			const Vector2f& p0, const Vector2f& p1,
 			const Vector2f& p2, const Vector2f& p3,
 			unsigned segments = 0);
+		static void bezier4(ArenaList<Vector2f>& out,
+			const Vector2f& p0, const Vector2f& p1,
+			const Vector2f& p2, const Vector2f& p3,
+			unsigned segments = 0);
 
 		static List<Vector2f> bezier4(
 			const Vector2f& p0, const Vector2f& p1,
@@ -55,6 +69,8 @@ namespace unicore
 		// SPLINE //////////////////////////////////////////////////////////////////
 		static void spline(List<Vector2f>& out,
 			const Vector2f* points, unsigned points_count, unsigned segments = 0);
+		static void spline(ArenaList<Vector2f>& out,
+			const Vector2f* points, unsigned points_count, unsigned segments = 0);
 
 		static List<Vector2f> spline(
 			const Vector2f* points, unsigned points_count, unsigned segments = 0);
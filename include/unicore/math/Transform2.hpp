@@ -49,6 +49,16 @@ namespace unicore
 			vec = mat * vec + move;
 		}
 
+		// Angle is interpolated without wrap, steps are expected to be small
+		static constexpr Transform2 lerp(const Transform2& a, const Transform2& b, float t)
+		{
+			return {
+				Math::lerp(a.move, b.move, t),
+				Math::lerp(a.angle, b.angle, t),
+				Math::lerp(a.scale, b.scale, t)
+			};
+		}
+
 		static constexpr Transform2 moved(const Vector2<T>& move)
 		{
 			return Transform2(move);
@@ -18,6 +18,8 @@ namespace unicore
 	{
 		Resizable = 1 << 0,
 		Borderless = 1 << 1,
+		// Window is never shown, renderer draws into offscreen surface
+		Headless = 1 << 2,
 	};
 	UNICORE_ENUM_FLAGS(DisplayWindowFlag, DisplayWindowFlags);
 
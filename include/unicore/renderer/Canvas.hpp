@@ -1,8 +1,15 @@
 #pragma once
 #include "unicore/system/Buffer2.hpp"
+#include "unicore/renderer/Surface.hpp"
+#include "unicore/renderer/PixelConvert.hpp"
+#include "unicore/renderer/Raster.hpp"
 
 namespace unicore
 {
+	// Callback variants call func for every pixel, false stops drawing.
+	// Shapes (draw_line, circles, ellipse, polygons) pass only positions
+	// inside buffer. draw_line_h, draw_line_v and draw_rect are not clipped
+	// and pass every position of the line, as they always did.
 	template<typename T>
 	class Canvas
 	{
@@ -15,27 +22,43 @@ namespace unicore
 		explicit Canvas(IBuffer2<T>& buffer)
 			: _buffer(buffer)
 		{
+			// Known buffers are written directly without virtual calls
+			if constexpr (std::is_same_v<T, Color4b>)
+				_surface = dynamic_cast<DynamicSurface*>(&buffer);
+
+			if (!_surface)
+				_memory = dynamic_cast<Buffer2<T>*>(&buffer);
 		}
 
 		UC_NODISCARD IBuffer2<T>& buffer() { return _buffer; }
 		UC_NODISCARD const IBuffer2<T>& buffer() const { return _buffer; }
 		UC_NODISCARD const Vector2i& size() const { return _buffer.size(); }
 
+		// Buffer memory is written directly (no virtual calls per span).
+		// Such canvases can write disjoint areas from different threads.
+		UC_NODISCARD bool direct_access() const { return _surface || _memory; }
+
 		// POINT /////////////////////////////////////////////////////////////////////
 		void draw_point(const Vector2i& pos, ValueType value)
 		{
-			_buffer.set(pos.x, pos.y, value);
+			internal_write(value, [&](auto& writer)
+			{
+				write_span(writer, pos.x, pos.y, 1);
+			});
 		}
 
 		// STRAIGHT LINE /////////////////////////////////////////////////////////////
 		void draw_line_h(const Vector2i& pos, unsigned length, ValueType value)
 		{
-			_buffer.set_line_h(pos, length, value);
+			internal_write(value, [&](auto& writer)
+			{
+				write_span(writer, pos.x, pos.y, static_cast<int>(length));
+			});
 		}
 
+		// Callback takes position, not memory, so there is no span to write
 		bool draw_line_h(const Vector2i& pos, unsigned length, CallbackType func)
 		{
-			// TODO: Optimize with linear memory access
 			for (unsigned i = 0; i < length; i++)
 			{
 				if (!func(*this, Vector2i(pos.x + i, pos.y)))
@@ -47,12 +70,19 @@ namespace unicore
 
 		void draw_line_v(const Vector2i& pos, unsigned length, ValueType value)
 		{
-			_buffer.set_line_v(pos, length, value);
+			auto y = pos.y;
+			auto lng = static_cast<int>(length);
+			if (pos.x < 0 || pos.x >= size().x || !clip_range(y, lng, size().y))
+				return;
+
+			internal_write(value, [&](auto& writer)
+			{
+				writer.line_v(pos.x, y, lng);
+			});
 		}
 
 		bool draw_line_v(const Vector2i& pos, unsigned length, CallbackType func)
 		{
-			// TODO: Optimize with linear memory access
 			for (unsigned i = 0; i < length; i++)
 			{
 				if (!func(*this, Vector2i(pos.x, pos.y + i)))
@@ -103,110 +133,39 @@ namespace unicore
 		}
 
 		// LINE //////////////////////////////////////////////////////////////////////
-		// TODO: Rewrite line render
-		// TODO: Add draw_line for callback
 		void draw_line(const Vector2i& p1, const Vector2i& p2, ValueType value)
 		{
-			int x, y;
-
-			const auto x1 = p1.x;
-			const auto y1 = p1.y;
-
-			const auto x2 = p2.x;
-			const auto y2 = p2.y;
-
-			const int dx = x2 - x1;
-			const int dy = y2 - y1;
-			const int dx1 = Math::abs(dx);
-			const int dy1 = Math::abs(dy);
-			int px = 2 * dy1 - dx1;
-			int py = 2 * dx1 - dy1;
-			if (dy1 <= dx1)
+			internal_write(value, [&](auto& writer)
 			{
-				int xe;
-				if (dx >= 0)
+				Raster::line(p1, p2, [&](int x, int y, int lng)
 				{
-					x = x1;
-					y = y1;
-					xe = x2;
-				}
-				else
-				{
-					x = x2;
-					y = y2;
-					xe = x1;
-				}
-				_buffer.set(x, y, value);
-				for (int i = 0; x < xe; i++)
-				{
-					x = x + 1;
-					if (px < 0)
-					{
-						px = px + 2 * dy1;
-					}
-					else
-					{
-						if ((dx < 0 && dy < 0) || (dx > 0 && dy > 0))
-						{
-							y = y + 1;
-						}
-						else
-						{
-							y = y - 1;
-						}
-						px = px + 2 * (dy1 - dx1);
-					}
-					_buffer.set(x, y, value);
-				}
-			}
-			else
+					return write_span(writer, x, y, lng);
+				});
+			});
+		}
+
+		bool draw_line(const Vector2i& p1, const Vector2i& p2, CallbackType func)
+		{
+			return Raster::line(p1, p2, [&](int x, int y, int lng)
 			{
-				int ye;
-				if (dy >= 0)
-				{
-					x = x1;
-					y = y1;
-					ye = y2;
-				}
-				else
-				{
-					x = x2;
-					y = y2;
-					ye = y1;
-				}
-				_buffer.set(x, y, value);
-				for (int i = 0; y < ye; i++)
-				{
-					y = y + 1;
-					if (py <= 0)
-					{
-						py = py + 2 * dx1;
-					}
-					else
-					{
-						if ((dx < 0 && dy < 0) || (dx > 0 && dy > 0))
-						{
-							x = x + 1;
-						}
-						else
-						{
-							x = x - 1;
-						}
-						py = py + 2 * (dx1 - dy1);
-					}
-					_buffer.set(x, y, value);
-				}
-			}
+				return callback_span(x, y, lng, func);
+			});
 		}
 
-		// TODO: Replace with span
 		void draw_line_poly(const Vector2i* points, unsigned num_points, ValueType value)
 		{
-			for (unsigned i = 1; i < num_points; i++)
-				draw_line(points[i - 1], points[i], value);
+			internal_write(value, [&](auto& writer)
+			{
+				for (unsigned i = 1; i < num_points; i++)
+				{
+					Raster::line(points[i - 1], points[i], [&](int x, int y, int lng)
+					{
+						return write_span(writer, x, y, lng);
+					});
+				}
+			});
 		}
 
-		// TODO: Replace with span
 		bool draw_line_poly(const Vector2i* points, unsigned num_points, CallbackType func)
 		{
 			for (unsigned i = 1; i < num_points; i++)
@@ -219,88 +178,273 @@ namespace unicore
 		}
 
 		// CIRCE /////////////////////////////////////////////////////////////////////
-		// TODO: Add draw_circle with callback
 		void draw_circle(const Vector2i& center, int radius, ValueType value)
 		{
-			int x = 0, y = radius;
-			int d = 3 - 2 * radius;
-			draw_circle_points(center.x, center.y, x, y, value);
-			while (y >= x)
+			internal_write(value, [&](auto& writer)
 			{
-				x++;
-				if (d > 0)
+				Raster::circle(center, radius, [&](int x, int y, int lng)
 				{
-					y--;
-					d = d + 4 * (x - y) + 10;
-				}
-				else
-					d = d + 4 * x + 6;
-				draw_circle_points(center.x, center.y, x, y, value);
-			}
+					return write_span(writer, x, y, lng);
+				});
+			});
+		}
+
+		bool draw_circle(const Vector2i& center, int radius, CallbackType func)
+		{
+			return Raster::circle(center, radius, [&](int x, int y, int lng)
+			{
+				return callback_span(x, y, lng, func);
+			});
 		}
 
-		// TODO: Add fill_circle with callback
 		void fill_circle(const Vector2i& center, int radius, ValueType value)
 		{
-			// TODO: Optimize with draw_line_h
-			const int N = 2 * radius + 1;
-			for (int i = 0; i < N; i++)
+			internal_write(value, [&](auto& writer)
 			{
-				for (int j = 0; j < N; j++)
+				Raster::fill_circle(center, radius, [&](int x, int y, int lng)
 				{
-					const int x = i - radius;
-					const int y = j - radius;
+					return write_span(writer, x, y, lng);
+				});
+			});
+		}
 
-					if (x * x + y * y <= radius * radius + 1)
-						_buffer.set(center.x + x, center.y + y, value);
-				}
-			}
+		bool fill_circle(const Vector2i& center, int radius, CallbackType func)
+		{
+			return Raster::fill_circle(center, radius, [&](int x, int y, int lng)
+			{
+				return callback_span(x, y, lng, func);
+			});
+		}
+
+		// ELLIPSE ///////////////////////////////////////////////////////////////////
+		void fill_ellipse(const Vector2i& center, const Vector2i& radius, ValueType value)
+		{
+			internal_write(value, [&](auto& writer)
+			{
+				Raster::fill_ellipse(center, radius, [&](int x, int y, int lng)
+				{
+					return write_span(writer, x, y, lng);
+				});
+			});
+		}
+
+		bool fill_ellipse(const Vector2i& center, const Vector2i& radius, CallbackType func)
+		{
+			return Raster::fill_ellipse(center, radius, [&](int x, int y, int lng)
+			{
+				return callback_span(x, y, lng, func);
+			});
+		}
+
+		// POLYGON ///////////////////////////////////////////////////////////////////
+		void fill_triangle(const Vector2i& p0, const Vector2i& p1,
+			const Vector2i& p2, ValueType value)
+		{
+			internal_write(value, [&](auto& writer)
+			{
+				Raster::fill_triangle(p0, p1, p2, [&](int x, int y, int lng)
+				{
+					return write_span(writer, x, y, lng);
+				});
+			});
 		}
 
-		// TODO: Implement triangle rasterization
-		// https://github.com/ssloy/tinyrenderer/wiki/Lesson-2:-Triangle-rasterization-and-back-face-culling
+		bool fill_triangle(const Vector2i& p0, const Vector2i& p1,
+			const Vector2i& p2, CallbackType func)
+		{
+			return Raster::fill_triangle(p0, p1, p2, [&](int x, int y, int lng)
+			{
+				return callback_span(x, y, lng, func);
+			});
+		}
+
+		void fill_polygon(const Vector2i* points, unsigned num_points, ValueType value)
+		{
+			internal_write(value, [&](auto& writer)
+			{
+				Raster::fill_polygon(points, num_points, [&](int x, int y, int lng)
+				{
+					return write_span(writer, x, y, lng);
+				});
+			});
+		}
+
+		bool fill_polygon(const Vector2i* points, unsigned num_points, CallbackType func)
+		{
+			return Raster::fill_polygon(points, num_points, [&](int x, int y, int lng)
+			{
+				return callback_span(x, y, lng, func);
+			});
+		}
 
 		// COPY //////////////////////////////////////////////////////////////////////
 		void copy_buffer(const Vector2i& pos, const IReadOnlyBuffer2<T>& src)
 		{
-			Recti rect{ pos, src.size() };
+			copy_buffer(pos, src, src.rect());
+		}
+
+		// Copy src_rect area of src, src_rect.pos is placed at pos
+		void copy_buffer(const Vector2i& pos, const IReadOnlyBuffer2<T>& src, const Recti& src_rect)
+		{
+			if constexpr (std::is_same_v<T, Color4b>)
+			{
+				// Surface to surface copy goes row by row without temporary
+				const auto src_surface = dynamic_cast<const Surface*>(&src);
+				if (_surface && src_surface && src_surface != _surface)
+				{
+					_surface->blit(*src_surface, src_rect, pos);
+					return;
+				}
+			}
+
+			const auto area = src.get_clip_rect(src_rect);
+			Recti rect{ pos + (area.pos - src_rect.pos), area.size };
 			_buffer.clip_rect(rect);
 
 			if (rect.size.x > 0 && rect.size.y > 0)
 			{
+				const auto offset = rect.pos - pos + src_rect.pos;
 				List<T> line(rect.size.x);
 
 				for (int y = 0; y < rect.size.y; y++)
 				{
-					const auto w = src.get_line_h(0, y, rect.size.x, line.data());
-					_buffer.set_line_h({ pos.x, pos.y + y }, w, line.data());
+					const auto w = src.get_line_h(offset.x, offset.y + y, rect.size.x, line.data());
+					_buffer.set_line_h({ rect.pos.x, rect.pos.y + y }, w, line.data());
 				}
 			}
 		}
 
 	protected:
 		IBuffer2<T>& _buffer;
+		DynamicSurface* _surface = nullptr;
+		Buffer2<T>* _memory = nullptr;
+
+		// Writers get spans already clipped to the buffer
+		struct BufferWriter
+		{
+			IBuffer2<T>& buffer;
+			ValueType value;
+
+			void line_h(int x, int y, int lng) const { buffer.set_line_h(x, y, lng, value); }
+			void line_v(int x, int y, int lng) const { buffer.set_line_v(x, y, lng, value); }
+		};
+
+		struct MemoryWriter
+		{
+			T* data;
+			int stride;
+			ValueType value;
+
+			void line_h(int x, int y, int lng) const
+			{
+				std::fill_n(data + y * stride + x, lng, value);
+			}
+
+			void line_v(int x, int y, int lng) const
+			{
+				for (int i = 0; i < lng; i++)
+					data[(y + i) * stride + x] = value;
+			}
+		};
+
+		struct SurfaceWriter
+		{
+			UInt32* data;
+			int stride;
+			UInt32 value;
+
+			// Bounds of written pixels for DynamicSurface::mark_dirty
+			mutable Vector2i min = Vector2i(std::numeric_limits<int>::max());
+			mutable Vector2i max = Vector2i(std::numeric_limits<int>::min());
+
+			void line_h(int x, int y, int lng) const
+			{
+				PixelConvert::fill(data + y * stride + x, value, lng);
+				expand(x, y, x + lng, y + 1);
+			}
+
+			void line_v(int x, int y, int lng) const
+			{
+				for (int i = 0; i < lng; i++)
+					data[(y + i) * stride + x] = value;
+				expand(x, y, x + 1, y + lng);
+			}
+
+			void expand(int x0, int y0, int x1, int y1) const
+			{
+				min.x = Math::min(min.x, x0);
+				min.y = Math::min(min.y, y0);
+				max.x = Math::max(max.x, x1);
+				max.y = Math::max(max.y, y1);
+			}
+		};
 
-		void draw_circle_points(int xc, int yc, int x, int y, ValueType value)
+		template<typename Func>
+		void internal_write(ValueType value, Func func)
 		{
-			_buffer.set(xc + x, yc + y, value);
-			_buffer.set(xc - x, yc + y, value);
-			_buffer.set(xc + x, yc - y, value);
-			_buffer.set(xc - x, yc - y, value);
-			_buffer.set(xc + y, yc + x, value);
-			_buffer.set(xc - y, yc + x, value);
-			_buffer.set(xc + y, yc - x, value);
-			_buffer.set(xc - y, yc - x, value);
+			if constexpr (std::is_same_v<T, Color4b>)
+			{
+				if (_surface)
+				{
+					SurfaceWriter writer{ static_cast<UInt32*>(_surface->data()),
+						_surface->size().x, value.to_format(_surface->format()) };
+					func(writer);
+					if (writer.min.x < writer.max.x)
+						_surface->mark_dirty(Recti::from_min_max(writer.min, writer.max));
+					return;
+				}
+			}
+
+			if (_memory)
+			{
+				MemoryWriter writer{ _memory->data(), _memory->size().x, value };
+				func(writer);
+				return;
+			}
+
+			BufferWriter writer{ _buffer, value };
+			func(writer);
 		}
 
-		void internal_fill_rect(const Recti& rect, ValueType value)
+		static bool clip_range(int& pos, int& lng, int size)
 		{
-			for (int i = 0; i < rect.size.y; i++)
+			if (pos < 0)
 			{
-				draw_line_h(
-					Vector2i(rect.pos.x, rect.pos.y + i),
-					static_cast<unsigned>(rect.size.x), value);
+				lng += pos;
+				pos = 0;
 			}
+
+			if (pos + lng > size)
+				lng = size - pos;
+
+			return lng > 0;
+		}
+
+		template<typename Writer>
+		bool write_span(const Writer& writer, int x, int y, int lng)
+		{
+			if (y >= 0 && y < size().y && clip_range(x, lng, size().x))
+				writer.line_h(x, y, lng);
+			return true;
+		}
+
+		bool callback_span(int x, int y, int lng, CallbackType func)
+		{
+			if (y >= 0 && y < size().y && clip_range(x, lng, size().x))
+				return draw_line_h({ x, y }, static_cast<unsigned>(lng), func);
+			return true;
+		}
+
+		void internal_fill_rect(const Recti& rect, ValueType value)
+		{
+			if (rect.size.x <= 0 || rect.size.y <= 0)
+				return;
+
+			internal_write(value, [&](auto& writer)
+			{
+				for (int i = 0; i < rect.size.y; i++)
+					writer.line_h(rect.pos.x, rect.pos.y + i, rect.size.x);
+			});
 		}
 
 		bool internal_fill_rect(const Recti& rect, CallbackType func)
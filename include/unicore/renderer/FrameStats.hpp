@@ -0,0 +1,86 @@
+#pragma once
+#include "unicore/system/TimeSpan.hpp"
+#include "unicore/renderer/Renderer.hpp"
+
+namespace unicore
+{
+	class WriteFileProvider;
+	class Path;
+
+	struct FrameSample
+	{
+		// Time between start of previous and this frame
+		TimeSpan interval;
+		// CPU time spent by frame, update and draw
+		TimeSpan frame;
+		TimeSpan update;
+		TimeSpan draw;
+		RendererStats render;
+	};
+
+	// Keeps rolling window of last frames.
+	// Percentiles show hitches that are hidden by average FPS.
+	class FrameStats
+	{
+	public:
+		static constexpr UInt32 DefaultCapacity = 300;
+
+		// Bucket 0 holds times below HistogramBase, every next bucket
+		// is half octave (x1.41) wider, last bucket holds all longer times
+		static constexpr UInt32 HistogramSize = 24;
+		static constexpr TimeSpan HistogramBase = TimeSpan::from_microseconds(250);
+
+		using Field = TimeSpan FrameSample::*;
+		using Histogram = Array<UInt32, HistogramSize>;
+
+		struct Summary
+		{
+			TimeSpan min;
+			TimeSpan avg;
+			TimeSpan p50;
+			TimeSpan p95;
+			TimeSpan p99;
+			TimeSpan max;
+		};
+
+		explicit FrameStats(UInt32 capacity = DefaultCapacity);
+
+		void set_capacity(UInt32 capacity);
+		UC_NODISCARD UInt32 capacity() const { return static_cast<UInt32>(_samples.size()); }
+
+		// Count of frames in window
+		UC_NODISCARD UInt32 size() const { return _size; }
+		UC_NODISCARD bool empty() const { return _size == 0; }
+
+		// Count of frames added since start
+		UC_NODISCARD UInt64 total() const { return _total; }
+
+		// Index 0 is the oldest frame in window
+		UC_NODISCARD const FrameSample& get(UInt32 index) const;
+		UC_NODISCARD const FrameSample& last() const { return get(_size - 1); }
+
+		void add(const FrameSample& sample);
+		void clear();
+
+		// Frames per second over the window
+		UC_NODISCARD Float fps() const;
+
+		UC_NODISCARD Summary summary(Field field = &FrameSample::frame) const;
+		void histogram(Histogram& buckets, Field field = &FrameSample::frame) const;
+
+		// Upper time limit of histogram bucket
+		static TimeSpan bucket_limit(UInt32 index);
+		static UInt32 bucket_index(const TimeSpan& time);
+
+		// One line per frame in window, times in milliseconds
+		Bool write_csv(WriteFileProvider& provider, const Path& path) const;
+
+	protected:
+		List<FrameSample> _samples;
+		UInt32 _first = 0;
+		UInt32 _size = 0;
+		UInt64 _total = 0;
+
+		mutable List<TimeSpan> _sorted;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+#include "unicore/renderer/FrameStats.hpp"
+#include "unicore/renderer/PrimitiveBatch.hpp"
+
+namespace unicore
+{
+	// Draws frame times of FrameStats as bars inside rect, newest on the right.
+	// Every bar is split into update, draw and the rest of frame time.
+	class FrameStatsGraph
+	{
+	public:
+		// Time that fills whole height of rect
+		TimeSpan max_time = TimeSpan::from_microseconds(33333);
+		// Horizontal line, usually frame time of target FPS
+		TimeSpan budget = TimeSpan::from_microseconds(16667);
+
+		Color4b update_color = ColorConst4b::LimeGreen;
+		Color4b draw_color = ColorConst4b::DodgerBlue;
+		Color4b other_color = ColorConst4b::DimGray;
+		Color4b budget_color = ColorConst4b::Red;
+
+		void draw(PrimitiveBatch& batch, const FrameStats& stats, const Rectf& rect) const;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+#include "unicore/renderer/Color4.hpp"
+
+namespace unicore::PixelConvert
+{
+	using Format = PixelFormat<UInt32, UInt8>;
+
+	// Layout of Color4b in memory when read as UInt32 (little-endian)
+	static constexpr Format color4b_format = pixel_format_abgr;
+
+	// Kernels use SSE2/NEON when available with a scalar fallback.
+	// Source and destination ranges must not overlap.
+	extern void copy(UInt32* dest, const UInt32* src, Size count);
+	extern void fill(UInt32* dest, UInt32 value, Size count);
+
+	// Swizzle pixels from src_format to dest_format (plain copy if equal)
+	extern void convert(const Format& dest_format, UInt32* dest,
+		const Format& src_format, const UInt32* src, Size count);
+
+	extern void to_colors(const Format& format,
+		const UInt32* src, Color4b* dest, Size count);
+	extern void from_colors(const Format& format,
+		const Color4b* src, UInt32* dest, Size count);
+
+	// Write 8-bit alpha values as pixels of color rgb with that alpha
+	extern void expand_alpha(const Format& format, const UInt8* alpha,
+		UInt32* dest, Size count, const Color4b& color = ColorConst4b::White);
+
+	// Multiply rgb by alpha in place (rounded, alpha is kept as is)
+	extern void premultiply(const Format& format, UInt32* data, Size count);
+}
\ No newline at end of file
@@ -16,6 +16,24 @@ namespace unicore
 		uint8_t r_shift, g_shift, b_shift, a_shift;
 	};
 
+	template<typename DataType, typename ComponentType>
+	static constexpr bool operator==(
+		const PixelFormat<DataType, ComponentType>& a,
+		const PixelFormat<DataType, ComponentType>& b)
+	{
+		return
+			a.r_shift == b.r_shift && a.g_shift == b.g_shift &&
+			a.b_shift == b.b_shift && a.a_shift == b.a_shift;
+	}
+
+	template<typename DataType, typename ComponentType>
+	static constexpr bool operator!=(
+		const PixelFormat<DataType, ComponentType>& a,
+		const PixelFormat<DataType, ComponentType>& b)
+	{
+		return !(a == b);
+	}
+
 	// https://github.com/urho3d/Urho3D/blob/master/Source/Urho3D/Math/Color.cpp
 	static constexpr PixelFormat<uint32_t, uint8_t> pixel_format_argb{ 16, 8, 0, 24 };
 	static constexpr PixelFormat<uint32_t, uint8_t> pixel_format_abgr{ 0, 8, 16, 24 };
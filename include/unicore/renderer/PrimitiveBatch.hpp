@@ -61,8 +61,10 @@ namespace unicore
 		PrimitiveBatch& draw_line(const Vector2f& p0, const Vector2f& p1);
 
 		PrimitiveBatch& draw_poly_line(const List<Vector2f>& points, bool closed = false);
+		PrimitiveBatch& draw_poly_line(const Vector2f* points, unsigned count, bool closed = false);
 
 		PrimitiveBatch& draw_path(const List<Vector2f>& points, const PrimitiveBatchLineStyle& style, bool closed = false);
+		PrimitiveBatch& draw_path(const Vector2f* points, unsigned count, const PrimitiveBatchLineStyle& style, bool closed = false);
 
 		PrimitiveBatch& draw_rect(const Recti& rect, bool filled = false);
 		PrimitiveBatch& draw_rect(const Rectf& rect, bool filled = false);
@@ -83,6 +85,7 @@ namespace unicore
 		PrimitiveBatch& draw_quad(const QuadColor2f& quad);
 
 		PrimitiveBatch& draw_convex_poly(const List<Vector2f>& points);
+		PrimitiveBatch& draw_convex_poly(const Vector2f* points, unsigned count);
 
 		PrimitiveBatch& draw_grid(const Vector2i& count, const Vector2f& step,
 			const Action<PrimitiveBatch&, const Vector2f&>& draw_func, const Vector2f& offset = VectorConst2f::Zero);
@@ -112,6 +115,7 @@ namespace unicore
 		List<Batch> _batches;
 		Batch _current;
 
+		PrimitiveBatch& draw_shape(const ArenaList<Vector2f>& points, bool filled);
 		void set_type(BatchType type);
 	};
 }
\ No newline at end of file
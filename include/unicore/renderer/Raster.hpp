@@ -0,0 +1,237 @@
+#pragma once
+#include "unicore/math/Vector2.hpp"
+
+namespace unicore::Raster
+{
+	// Primitives are emitted as horizontal spans without clipping.
+	// SpanFunc is bool(int x, int y, int length), false stops rasterization.
+
+	// Bresenham line, pixels of the same row are merged into one span.
+	// Ties step minor axis in x-major lines only (as Canvas always did).
+	template<typename SpanFunc>
+	static bool line(Vector2i a, Vector2i b, SpanFunc func)
+	{
+		const int dx = Math::abs(b.x - a.x);
+		const int dy = Math::abs(b.y - a.y);
+
+		if (dx >= dy)
+		{
+			if (a.x > b.x) std::swap(a, b);
+
+			const int sy = a.y < b.y ? 1 : -1;
+			int err = 2 * dy - dx;
+			int start = a.x, y = a.y;
+			for (int x = a.x; x < b.x; x++)
+			{
+				if (err >= 0)
+				{
+					if (!func(start, y, x - start + 1))
+						return false;
+
+					start = x + 1;
+					y += sy;
+					err -= 2 * dx;
+				}
+				err += 2 * dy;
+			}
+
+			return func(start, y, b.x - start + 1);
+		}
+
+		if (a.y > b.y) std::swap(a, b);
+
+		const int sx = a.x < b.x ? 1 : -1;
+		int err = 2 * dx - dy;
+		int x = a.x;
+		for (int y = a.y; y <= b.y; y++)
+		{
+			if (!func(x, y, 1))
+				return false;
+
+			if (err > 0)
+			{
+				x += sx;
+				err -= 2 * dy;
+			}
+			err += 2 * dx;
+		}
+
+		return true;
+	}
+
+	// Midpoint circle outline
+	template<typename SpanFunc>
+	static bool circle(const Vector2i& center, int radius, SpanFunc func)
+	{
+		const auto points = [&](int x, int y)
+		{
+			return
+				func(center.x + x, center.y + y, 1) && func(center.x - x, center.y + y, 1) &&
+				func(center.x + x, center.y - y, 1) && func(center.x - x, center.y - y, 1) &&
+				func(center.x + y, center.y + x, 1) && func(center.x - y, center.y + x, 1) &&
+				func(center.x + y, center.y - x, 1) && func(center.x - y, center.y - x, 1);
+		};
+
+		int x = 0, y = radius;
+		int d = 3 - 2 * radius;
+		if (!points(x, y))
+			return false;
+
+		while (y >= x)
+		{
+			x++;
+			if (d > 0)
+			{
+				y--;
+				d = d + 4 * (x - y) + 10;
+			}
+			else
+				d = d + 4 * x + 6;
+
+			if (!points(x, y))
+				return false;
+		}
+
+		return true;
+	}
+
+	// Pixels with x * x + y * y <= radius * radius + 1
+	template<typename SpanFunc>
+	static bool fill_circle(const Vector2i& center, int radius, SpanFunc func)
+	{
+		if (radius < 0)
+			return true;
+
+		const int limit = radius * radius + 1;
+		int dx = radius;
+		for (int dy = 0; dy <= radius; dy++)
+		{
+			while (dx * dx + dy * dy > limit)
+				dx--;
+
+			if (!func(center.x - dx, center.y + dy, 2 * dx + 1))
+				return false;
+
+			if (dy != 0 && !func(center.x - dx, center.y - dy, 2 * dx + 1))
+				return false;
+		}
+
+		return true;
+	}
+
+	// Pixels with (x / radius.x)^2 + (y / radius.y)^2 <= 1
+	template<typename SpanFunc>
+	static bool fill_ellipse(const Vector2i& center, const Vector2i& radius, SpanFunc func)
+	{
+		if (radius.x < 0 || radius.y < 0)
+			return true;
+
+		const Int64 a2 = static_cast<Int64>(radius.x) * radius.x;
+		const Int64 b2 = static_cast<Int64>(radius.y) * radius.y;
+		const Int64 limit = a2 * b2;
+
+		Int64 dx = radius.x;
+		for (Int64 dy = 0; dy <= radius.y; dy++)
+		{
+			while (dx > 0 && dx * dx * b2 + dy * dy * a2 > limit)
+				dx--;
+
+			const auto x = center.x - static_cast<int>(dx);
+			const auto lng = static_cast<int>(2 * dx + 1);
+			if (!func(x, center.y + static_cast<int>(dy), lng))
+				return false;
+
+			if (dy != 0 && !func(x, center.y - static_cast<int>(dy), lng))
+				return false;
+		}
+
+		return true;
+	}
+
+	namespace details
+	{
+		// Scanline fill by pixel centers with even-odd rule.
+		// Nodes must have space for count values.
+		template<typename SpanFunc>
+		static bool fill_polygon(const Vector2i* points, Size count,
+			Double* nodes, SpanFunc func)
+		{
+			if (count < 3)
+				return true;
+
+			int min_y = points[0].y, max_y = points[0].y;
+			for (Size i = 1; i < count; i++)
+			{
+				min_y = Math::min(min_y, points[i].y);
+				max_y = Math::max(max_y, points[i].y);
+			}
+
+			for (int y = min_y; y < max_y; y++)
+			{
+				const auto cy = static_cast<Double>(y) + 0.5;
+
+				Size num = 0;
+				for (Size i = 0, j = count - 1; i < count; j = i++)
+				{
+					const auto& a = points[i];
+					const auto& b = points[j];
+					if ((a.y <= cy) == (b.y <= cy))
+						continue;
+
+					const auto x = a.x + (cy - a.y) * (b.x - a.x) / (b.y - a.y);
+
+					// Insertion sort, node count is small
+					Size k = num++;
+					for (; k > 0 && nodes[k - 1] > x; k--)
+						nodes[k] = nodes[k - 1];
+					nodes[k] = x;
+				}
+
+				for (Size k = 0; k + 1 < num; k += 2)
+				{
+					const auto x0 = static_cast<int>(std::ceil(nodes[k] - 0.5));
+					const auto x1 = static_cast<int>(std::ceil(nodes[k + 1] - 0.5));
+					if (x1 > x0 && !func(x0, y, x1 - x0))
+						return false;
+				}
+			}
+
+			return true;
+		}
+	}
+
+	// Points are pixel corners, pixel is filled if its center is inside.
+	// Scratch keeps intersection nodes, reuse it to avoid allocations.
+	template<typename SpanFunc>
+	static bool fill_polygon(const Vector2i* points, Size count, List<Double>& scratch, SpanFunc func)
+	{
+		if (scratch.size() < count)
+			scratch.resize(count);
+		return details::fill_polygon(points, count, scratch.data(), func);
+	}
+
+	// Polygons up to SmallPolygonSize points do not allocate
+	static constexpr Size SmallPolygonSize = 64;
+
+	template<typename SpanFunc>
+	static bool fill_polygon(const Vector2i* points, Size count, SpanFunc func)
+	{
+		if (count <= SmallPolygonSize)
+		{
+			Double nodes[SmallPolygonSize];
+			return details::fill_polygon(points, count, nodes, func);
+		}
+
+		List<Double> scratch;
+		return fill_polygon(points, count, scratch, func);
+	}
+
+	template<typename SpanFunc>
+	static bool fill_triangle(const Vector2i& p0, const Vector2i& p1,
+		const Vector2i& p2, SpanFunc func)
+	{
+		const Vector2i points[3] = { p0, p1, p2 };
+		Double nodes[3];
+		return details::fill_polygon(points, 3, nodes, func);
+	}
+}
\ No newline at end of file
@@ -8,25 +8,42 @@ namespace unicore
 	class Logger;
 	class Surface;
 
+	// Counters of current frame, reset by begin_frame
+	struct RendererStats
+	{
+		UInt32 draw_calls = 0;
+		UInt32 vertices = 0;
+		// Count of draws that use other texture than previous draw
+		UInt32 texture_switches = 0;
+	};
+
 	class Renderer : public Module
 	{
 		UC_OBJECT(Renderer, Module)
 	public:
 		UC_NODISCARD virtual const Vector2i& screen_size() const = 0;
-		UC_NODISCARD virtual uint32_t draw_calls() const = 0;
+		UC_NODISCARD virtual const RendererStats& stats() const = 0;
+
+		UC_NODISCARD uint32_t draw_calls() const { return stats().draw_calls; }
 
 		virtual Shared<Texture> create_texture(Surface& surface) = 0;
 
 		virtual Shared<DynamicTexture> create_dynamic_texture(const Vector2i& size) = 0;
+		// Without rect DynamicSurface uploads only its dirty rects. Surface is
+		// not changed, call clear_dirty after all textures of it are updated.
 		virtual bool update_texture(DynamicTexture& texture, Surface& surface,
 			Optional<Recti> rect = std::nullopt) = 0;
 
 		virtual Shared<TargetTexture> create_target_texture(const Vector2i& size) = 0;
 
+		// Null texture sets screen as target
 		virtual bool set_target(const Shared<TargetTexture>& texture) = 0;
 		UC_NODISCARD virtual const Shared<TargetTexture>& get_target() const = 0;
 
 		virtual bool begin_frame() = 0;
 		virtual void end_frame() = 0;
+
+		// Copies pixels of current target, surface has to be screen_size
+		virtual bool read_pixels(Surface& surface) = 0;
 	};
 }
\ No newline at end of file
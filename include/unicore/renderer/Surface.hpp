@@ -6,6 +6,8 @@
 
 namespace unicore
 {
+	class BasicBinaryData;
+
 	class SolidSizeOptions : public ResourceOptions
 	{
 	public:
@@ -36,6 +38,8 @@ namespace unicore
 		UC_OBJECT(Surface, Resource)
 	public:
 		Surface(const Vector2i& size, MemoryChunk&& chunk);
+		// Pixels at offset inside data, kept alive without copying
+		Surface(const Vector2i& size, const Shared<BasicBinaryData>& data, Size offset);
 
 		UC_NODISCARD size_t get_system_memory_use() const override { return sizeof(Surface) + _chunk.size(); }
 		UC_NODISCARD const Vector2i& size() const override { return _size; }
@@ -52,6 +56,7 @@ namespace unicore
 	protected:
 		Vector2i _size = VectorConst2i::Zero;
 		MemoryChunk _chunk;
+		Shared<BasicBinaryData> _source;
 
 		UC_NODISCARD int calc_offset(int x, int y) const { return (y * _size.x + x) * 4; }
 	};
@@ -75,5 +80,25 @@ namespace unicore
 
 		unsigned set_line_h(int x, int y, unsigned lng, const Color4b* src) override;
 		unsigned set_line_v(int x, int y, unsigned lng, const Color4b* src) override;
+
+		// Copy src pixels at pos with clipping and format conversion
+		void blit(const Surface& src, const Vector2i& pos);
+		void blit(const Surface& src, const Recti& src_rect, const Vector2i& pos);
+
+		// DIRTY /////////////////////////////////////////////////////////////////////
+		// Areas changed since last clear_dirty, used for partial texture upload.
+		// New surface is dirty as a whole. Marking an area that is already
+		// covered only reads the list, so it is safe from multiple threads.
+		UC_NODISCARD bool is_dirty() const { return !_dirty_rects.empty(); }
+		UC_NODISCARD const List<Recti>& dirty_rects() const { return _dirty_rects; }
+
+		void mark_dirty();
+		void mark_dirty(const Recti& rect);
+		void clear_dirty() { _dirty_rects.clear(); }
+
+		static constexpr Size MaxDirtyRects = 16;
+
+	protected:
+		List<Recti> _dirty_rects;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+#include "unicore/renderer/Surface.hpp"
+
+namespace unicore
+{
+	class Logger;
+	class WriteFile;
+	class BasicBinaryData;
+
+	// Native texture container: header, level table and raw pixels
+	// already in the layout the renderer uploads, so loading is a plain
+	// memory view (uncompressed) or a single LZ4 decode (compressed).
+	// All values are little-endian.
+	namespace SurfaceContainer
+	{
+		static constexpr StringView extension = ".uctex";
+
+		static constexpr UInt32 magic = 0x58544355; // "UCTX"
+		static constexpr UInt16 version = 1;
+		// Offset alignment of level data
+		static constexpr UInt32 alignment = 16;
+		static constexpr UInt8 max_levels = 16;
+
+		enum class Compression : UInt8
+		{
+			None = 0,
+			Lz4 = 1,
+		};
+
+		struct Header
+		{
+			UInt32 magic;
+			UInt16 version;
+			Compression compression;
+			UInt8 level_count;
+			UInt8 format[4]; // r, g, b, a shifts
+			UInt32 width;
+			UInt32 height;
+			UInt32 reserved;
+		};
+
+		struct Level
+		{
+			UInt32 width;
+			UInt32 height;
+			UInt64 offset;
+			UInt64 size; // Stored (compressed) size
+		};
+
+		static_assert(sizeof(Header) == 24);
+		static_assert(sizeof(Level) == 24);
+
+		struct WriteOptions
+		{
+			Compression compression = Compression::Lz4;
+			// Pixel layout of stored data, should match the renderer texture format
+			SurfaceFormat format = pixel_format_abgr;
+			// Generate all levels down to 1x1 with box filter
+			Bool mipmaps = false;
+		};
+
+		extern bool write(WriteFile& file, const Surface& surface,
+			const WriteOptions& options = {}, Logger* logger = nullptr);
+
+		// Validates header and level table
+		UC_NODISCARD extern const Header* read_header(
+			const BasicBinaryData& data, Logger* logger = nullptr);
+
+		// Surface from level data. Uncompressed level in Surface format
+		// references data memory (file mapping) instead of copying it.
+		UC_NODISCARD extern Shared<Surface> load(const Shared<BasicBinaryData>& data,
+			unsigned level = 0, Logger* logger = nullptr);
+	}
+}
\ No newline at end of file
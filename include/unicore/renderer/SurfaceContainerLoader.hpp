@@ -0,0 +1,32 @@
+#pragma once
+#include "unicore/resource/ResourceLoader.hpp"
+#include "unicore/renderer/SurfaceContainer.hpp"
+
+namespace unicore
+{
+	struct SurfaceContainerLoadPolicy : ResourceLoaderPathPolicy::Extension
+	{
+		SurfaceContainerLoadPolicy()
+			: Extension({ SurfaceContainer::extension })
+		{
+		}
+	};
+
+	// SurfaceContainerLoader /////////////////////////////////////////////////////
+	class SurfaceContainerLoader : public ResourceLoaderTyped<
+		ResourceLoaderTypePolicy::Single<Surface>, SurfaceContainerLoadPolicy>
+	{
+		UC_OBJECT(SurfaceContainerLoader, ResourceLoader)
+	public:
+		UC_NODISCARD Shared<Resource> load(const Context& context) override;
+	};
+
+	// DynamicSurfaceContainerLoader //////////////////////////////////////////////
+	class DynamicSurfaceContainerLoader : public ResourceLoaderTyped<
+		ResourceLoaderTypePolicy::Single<DynamicSurface>, SurfaceContainerLoadPolicy>
+	{
+		UC_OBJECT(DynamicSurfaceContainerLoader, ResourceLoader)
+	public:
+		UC_NODISCARD Shared<Resource> load(const Context& context) override;
+	};
+}
\ No newline at end of file
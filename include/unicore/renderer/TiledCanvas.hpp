@@ -0,0 +1,120 @@
+#pragma once
+#include "unicore/renderer/Canvas.hpp"
+#include "unicore/system/ThreadPool.hpp"
+
+namespace unicore
+{
+	// Splits the target into tiles and processes them on ThreadPool.
+	// Every pixel belongs to exactly one tile, so results match Canvas
+	// as long as callbacks depend only on their position.
+	// Buffers without direct_access are processed on the calling thread.
+	template<typename T>
+	class TiledCanvas
+	{
+	public:
+		using CanvasType = Canvas<T>;
+		using ValueType = typename CanvasType::ValueType;
+		using CallbackType = typename CanvasType::CallbackType;
+
+		TiledCanvas(IBuffer2<T>& buffer, ThreadPool& pool,
+			const Vector2i& tile_size = Vector2i(128))
+			: _canvas(buffer), _pool(pool)
+			, _tile_size(Math::max(tile_size.x, 1), Math::max(tile_size.y, 1))
+		{
+		}
+
+		UC_NODISCARD IBuffer2<T>& buffer() { return _canvas.buffer(); }
+		UC_NODISCARD const IBuffer2<T>& buffer() const { return _canvas.buffer(); }
+		UC_NODISCARD const Vector2i& size() const { return _canvas.size(); }
+		UC_NODISCARD const Vector2i& tile_size() const { return _tile_size; }
+
+		// FILL //////////////////////////////////////////////////////////////////////
+		void fill(ValueType value)
+		{
+			fill_rect(buffer().rect(), value);
+		}
+
+		// Returns false if callback returned false in any tile,
+		// other tiles are still processed to the end
+		bool fill(CallbackType func)
+		{
+			return fill_rect(buffer().rect(), func);
+		}
+
+		void fill_rect(const Recti& rect, ValueType value)
+		{
+			for_each_tile(buffer().get_clip_rect(rect),
+				[&](CanvasType& canvas, const Recti& tile)
+				{
+					canvas.fill_rect(tile, value);
+				});
+		}
+
+		bool fill_rect(const Recti& rect, CallbackType func)
+		{
+			std::atomic<bool> result{ true };
+			for_each_tile(buffer().get_clip_rect(rect),
+				[&](CanvasType& canvas, const Recti& tile)
+				{
+					if (!canvas.fill_rect(tile, func))
+						result = false;
+				});
+			return result;
+		}
+
+		// COPY //////////////////////////////////////////////////////////////////////
+		void copy_buffer(const Vector2i& pos, const IReadOnlyBuffer2<T>& src)
+		{
+			for_each_tile(buffer().get_clip_rect({ pos, src.size() }),
+				[&](CanvasType& canvas, const Recti& tile)
+				{
+					canvas.copy_buffer(tile.pos, src, { tile.pos - pos, tile.size });
+				});
+		}
+
+	protected:
+		CanvasType _canvas;
+		ThreadPool& _pool;
+		const Vector2i _tile_size;
+
+		template<typename Func>
+		void for_each_tile(const Recti& area, Func func)
+		{
+			if (area.size.x <= 0 || area.size.y <= 0)
+				return;
+
+			const int count_x = (area.size.x + _tile_size.x - 1) / _tile_size.x;
+			const int count_y = (area.size.y + _tile_size.y - 1) / _tile_size.y;
+
+			const auto process = [&](unsigned index)
+			{
+				const auto x = area.pos.x + static_cast<int>(index % count_x) * _tile_size.x;
+				const auto y = area.pos.y + static_cast<int>(index / count_x) * _tile_size.y;
+				const Recti tile(x, y,
+					Math::min(_tile_size.x, area.max_x() - x),
+					Math::min(_tile_size.y, area.max_y() - y));
+
+				CanvasType canvas(buffer());
+				func(canvas, tile);
+			};
+
+			const auto total = static_cast<unsigned>(count_x * count_y);
+			if (_canvas.direct_access())
+			{
+				// Tiles then only hit already covered dirty area
+				if constexpr (std::is_same_v<T, Color4b>)
+				{
+					if (const auto surface = dynamic_cast<DynamicSurface*>(&buffer()))
+						surface->mark_dirty(area);
+				}
+
+				_pool.parallel_for(total, process);
+			}
+			else
+			{
+				for (unsigned i = 0; i < total; i++)
+					process(i);
+			}
+		}
+	};
+}
\ No newline at end of file
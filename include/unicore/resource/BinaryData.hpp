@@ -54,4 +54,24 @@ namespace unicore
 	protected:
 		List<Byte> _data;
 	};
+
+	// BinaryDataView /////////////////////////////////////////////////////////////
+	// Memory owned by someone else (mapped file, memory chunk),
+	// owner is released with the last reference to the view
+	class BinaryDataView : public BasicBinaryData
+	{
+		UC_OBJECT(BinaryDataView, BasicBinaryData)
+	public:
+		BinaryDataView(const void* data, size_t size, const Shared<void>& owner);
+
+		UC_NODISCARD size_t get_system_memory_use() const override;
+
+		UC_NODISCARD const void* data() const override { return _data; }
+		UC_NODISCARD size_t size() const override { return _size; }
+
+	protected:
+		const void* _data;
+		size_t _size;
+		Shared<void> _owner;
+	};
 }
\ No newline at end of file
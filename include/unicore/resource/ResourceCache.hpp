@@ -37,12 +37,12 @@ namespace unicore
 		}
 
 		// LOAD //////////////////////////////////////////////////////////////////////
-		virtual Shared<Resource> load_raw(const Path& path, TypeConstRef type,
+		virtual Shared<Resource> load_raw(PathView path, TypeConstRef type,
 			const ResourceOptions* options, ResourceCacheFlags flags) = 0;
 
 		template<typename T,
 			std::enable_if_t<std::is_base_of_v<Resource, T>>* = nullptr>
-		Shared<T> load(const Path& path, ResourceCacheFlags flags = ResourceCacheFlags::Zero)
+		Shared<T> load(PathView path, ResourceCacheFlags flags = ResourceCacheFlags::Zero)
 		{
 			auto& type = get_type<T>();
 			auto resource = load_raw(path, type, nullptr, flags);
@@ -52,7 +52,7 @@ namespace unicore
 		template<typename T, typename TData,
 			std::enable_if_t<std::is_base_of_v<Resource, T>>* = nullptr,
 			std::enable_if_t<std::is_base_of_v<ResourceOptions, TData>>* = nullptr>
-		Shared<T> load(const Path& path, const TData& options, ResourceCacheFlags flags = ResourceCacheFlags::Zero)
+		Shared<T> load(PathView path, const TData& options, ResourceCacheFlags flags = ResourceCacheFlags::Zero)
 		{
 			auto& type = get_type<T>();
 			auto resource = load_raw(path, type, &options, flags);
@@ -71,7 +71,7 @@ namespace unicore
 
 		UC_NODISCARD Optional<Path> find_path(const Resource& resource) const;
 
-		Shared<Resource> load_raw(const Path& path, TypeConstRef type,
+		Shared<Resource> load_raw(PathView path, TypeConstRef type,
 			const ResourceOptions* options, ResourceCacheFlags flags) override;
 
 		void dump_used();
@@ -99,8 +99,9 @@ namespace unicore
 		};
 
 		List<Weak<Resource>> _resources;
-		Dictionary<ResourceLoader*, Dictionary<size_t, CachedInfo>> _cached;
+		Dictionary<ResourceLoader*, HashDictionary<size_t, CachedInfo>> _cached;
+		HashDictionary<const Resource*, Path> _paths;
 
-		static size_t make_hash(const Path& path, const ResourceOptions* options);
+		static size_t make_hash(PathView path, const ResourceOptions* options);
 	};
 }
\ No newline at end of file
@@ -15,7 +15,7 @@ namespace unicore
 		struct Context
 		{
 			IResourceCache& cache;
-			Path path;
+			PathView path;
 			const ResourceOptions* options;
 			Logger* logger = nullptr;
 		};
@@ -25,7 +25,7 @@ namespace unicore
 		UC_NODISCARD virtual int priority() const { return 0; }
 		UC_NODISCARD virtual const TypeInfo* options_type() const { return nullptr; }
 
-		UC_NODISCARD virtual bool can_load(const Path& path) const = 0;
+		UC_NODISCARD virtual bool can_load(PathView path) const = 0;
 		UC_NODISCARD virtual bool can_load(const ResourceOptions* options) const = 0;
 
 		UC_NODISCARD virtual Shared<Resource> load(const Context& context) = 0;
@@ -59,12 +59,12 @@ namespace unicore
 	{
 		struct Empty
 		{
-			bool operator()(const Path& path) const { return path.empty(); }
+			bool operator()(PathView path) const { return path.empty(); }
 		};
 
 		struct NotEmpty
 		{
-			bool operator()(const Path& path) const { return !path.empty(); }
+			bool operator()(PathView path) const { return !path.empty(); }
 		};
 
 		struct Extension
@@ -74,7 +74,7 @@ namespace unicore
 			explicit Extension(const std::initializer_list<StringView> extension_)
 				: extension(extension_) {}
 
-			bool operator()(const Path& path) const
+			bool operator()(PathView path) const
 			{
 				return extension.find(path.extension()) != extension.end();
 			}
@@ -119,7 +119,7 @@ namespace unicore
 			return _type_policy();
 		}
 
-		UC_NODISCARD bool can_load(const Path& path) const override
+		UC_NODISCARD bool can_load(PathView path) const override
 		{
 			return _path_policy(path);
 		}
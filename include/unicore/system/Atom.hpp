@@ -0,0 +1,64 @@
+#pragma once
+#include "unicore/experimental/HashString.hpp"
+
+namespace unicore
+{
+	// Interned string. Equal strings share the same 32-bit id, so atoms
+	// are compared and hashed as integers. Table is global and thread-safe,
+	// interned strings live until the end of program.
+	class Atom
+	{
+	public:
+		// Empty string
+		constexpr Atom() = default;
+
+		explicit Atom(StringView str);
+
+		UC_NODISCARD constexpr UInt32 id() const { return _id; }
+		UC_NODISCARD constexpr Bool empty() const { return _id == 0; }
+
+		UC_NODISCARD StringView str() const;
+		UC_NODISCARD HashString hash() const;
+
+		// Atom of already interned string, does not add new one
+		UC_NODISCARD static Optional<Atom> find(StringView str);
+
+		UC_NODISCARD static Size count();
+
+		static const Atom Empty;
+
+	protected:
+		UInt32 _id = 0;
+
+		constexpr explicit Atom(UInt32 id) : _id(id) {}
+	};
+
+	static constexpr bool operator==(const Atom& a, const Atom& b)
+	{
+		return a.id() == b.id();
+	}
+
+	static constexpr bool operator!=(const Atom& a, const Atom& b)
+	{
+		return a.id() != b.id();
+	}
+
+	static constexpr bool operator<(const Atom& a, const Atom& b)
+	{
+		return a.id() < b.id();
+	}
+
+	extern UNICODE_STRING_BUILDER_FORMAT(const Atom&);
+}
+
+namespace std
+{
+	template<>
+	struct hash<unicore::Atom>
+	{
+		size_t operator()(const unicore::Atom& value) const noexcept
+		{
+			return value.id();
+		}
+	};
+}
\ No newline at end of file
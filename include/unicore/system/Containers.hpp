@@ -1,6 +1,7 @@
 #pragma once
 #include "unicore/system/Utility.hpp"
 #include "unicore/io/Path.hpp"
+#include "unicore/system/Atom.hpp"
 
 namespace unicore
 {
@@ -107,7 +108,8 @@ namespace unicore
 		}
 	}
 
-	//
+	// Entries are keyed by atom of path, path that was never
+	// interned is rejected without any string compare
 	template<typename DataType>
 	class CachedPathData
 	{
@@ -115,12 +117,18 @@ namespace unicore
 		//using DataType = intptr_t;
 		//virtual ~CachedPathData() = default;
 
-		UC_NODISCARD bool contains(const Path& path) const
+		UC_NODISCARD bool contains(Atom path) const
 		{
 			return _entries.find(path) != _entries.end();
 		}
 
-		UC_NODISCARD Optional<DataType> find_data(const Path& path) const
+		UC_NODISCARD bool contains(PathView path) const
+		{
+			const auto atom = Atom::find(path.data());
+			return atom.has_value() && contains(atom.value());
+		}
+
+		UC_NODISCARD Optional<DataType> find_data(Atom path) const
 		{
 			auto it = _entries.find(path);
 			if (it != _entries.end())
@@ -129,12 +137,22 @@ namespace unicore
 			return std::nullopt;
 		}
 
+		UC_NODISCARD Optional<DataType> find_data(PathView path) const
+		{
+			if (const auto atom = Atom::find(path.data()); atom.has_value())
+				return find_data(atom.value());
+
+			return std::nullopt;
+		}
+
+		// Path is interned to global Atom table and stays there until
+		// program end, lookups only use Atom::find and intern nothing
 		void add_entry(const Path& path, const DataType& data)
 		{
-			_entries.emplace(path, data);
+			_entries.emplace(Atom(path.data()), data);
 		}
 
 	protected:
-		Dictionary<Path, DataType> _entries;
+		HashDictionary<Atom, DataType> _entries;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,407 @@
+#pragma once
+#include "unicore/Defs.hpp"
+#include <cstddef>
+#include <new>
+
+namespace unicore
+{
+	template<typename Signature>
+	class Delegate;
+
+	// Callable with inline storage for small captures (this, references,
+	// a few values), larger callables fall back to heap allocation.
+	// Member functions are bound without any allocation with bind().
+	template<typename Ret, typename... Args>
+	class Delegate<Ret(Args...)>
+	{
+	public:
+		static constexpr Size InlineSize = sizeof(void*) * 4;
+
+		Delegate() noexcept = default;
+		Delegate(std::nullptr_t) noexcept {}
+
+		template<typename F, std::enable_if_t<
+			!std::is_same_v<std::decay_t<F>, Delegate> &&
+			std::is_invocable_r_v<Ret, std::decay_t<F>&, Args...>>* = nullptr>
+		Delegate(F&& func)
+		{
+			using T = std::decay_t<F>;
+
+			if constexpr (is_inline<T>())
+			{
+				new (_storage) T(std::forward<F>(func));
+				_invoke = &invoke_inline<T>;
+				if constexpr (!std::is_trivially_copyable_v<T>)
+					_manage = &manage_inline<T>;
+			}
+			else
+			{
+				new (_storage) T*(new T(std::forward<F>(func)));
+				_invoke = &invoke_heap<T>;
+				_manage = &manage_heap<T>;
+			}
+		}
+
+		Delegate(const Delegate& other)
+		{
+			copy_from(other);
+		}
+
+		Delegate(Delegate&& other) noexcept
+		{
+			move_from(other);
+		}
+
+		~Delegate()
+		{
+			reset();
+		}
+
+		Delegate& operator=(const Delegate& other)
+		{
+			if (this != &other)
+			{
+				reset();
+				copy_from(other);
+			}
+			return *this;
+		}
+
+		Delegate& operator=(Delegate&& other) noexcept
+		{
+			if (this != &other)
+			{
+				reset();
+				move_from(other);
+			}
+			return *this;
+		}
+
+		UC_NODISCARD bool empty() const { return _invoke == nullptr; }
+		explicit operator bool() const { return _invoke != nullptr; }
+
+		Ret operator()(Args... args) const
+		{
+			return _invoke(const_cast<Byte*>(_storage), std::forward<Args>(args)...);
+		}
+
+		void reset()
+		{
+			if (_manage)
+				_manage(Operation::Destroy, _storage, nullptr);
+
+			_invoke = nullptr;
+			_manage = nullptr;
+		}
+
+		// Delegate to member function of object
+		template<auto Method, typename T>
+		static Delegate bind(T* object)
+		{
+			Delegate delegate;
+			new (delegate._storage) T*(object);
+			delegate._invoke = [](Byte* storage, Args... args) -> Ret
+			{
+				const auto ptr = *std::launder(reinterpret_cast<T**>(storage));
+				return (ptr->*Method)(std::forward<Args>(args)...);
+			};
+			return delegate;
+		}
+
+		// Delegate to free function
+		template<auto Func>
+		static Delegate bind()
+		{
+			Delegate delegate;
+			delegate._invoke = [](Byte*, Args... args) -> Ret
+			{
+				return Func(std::forward<Args>(args)...);
+			};
+			return delegate;
+		}
+
+	protected:
+		enum class Operation
+		{
+			Copy,
+			Move,
+			Destroy,
+		};
+
+		using InvokeFunc = Ret(*)(Byte*, Args...);
+		using ManageFunc = void(*)(Operation, Byte*, Byte*);
+
+		alignas(std::max_align_t) Byte _storage[InlineSize];
+		InvokeFunc _invoke = nullptr;
+		// Null for trivially copyable content, it is copied as bytes
+		ManageFunc _manage = nullptr;
+
+		template<typename T>
+		static constexpr bool is_inline()
+		{
+			return
+				sizeof(T) <= InlineSize &&
+				alignof(T) <= alignof(std::max_align_t) &&
+				std::is_nothrow_move_constructible_v<T>;
+		}
+
+		template<typename T>
+		static T* get_inline(Byte* storage)
+		{
+			return std::launder(reinterpret_cast<T*>(storage));
+		}
+
+		template<typename T>
+		static T* get_heap(Byte* storage)
+		{
+			return *std::launder(reinterpret_cast<T**>(storage));
+		}
+
+		template<typename T>
+		static Ret invoke_inline(Byte* storage, Args... args)
+		{
+			return (*get_inline<T>(storage))(std::forward<Args>(args)...);
+		}
+
+		template<typename T>
+		static Ret invoke_heap(Byte* storage, Args... args)
+		{
+			return (*get_heap<T>(storage))(std::forward<Args>(args)...);
+		}
+
+		template<typename T>
+		static void manage_inline(Operation operation, Byte* dest, Byte* src)
+		{
+			switch (operation)
+			{
+			case Operation::Copy:
+				new (dest) T(*get_inline<T>(src));
+				break;
+
+			case Operation::Move:
+				new (dest) T(std::move(*get_inline<T>(src)));
+				get_inline<T>(src)->~T();
+				break;
+
+			case Operation::Destroy:
+				get_inline<T>(dest)->~T();
+				break;
+			}
+		}
+
+		template<typename T>
+		static void manage_heap(Operation operation, Byte* dest, Byte* src)
+		{
+			switch (operation)
+			{
+			case Operation::Copy:
+				new (dest) T*(new T(*get_heap<T>(src)));
+				break;
+
+			case Operation::Move:
+				new (dest) T*(get_heap<T>(src));
+				break;
+
+			case Operation::Destroy:
+				delete get_heap<T>(dest);
+				break;
+			}
+		}
+
+		void copy_from(const Delegate& other)
+		{
+			if (other._manage)
+				other._manage(Operation::Copy, _storage, const_cast<Byte*>(other._storage));
+			else std::memcpy(_storage, other._storage, InlineSize);
+
+			_invoke = other._invoke;
+			_manage = other._manage;
+		}
+
+		void move_from(Delegate& other) noexcept
+		{
+			if (other._manage)
+				other._manage(Operation::Move, _storage, other._storage);
+			else std::memcpy(_storage, other._storage, InlineSize);
+
+			_invoke = std::exchange(other._invoke, nullptr);
+			_manage = std::exchange(other._manage, nullptr);
+		}
+	};
+
+	// Stable subscription id, stays valid until removed
+	struct DelegateHandle
+	{
+		UInt32 index = static_cast<UInt32>(-1);
+		UInt32 generation = 0;
+
+		UC_NODISCARD constexpr bool valid() const { return index != static_cast<UInt32>(-1); }
+	};
+
+	// List of delegates with O(1) add and remove by handle.
+	// Delegates can be added and removed while list is invoked,
+	// added ones are called starting from next invoke.
+	template<typename Signature>
+	class DelegateList;
+
+	template<typename Ret, typename... Args>
+	class DelegateList<Ret(Args...)>
+	{
+	public:
+		using DelegateType = Delegate<Ret(Args...)>;
+
+		UC_NODISCARD bool empty() const { return _count == 0; }
+		UC_NODISCARD Size size() const { return _count; }
+
+		DelegateHandle add(DelegateType delegate)
+		{
+			_count++;
+
+			if (!_free.empty())
+			{
+				const auto index = _free.back();
+				_free.pop_back();
+
+				auto& slot = _slots[index];
+				slot.delegate = std::move(delegate);
+				slot.alive = _invoking == 0;
+				slot.added = _invoking > 0;
+				return { index, slot.generation };
+			}
+
+			// Slots can't grow while invoked
+			auto& list = _invoking > 0 ? _pending : _slots;
+			const auto index = static_cast<UInt32>(_slots.size() + _pending.size());
+			list.push_back({ std::move(delegate), 0, _invoking == 0, _invoking > 0 });
+			return { index, 0 };
+		}
+
+		bool remove(DelegateHandle handle)
+		{
+			const auto slot = get_slot(handle);
+			if (slot == nullptr || !(slot->alive || slot->added))
+				return false;
+
+			_count--;
+			slot->alive = false;
+			slot->added = false;
+			slot->generation++;
+
+			// Delegate can be executed right now, it is destroyed after invoke
+			if (_invoking > 0)
+				_released.push_back(handle.index);
+			else
+			{
+				slot->delegate.reset();
+				_free.push_back(handle.index);
+			}
+
+			return true;
+		}
+
+		void clear()
+		{
+			for (UInt32 index = 0; index < _slots.size() + _pending.size(); index++)
+			{
+				const auto& slot = index < _slots.size()
+					? _slots[index] : _pending[index - _slots.size()];
+				if (slot.alive || slot.added)
+					remove({ index, slot.generation });
+			}
+		}
+
+		void invoke(Args... args)
+		{
+			InvokeGuard guard(*this);
+
+			for (Size i = 0, count = _slots.size(); i < count; i++)
+			{
+				if (const auto& slot = _slots[i]; slot.alive)
+					slot.delegate(args...);
+			}
+		}
+
+		// Calls delegates until one of them returns true
+		template<typename R = Ret, std::enable_if_t<std::is_same_v<R, bool>>* = nullptr>
+		bool invoke_until(Args... args)
+		{
+			InvokeGuard guard(*this);
+
+			for (Size i = 0, count = _slots.size(); i < count; i++)
+			{
+				if (const auto& slot = _slots[i]; slot.alive && slot.delegate(args...))
+					return true;
+			}
+
+			return false;
+		}
+
+	protected:
+		struct Slot
+		{
+			DelegateType delegate;
+			UInt32 generation = 0;
+			bool alive = false;
+			// Added while invoked, becomes alive after
+			bool added = false;
+		};
+
+		List<Slot> _slots;
+		List<Slot> _pending;
+		List<UInt32> _free;
+		List<UInt32> _released;
+		UInt32 _invoking = 0;
+		Size _count = 0;
+
+		struct InvokeGuard
+		{
+			explicit InvokeGuard(DelegateList& list)
+				: _list(list)
+			{
+				_list._invoking++;
+			}
+
+			~InvokeGuard()
+			{
+				if (--_list._invoking == 0)
+					_list.apply_changes();
+			}
+
+			DelegateList& _list;
+		};
+
+		Slot* get_slot(DelegateHandle handle)
+		{
+			Slot* slot = nullptr;
+			if (handle.index < _slots.size())
+				slot = &_slots[handle.index];
+			else if (handle.index - _slots.size() < _pending.size())
+				slot = &_pending[handle.index - _slots.size()];
+
+			return slot != nullptr && slot->generation == handle.generation ? slot : nullptr;
+		}
+
+		void apply_changes()
+		{
+			for (auto& slot : _pending)
+				_slots.push_back(std::move(slot));
+			_pending.clear();
+
+			for (auto& slot : _slots)
+			{
+				if (slot.added)
+				{
+					slot.alive = true;
+					slot.added = false;
+				}
+			}
+
+			for (const auto index : _released)
+			{
+				_slots[index].delegate.reset();
+				_free.push_back(index);
+			}
+			_released.clear();
+		}
+	};
+}
\ No newline at end of file
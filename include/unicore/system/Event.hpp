@@ -1,50 +1,60 @@
 #pragma once
-#include "unicore/Defs.hpp"
+#include "unicore/system/Delegate.hpp"
 
 namespace unicore
 {
+	namespace details
+	{
+		template<typename ... Args>
+		struct EventSignature
+		{
+			using Type = void(Args...);
+		};
+
+		template<>
+		struct EventSignature<void>
+		{
+			using Type = void();
+		};
+	}
+
 	template<typename ... Args>
 	class PublicEvent
 	{
 	public:
-		using ActionType = Action<Args...>;
+		using Signature = typename details::EventSignature<Args...>::Type;
+		using ActionType = Delegate<Signature>;
 
 		UC_NODISCARD bool empty() const { return _actions.empty(); }
 
-		void add(const ActionType& action)
+		DelegateHandle add(ActionType action)
+		{
+			return _actions.add(std::move(action));
+		}
+
+		template<auto Method, typename T>
+		DelegateHandle add(T* object)
 		{
-			_actions.push_back(action);
+			return _actions.add(ActionType::template bind<Method>(object));
 		}
 
-		bool remove(const ActionType& action)
+		bool remove(DelegateHandle handle)
 		{
-			// TODO: Fix compile error
-			//for (auto it = _actions.begin(); it != _actions.end(); ++it)
-			//{
-			//	if (*it == action)
-			//	{
-			//		_actions.erase(it);
-			//		return true;
-			//	}
-			//}
-
-			return false;
+			return _actions.remove(handle);
 		}
 
-		PublicEvent& operator+=(const ActionType& action)
+		DelegateHandle operator+=(ActionType action)
 		{
-			add(action);
-			return *this;
+			return add(std::move(action));
 		}
 
-		PublicEvent& operator-=(const ActionType& action)
+		bool operator-=(DelegateHandle handle)
 		{
-			remove(action);
-			return *this;
+			return remove(handle);
 		}
 
 	protected:
-		List<ActionType> _actions;
+		DelegateList<Signature> _actions;
 	};
 
 	template<typename ... Args>
@@ -54,8 +64,7 @@ namespace unicore
 
 		void invoke(Args... args)
 		{
-			for (const auto& action : PublicEvent<Args...>::_actions)
-				action(std::forward<Args>(args)...);
+			PublicEvent<Args...>::_actions.invoke(std::forward<Args>(args)...);
 		}
 
 		void operator()(Args... args)
@@ -71,8 +80,7 @@ namespace unicore
 
 		void invoke()
 		{
-			for (const auto& action : _actions)
-				action();
+			_actions.invoke();
 		}
 
 		void operator()()
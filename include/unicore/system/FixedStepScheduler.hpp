@@ -0,0 +1,54 @@
+#pragma once
+#include "unicore/system/Timer.hpp"
+
+namespace unicore
+{
+	// Splits variable frame time into fixed simulation steps.
+	// Time that does not fit whole step is kept for the next frame,
+	// alpha() is the part of step already passed for interpolation.
+	// Steps per frame are limited by max_steps, time above the limit
+	// is dropped, so slow steps do not make next frames even slower.
+	class FixedStepScheduler
+	{
+	public:
+		static constexpr TimeSpan DefaultStep = TimeSpan::from_microseconds(16667);
+		static constexpr unsigned DefaultMaxSteps = 5;
+
+		explicit FixedStepScheduler(
+			const TimeSpan& step = DefaultStep, unsigned max_steps = DefaultMaxSteps);
+
+		void set_step(const TimeSpan& step);
+		UC_NODISCARD const TimeSpan& step() const { return _step; }
+
+		void set_max_steps(unsigned count);
+		UC_NODISCARD unsigned max_steps() const { return _max_steps; }
+
+		// Total count of executed steps
+		UC_NODISCARD UInt64 tick() const { return _tick; }
+
+		UC_NODISCARD const TimeSpan& accumulator() const { return _accumulator; }
+		UC_NODISCARD const TimeSpan& dropped() const { return _dropped; }
+
+		// Interpolation factor between previous and current step [0..1)
+		UC_NODISCARD Float alpha() const;
+
+		// Measures time since previous call with Timer, returns count of steps.
+		// First call only starts the clock.
+		unsigned update();
+
+		// Adds elapsed time, returns count of steps
+		unsigned advance(const TimeSpan& elapsed);
+
+		void reset();
+
+	protected:
+		TimeSpan _step;
+		unsigned _max_steps;
+
+		TimeSpan _accumulator = TimeSpanConst::Zero;
+		TimeSpan _dropped = TimeSpanConst::Zero;
+		UInt64 _tick = 0;
+
+		Optional<Timer> _last_time;
+	};
+}
\ No newline at end of file
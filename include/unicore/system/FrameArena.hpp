@@ -0,0 +1,133 @@
+#pragma once
+#include "unicore/system/Utility.hpp"
+#include <cstddef>
+
+namespace unicore
+{
+	// Bump allocator for transient data. Memory is taken from big blocks
+	// and returned all at once with rewind or reset, after reset blocks are
+	// merged into one so steady frames do not allocate at all. Not thread
+	// safe, every thread has own arena in current().
+	class FrameArena
+	{
+	public:
+		static constexpr Size DefaultBlockSize = 64 * 1024;
+
+		struct Marker
+		{
+			Size block;
+			Size offset;
+		};
+
+		explicit FrameArena(Size block_size = DefaultBlockSize);
+		~FrameArena();
+
+		UC_TYPE_DELETE_MOVE_COPY(FrameArena);
+
+		UC_NODISCARD void* allocate(Size size, Size align = alignof(std::max_align_t));
+		// Only last allocation is returned, others wait for rewind or reset
+		void deallocate(void* ptr, Size size);
+
+		UC_NODISCARD Marker mark() const { return { _block, _offset }; }
+		void rewind(const Marker& marker);
+
+		// Frees everything, called at end of frame
+		void reset();
+
+		// Bytes from arena start to top, including alignment padding
+		UC_NODISCARD Size used() const;
+		UC_NODISCARD Size capacity() const;
+		// Highest used value since construction
+		UC_NODISCARD Size peak() const;
+
+		// Arena of calling thread, main thread one is reset by RendererApplication
+		UC_NODISCARD static FrameArena& current();
+
+	protected:
+		struct Block
+		{
+			Byte* data;
+			Size size;
+		};
+
+		const Size _block_size;
+		List<Block> _blocks;
+		Size _block = 0;
+		Size _offset = 0;
+		Size _peak = 0;
+
+		void update_peak();
+	};
+
+	// Returns arena to state at construction when leaving the scope.
+	// ArenaList inside of scope have to be destroyed before it.
+	class ArenaScope
+	{
+	public:
+		explicit ArenaScope(FrameArena& arena = FrameArena::current())
+			: _arena(arena), _marker(arena.mark())
+		{
+		}
+
+		~ArenaScope()
+		{
+			_arena.rewind(_marker);
+		}
+
+		UC_TYPE_DELETE_MOVE_COPY(ArenaScope);
+
+		UC_NODISCARD FrameArena& arena() const { return _arena; }
+
+	protected:
+		FrameArena& _arena;
+		const FrameArena::Marker _marker;
+	};
+
+	// std compatible allocator adaptor for FrameArena
+	template<typename T>
+	class ArenaAllocator
+	{
+	public:
+		using value_type = T;
+
+		ArenaAllocator() noexcept
+			: _arena(&FrameArena::current())
+		{
+		}
+
+		ArenaAllocator(FrameArena& arena) noexcept
+			: _arena(&arena)
+		{
+		}
+
+		template<typename U>
+		ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+			: _arena(other.arena())
+		{
+		}
+
+		UC_NODISCARD T* allocate(Size count)
+		{
+			return static_cast<T*>(_arena->allocate(count * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(T* ptr, Size count) noexcept
+		{
+			_arena->deallocate(ptr, count * sizeof(T));
+		}
+
+		UC_NODISCARD FrameArena* arena() const { return _arena; }
+
+		template<typename U>
+		bool operator==(const ArenaAllocator<U>& other) const { return _arena == other.arena(); }
+
+		template<typename U>
+		bool operator!=(const ArenaAllocator<U>& other) const { return _arena != other.arena(); }
+
+	protected:
+		FrameArena* _arena;
+	};
+
+	template<typename T>
+	using ArenaList = std::vector<T, ArenaAllocator<T>>;
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+#include "unicore/platform/Module.hpp"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace unicore
+{
+	// Slot and generation of scheduled job. Slot is reused with next
+	// generation when job is finished, so old handles stay complete.
+	struct JobHandle
+	{
+		UInt32 index = 0;
+		UInt32 generation = 0;
+
+		UC_NODISCARD constexpr Bool valid() const { return generation != 0; }
+	};
+
+	// Runs jobs on worker threads with per-worker work-stealing deques.
+	// Jobs can depend on other jobs and start only when all of them are
+	// finished. Main thread jobs are queued until dispatch_main is called.
+	// Without threads (Emscripten without pthreads) jobs run inline
+	// as soon as they become ready.
+	class JobSystem : public Module
+	{
+		UC_OBJECT(JobSystem, Module)
+	public:
+		using RangeAction = Action<UInt32, UInt32>;
+
+		// Total threads including main, 0 - hardware concurrency
+		explicit JobSystem(unsigned thread_count = 0);
+		~JobSystem() override;
+
+		UC_TYPE_DELETE_MOVE_COPY(JobSystem);
+
+		UC_NODISCARD unsigned worker_count() const { return static_cast<unsigned>(_workers.size()); }
+
+		void register_module(const ModuleContext& context) override;
+		void unregister_module(const ModuleContext& context) override;
+
+		JobHandle schedule(Action<> func, std::initializer_list<JobHandle> dependencies = {});
+		JobHandle schedule_main(Action<> func, std::initializer_list<JobHandle> dependencies = {});
+
+		// Calls func(begin, end) for batches of [0, count) on workers
+		JobHandle schedule_for(UInt32 count, UInt32 batch_size,
+			RangeAction func, std::initializer_list<JobHandle> dependencies = {});
+
+		// Blocking version of schedule_for, calling thread takes part in execution
+		void parallel_for(UInt32 count, UInt32 batch_size, const RangeAction& func);
+
+		UC_NODISCARD Bool is_complete(JobHandle handle) const;
+
+		// Executes other jobs while waiting
+		void wait(JobHandle handle);
+
+		// Executes queued main thread jobs, returns count of executed jobs
+		Size dispatch_main();
+
+	protected:
+		struct Job;
+		struct Worker;
+
+		static constexpr UInt32 BlockSize = 1024;
+		static constexpr UInt32 MaxBlocks = 256;
+		static constexpr UInt32 NoJob = 0xFFFFFFFF;
+
+		Logger* _logger = nullptr;
+		std::thread::id _main_thread;
+
+		// Jobs are allocated in fixed blocks and never move
+		std::atomic<Job*> _blocks[MaxBlocks] = {};
+		std::mutex _alloc_mutex;
+		UInt32 _job_count = 0;
+		UInt32 _free_job = NoJob;
+
+		List<Unique<Worker>> _workers;
+		std::atomic<UInt32> _next_worker{ 0 };
+
+		std::mutex _sleep_mutex;
+		std::condition_variable _sleep_cv;
+		std::atomic<UInt32> _queued{ 0 };
+		std::atomic<UInt32> _sleeping{ 0 };
+		Bool _stop = false;
+
+		std::mutex _main_mutex;
+		List<UInt32> _main_queue;
+
+		UC_NODISCARD Job& get_job(UInt32 index) const;
+
+		UInt32 create_job(Action<> func, Bool main_thread);
+		void free_job(UInt32 index);
+		void add_dependency(UInt32 index, JobHandle dependency);
+		JobHandle submit(UInt32 index);
+
+		void enqueue(UInt32 index);
+		UInt32 pop_job(Optional<UInt32> worker);
+		void execute(UInt32 index);
+		void finish(UInt32 index);
+
+		Bool execute_next(Optional<UInt32> worker);
+		void worker_loop(UInt32 worker);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+#pragma once
+#include "unicore/Defs.hpp"
+
+namespace unicore::Lz4
+{
+	// Raw LZ4 block format (no frame header, no checksum),
+	// compatible with LZ4_compress_default/LZ4_decompress_safe
+
+	// Worst case size of compressed data
+	UC_NODISCARD extern Size compress_bound(Size size);
+
+	// Returns compressed size, 0 if capacity is less than compress_bound(size)
+	extern Size compress(const void* src, Size size, void* dest, Size capacity);
+
+	// Returns false on malformed data or if it doesn't decode exactly to dest_size bytes
+	extern bool decompress(const void* src, Size size, void* dest, Size dest_size);
+}
\ No newline at end of file
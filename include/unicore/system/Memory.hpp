@@ -1,5 +1,5 @@
 #pragma once
-#include "unicore/Defs.hpp"
+#include "unicore/system/MemoryTracker.hpp"
 
 namespace unicore
 {
@@ -10,6 +10,7 @@ namespace unicore
 		typedef void(*FreeFunc)(void*);
 
 		static void* alloc(size_t size);
+		static void* alloc(size_t size, const MemorySite& site);
 		static void* realloc(void* ptr, size_t size);
 		static void free(void* ptr);
 
@@ -21,7 +22,13 @@ namespace unicore
 		static bool equals(const void* ptr1, const void* ptr2, size_t size);
 	};
 
-#define UC_ALLOC(size) Memory::alloc(size)
+#if defined(UNICORE_USE_MEMORY_TRACKING)
+#	define UC_ALLOC(size) Memory::alloc(size, UC_MEMORY_SITE(MemoryCategory::General))
+#	define UC_ALLOC_TAG(size, category) Memory::alloc(size, UC_MEMORY_SITE(category))
+#else
+#	define UC_ALLOC(size) Memory::alloc(size)
+#	define UC_ALLOC_TAG(size, category) Memory::alloc(size)
+#endif
 #define UC_FREE(ptr) Memory::free(ptr)
 
 	class MemoryView
@@ -0,0 +1,107 @@
+#pragma once
+#include "unicore/system/Utility.hpp"
+
+namespace unicore
+{
+	class Logger;
+
+	enum class MemoryCategory : UInt8
+	{
+		General,
+		Resource,
+		Renderer,
+		Text,
+		Logger,
+		UI,
+	};
+	static constexpr UInt8 MemoryCategoryCount = 6;
+
+	extern const char* memory_category_name(MemoryCategory category);
+
+	// Call site of tracked allocation, file has to be string literal
+	struct MemorySite
+	{
+		const char* file = nullptr;
+		UInt32 line = 0;
+		MemoryCategory category = MemoryCategory::General;
+	};
+
+	struct MemoryCounters
+	{
+		UInt64 alloc_count = 0;
+		UInt64 alloc_bytes = 0;
+		UInt64 free_count = 0;
+		UInt64 free_bytes = 0;
+		// Live memory and its highest value
+		UInt64 used_bytes = 0;
+		UInt64 peak_bytes = 0;
+	};
+
+	// Records allocations of Memory and global operator new.
+	// Works only with UNICORE_USE_MEMORY_TRACKING CMake option,
+	// otherwise all counters stay zero.
+	class MemoryTracker
+	{
+	public:
+#if defined(UNICORE_USE_MEMORY_TRACKING)
+		static constexpr Bool enabled = true;
+#else
+		static constexpr Bool enabled = false;
+#endif
+
+		struct SiteInfo
+		{
+			MemorySite site;
+			UInt64 count;
+			UInt64 bytes;
+		};
+
+		// Site of current MemoryScope is used for untagged allocations
+		static void add(void* ptr, Size size);
+		static void add(void* ptr, Size size, const MemorySite& site);
+		// Pointers that were not added are ignored
+		static void remove(void* ptr);
+
+		UC_NODISCARD static MemoryCounters total();
+		UC_NODISCARD static MemoryCounters category(MemoryCategory category);
+
+		// Ends current frame. Counters of frame are allocations between
+		// two last calls, peak is highest used memory during frame.
+		static void mark_frame();
+		UC_NODISCARD static MemoryCounters last_frame();
+		UC_NODISCARD static MemoryCounters last_frame(MemoryCategory category);
+
+		// Appends live allocations grouped by site, largest first
+		static void collect_live(List<SiteInfo>& sites);
+
+		// Logs every site with live allocations, returns count of allocations.
+		// Called at shutdown it shows leaks (and never destroyed globals).
+		static UInt64 dump_leaks(Logger& logger);
+	};
+
+	// Allocations of this thread inside scope without own site
+	// (global operator new, untagged Memory::alloc) get site of scope
+	class MemoryScope
+	{
+	public:
+		explicit MemoryScope(const MemorySite& site);
+		~MemoryScope();
+
+		UC_TYPE_DELETE_MOVE_COPY(MemoryScope);
+
+	protected:
+		const MemorySite _site;
+		const MemorySite* _prev;
+	};
+}
+
+#if defined(UNICORE_USE_MEMORY_TRACKING)
+#	define UC_MEMORY_SITE(category) unicore::MemorySite{ __FILE__, __LINE__, category }
+#	define UC_MEMORY_SCOPE(category) \
+		const unicore::MemoryScope UNICORE_CONCAT(uc_memory_scope_, __LINE__)(UC_MEMORY_SITE(category))
+#	define UC_MEMORY_FRAME() unicore::MemoryTracker::mark_frame()
+#else
+#	define UC_MEMORY_SITE(category) unicore::MemorySite{}
+#	define UC_MEMORY_SCOPE(category) ((void)0)
+#	define UC_MEMORY_FRAME() ((void)0)
+#endif
\ No newline at end of file
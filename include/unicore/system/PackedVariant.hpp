@@ -0,0 +1,445 @@
+#pragma once
+#include "unicore/system/Variant.hpp"
+#include <atomic>
+#include <new>
+
+namespace unicore
+{
+	// Compact 16 byte alternative of Variant for large collections of values.
+	// Numbers, vectors, small colors and strings up to InlineSize bytes are
+	// stored inline and copied as plain bytes. Other values are kept in
+	// shared immutable box with reference counter.
+	class PackedVariant
+	{
+	public:
+		// Same order as Variant::DataType alternatives
+		enum class Type : UInt8
+		{
+			Bool, Int, Int64, Float, Double,
+			String, String32,
+			Vector2i, Vector2f, Vector3i, Vector3f,
+			Rangei, Rangef, Recti, Rectf,
+			Color3b, Color3f, Color4b, Color4f,
+			Object,
+		};
+
+		static constexpr Size InlineSize = 14;
+
+		PackedVariant() noexcept = default;
+
+		PackedVariant(Bool value) noexcept { set_inline(Type::Bool, value); }
+		PackedVariant(Int value) noexcept { set_inline(Type::Int, value); }
+		PackedVariant(Int64 value) noexcept { set_inline(Type::Int64, value); }
+		PackedVariant(Float value) noexcept { set_inline(Type::Float, value); }
+		PackedVariant(Double value) noexcept { set_inline(Type::Double, value); }
+
+		// Same alternative as Variant chooses for integral type
+		template<typename T, std::enable_if_t<std::is_integral_v<T> &&
+			!std::is_same_v<T, Bool> && !std::is_same_v<T, Int> && !std::is_same_v<T, Int64>>* = nullptr>
+		PackedVariant(T value) noexcept
+		{
+			if constexpr (sizeof(T) < sizeof(Int) || (std::is_signed_v<T> && sizeof(T) == sizeof(Int)))
+				set_inline(Type::Int, static_cast<Int>(value));
+			else set_inline(Type::Int64, static_cast<Int64>(value));
+		}
+
+		template<typename T, std::enable_if_t<std::is_enum_v<T>>* = nullptr>
+		PackedVariant(T enum_value) noexcept
+			: PackedVariant(static_cast<std::underlying_type_t<T>>(enum_value)) {}
+
+		PackedVariant(const Char* value);
+		PackedVariant(StringView value);
+		PackedVariant(const String& value) : PackedVariant(StringView(value)) {}
+		PackedVariant(const Char32* value);
+		PackedVariant(StringView32 value);
+		PackedVariant(const String32& value) : PackedVariant(StringView32(value)) {}
+
+		PackedVariant(const Vector2i& value) noexcept { set_inline(Type::Vector2i, value); }
+		PackedVariant(const Vector2f& value) noexcept { set_inline(Type::Vector2f, value); }
+		PackedVariant(const Vector3i& value) noexcept { set_inline(Type::Vector3i, value); }
+		PackedVariant(const Vector3f& value) noexcept { set_inline(Type::Vector3f, value); }
+		PackedVariant(const Rangei& value) noexcept { set_inline(Type::Rangei, value); }
+		PackedVariant(const Rangef& value) noexcept { set_inline(Type::Rangef, value); }
+		PackedVariant(const Recti& value);
+		PackedVariant(const Rectf& value);
+		PackedVariant(const Color3b& value) noexcept { set_inline(Type::Color3b, value); }
+		PackedVariant(const Color3f& value) noexcept { set_inline(Type::Color3f, value); }
+		PackedVariant(const Color4b& value) noexcept { set_inline(Type::Color4b, value); }
+		PackedVariant(const Color4f& value);
+		PackedVariant(const Shared<Object>& value);
+
+		template<typename T, std::enable_if_t<std::is_base_of_v<Object, T>>* = nullptr>
+		PackedVariant(const Shared<T>& object)
+			: PackedVariant(std::static_pointer_cast<Object>(object)) {}
+
+		explicit PackedVariant(const Variant& value);
+
+		PackedVariant(const PackedVariant& other) noexcept
+		{
+			copy_from(other);
+			add_reference();
+		}
+
+		PackedVariant(PackedVariant&& other) noexcept
+		{
+			copy_from(other);
+			other.set_inline(Type::Bool, false);
+		}
+
+		~PackedVariant()
+		{
+			release();
+		}
+
+		PackedVariant& operator=(const PackedVariant& other) noexcept
+		{
+			if (this != &other)
+			{
+				other.add_reference();
+				release();
+				copy_from(other);
+			}
+			return *this;
+		}
+
+		PackedVariant& operator=(PackedVariant&& other) noexcept
+		{
+			if (this != &other)
+			{
+				release();
+				copy_from(other);
+				other.set_inline(Type::Bool, false);
+			}
+			return *this;
+		}
+
+		UC_NODISCARD Type type() const { return _type; }
+		UC_NODISCARD Bool is_boxed() const { return _length == BoxedLength; }
+
+		UC_NODISCARD Variant to_variant() const;
+
+		// RAW GET /////////////////////////////////////////////////////////////////
+		template<typename T>
+		bool try_get_raw(T& value) const
+		{
+			if constexpr (std::is_same_v<T, String>)
+			{
+				StringView view;
+				if (!try_get_string(view))
+					return false;
+
+				value = String(view);
+				return true;
+			}
+			else if constexpr (std::is_same_v<T, String32>)
+			{
+				StringView32 view;
+				if (!try_get_string32(view))
+					return false;
+
+				value = String32(view);
+				return true;
+			}
+			else if constexpr (std::is_same_v<T, Shared<Object>>)
+			{
+				return try_get_object(value);
+			}
+			else
+			{
+				if (_type != type_of<T>())
+					return false;
+
+				if constexpr (is_inline<T>())
+					value = read_inline<T>();
+				else value = read_boxed<T>();
+				return true;
+			}
+		}
+
+		template<typename T>
+		T get_raw(T default_value = {}) const
+		{
+			T value;
+			return try_get_raw(value) ? value : default_value;
+		}
+
+		// BOOL ////////////////////////////////////////////////////////////////////
+		UC_NODISCARD Bool is_bool() const { return _type == Type::Bool; }
+		UC_NODISCARD Bool try_get_bool(Bool& value) const;
+		UC_NODISCARD Bool get_bool(Bool default_value = false) const;
+
+		// INTEGRAL ////////////////////////////////////////////////////////////////
+		UC_NODISCARD Bool is_int() const { return _type == Type::Int; }
+		UC_NODISCARD Bool is_int64() const { return _type == Type::Int64; }
+		UC_NODISCARD Bool is_integral() const { return is_int() || is_int64(); }
+
+		template<typename T,
+			std::enable_if_t<std::is_integral_v<T>>* = nullptr>
+		bool try_get_integral(T& value) const
+		{
+			if (_type == Type::Int)
+			{
+				value = static_cast<T>(read_inline<Int>());
+				return true;
+			}
+
+			if (_type == Type::Int64)
+			{
+				value = static_cast<T>(read_inline<Int64>());
+				return true;
+			}
+
+			return false;
+		}
+
+		template<typename T,
+			std::enable_if_t<std::is_integral_v<T>>* = nullptr>
+		T get_integral(T default_value = {}) const
+		{
+			T value;
+			return try_get_integral(value) ? value : default_value;
+		}
+
+		// FLOATING POINT //////////////////////////////////////////////////////////
+		UC_NODISCARD Bool is_float() const { return _type == Type::Float; }
+		UC_NODISCARD Bool is_double() const { return _type == Type::Double; }
+		UC_NODISCARD Bool is_floating_point() const { return is_float() || is_double(); }
+
+		template<typename T,
+			std::enable_if_t<std::is_floating_point_v<T>>* = nullptr>
+		bool try_get_floating_point(T& value) const
+		{
+			if (_type == Type::Float)
+			{
+				value = static_cast<T>(read_inline<Float>());
+				return true;
+			}
+
+			if (_type == Type::Double)
+			{
+				value = static_cast<T>(read_inline<Double>());
+				return true;
+			}
+
+			return false;
+		}
+
+		template<typename T,
+			std::enable_if_t<std::is_floating_point_v<T>>* = nullptr>
+		T get_floating_point(T default_value = {}) const
+		{
+			T value;
+			return try_get_floating_point(value) ? value : default_value;
+		}
+
+		// ENUM ////////////////////////////////////////////////////////////////////
+		template<typename T,
+			std::enable_if_t<std::is_enum_v<T>>* = nullptr>
+		bool try_get_enum(T& value) const
+		{
+			std::underlying_type_t<T> i;
+			if (try_get_integral(i))
+			{
+				value = static_cast<T>(i);
+				return true;
+			}
+
+			return false;
+		}
+
+		template<typename T,
+			std::enable_if_t<std::is_enum_v<T>>* = nullptr>
+		T get_enum(T default_value = static_cast<T>(0)) const
+		{
+			T value;
+			return try_get_enum(value) ? value : default_value;
+		}
+
+		// NUMBERS /////////////////////////////////////////////////////////////////
+		UC_NODISCARD bool try_get_int(Int& value) const;
+		UC_NODISCARD Int get_int(Int default_value = 0) const;
+
+		UC_NODISCARD bool try_get_int64(Int64& value) const;
+		UC_NODISCARD Int64 get_int64(Int64 default_value = 0) const;
+
+		UC_NODISCARD bool try_get_float(Float& value) const;
+		UC_NODISCARD Float get_float(Float default_value = 0) const;
+
+		UC_NODISCARD bool try_get_double(Double& value) const;
+		UC_NODISCARD Double get_double(Double default_value = 0) const;
+
+		// STRING //////////////////////////////////////////////////////////////////
+		UC_NODISCARD Bool is_string() const { return _type == Type::String; }
+		UC_NODISCARD bool try_get_string(StringView& value) const;
+		UC_NODISCARD bool try_get_string(String& value) const;
+		UC_NODISCARD String get_string(StringView default_value = "") const;
+
+		UC_NODISCARD Bool is_string32() const { return _type == Type::String32; }
+		UC_NODISCARD bool try_get_string32(StringView32& value) const;
+		UC_NODISCARD bool try_get_string32(String32& value) const;
+		UC_NODISCARD String32 get_string32(StringView32 default_value = U"") const;
+
+		UC_NODISCARD Bool is_any_string() const { return is_string() || is_string32(); }
+
+		// OBJECT //////////////////////////////////////////////////////////////////
+		UC_NODISCARD Bool is_object() const { return _type == Type::Object; }
+
+		bool try_get_object(Shared<Object>& value) const;
+		UC_NODISCARD Shared<Object> get_object(const Shared<Object>& default_value = nullptr) const;
+
+		template<typename T, std::enable_if_t<std::is_base_of_v<Object, T>>* = nullptr>
+		bool try_get_object_cast(Shared<T>& value) const
+		{
+			Shared<Object> object;
+			if (try_get_object(object))
+			{
+				if (auto converted = std::dynamic_pointer_cast<T>(object))
+				{
+					value = converted;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		// UNIVERSAL GET ///////////////////////////////////////////////////////////
+		// Exact and numeric types are read directly,
+		// other conversions are done by Variant
+		template<typename T>
+		Bool try_get(T& value) const
+		{
+			if constexpr (std::is_same_v<T, Bool>)
+				return try_get_bool(value);
+			else if constexpr (std::is_integral_v<T>)
+				return try_get_integral(value);
+			else if constexpr (std::is_floating_point_v<T>)
+				return try_get_floating_point(value);
+			else if constexpr (std::is_same_v<T, String>)
+				return try_get_string(value);
+			else if constexpr (std::is_same_v<T, String32>)
+				return try_get_string32(value);
+			else return try_get_raw(value) || to_variant().try_get(value);
+		}
+
+		template<typename T>
+		T get(const T& default_value = {}) const
+		{
+			T value;
+			return try_get(value) ? value : default_value;
+		}
+
+		UC_NODISCARD Bool equals(const PackedVariant& other) const;
+		UC_NODISCARD Bool equals(const Variant& other) const;
+
+		static const PackedVariant Empty;
+
+	protected:
+		static constexpr UInt8 BoxedLength = 0xFF;
+
+		struct Box
+		{
+			std::atomic<UInt32> references = 1;
+		};
+
+		template<typename T>
+		struct BoxValue;
+
+		alignas(8) Byte _data[InlineSize] = {};
+		// Inline string length or BoxedLength
+		UInt8 _length = 0;
+		Type _type = Type::Bool;
+
+		template<typename T>
+		static constexpr Type type_of()
+		{
+			if constexpr (std::is_same_v<T, Bool>) return Type::Bool;
+			else if constexpr (std::is_same_v<T, Int>) return Type::Int;
+			else if constexpr (std::is_same_v<T, Int64>) return Type::Int64;
+			else if constexpr (std::is_same_v<T, Float>) return Type::Float;
+			else if constexpr (std::is_same_v<T, Double>) return Type::Double;
+			else if constexpr (std::is_same_v<T, Vector2i>) return Type::Vector2i;
+			else if constexpr (std::is_same_v<T, Vector2f>) return Type::Vector2f;
+			else if constexpr (std::is_same_v<T, Vector3i>) return Type::Vector3i;
+			else if constexpr (std::is_same_v<T, Vector3f>) return Type::Vector3f;
+			else if constexpr (std::is_same_v<T, Rangei>) return Type::Rangei;
+			else if constexpr (std::is_same_v<T, Rangef>) return Type::Rangef;
+			else if constexpr (std::is_same_v<T, Recti>) return Type::Recti;
+			else if constexpr (std::is_same_v<T, Rectf>) return Type::Rectf;
+			else if constexpr (std::is_same_v<T, Color3b>) return Type::Color3b;
+			else if constexpr (std::is_same_v<T, Color3f>) return Type::Color3f;
+			else if constexpr (std::is_same_v<T, Color4b>) return Type::Color4b;
+			else if constexpr (std::is_same_v<T, Color4f>) return Type::Color4f;
+			else static_assert(sizeof(T) == 0, "Type is not supported");
+		}
+
+		template<typename T>
+		static constexpr bool is_inline()
+		{
+			return
+				sizeof(T) <= InlineSize && alignof(T) <= 8 &&
+				std::is_trivially_destructible_v<T>;
+		}
+
+		template<typename T>
+		void set_inline(Type type, const T& value)
+		{
+			static_assert(is_inline<T>());
+			std::memset(_data, 0, InlineSize);
+			new (_data) T(value);
+			_length = 0;
+			_type = type;
+		}
+
+		template<typename T>
+		UC_NODISCARD const T& read_inline() const
+		{
+			return *std::launder(reinterpret_cast<const T*>(_data));
+		}
+
+		UC_NODISCARD Box* box() const
+		{
+			Box* ptr;
+			std::memcpy(&ptr, _data, sizeof(Box*));
+			return ptr;
+		}
+
+		template<typename T>
+		UC_NODISCARD const T& read_boxed() const;
+
+		template<typename T>
+		void set_boxed(Type type, const T& value);
+
+		void copy_from(const PackedVariant& other)
+		{
+			std::memcpy(_data, other._data, InlineSize);
+			_length = other._length;
+			_type = other._type;
+		}
+
+		void add_reference() const
+		{
+			if (is_boxed())
+				box()->references.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		void release();
+
+		template<typename Func>
+		decltype(auto) visit(Func func) const;
+	};
+
+	static_assert(sizeof(PackedVariant) == 16);
+
+	static bool operator==(const PackedVariant& a, const PackedVariant& b)
+	{
+		return a.equals(b);
+	}
+
+	static bool operator!=(const PackedVariant& a, const PackedVariant& b)
+	{
+		return !a.equals(b);
+	}
+
+	extern UNICODE_STRING_BUILDER_FORMAT(const PackedVariant&);
+}
\ No newline at end of file
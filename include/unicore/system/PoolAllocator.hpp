@@ -0,0 +1,84 @@
+#pragma once
+#include "unicore/system/Memory.hpp"
+#include <cstddef>
+
+namespace unicore
+{
+	// Pool of equal T slots. Freed slots are kept in free list and reused,
+	// memory is taken by chunks of ChunkSize slots and released only with
+	// the pool (objects still alive are not destroyed). Not thread safe.
+	template<typename T, Size ChunkSize = 64>
+	class PoolAllocator
+	{
+		static_assert(ChunkSize > 0, "Chunk size must be positive");
+		static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported");
+	public:
+		PoolAllocator() = default;
+
+		~PoolAllocator()
+		{
+			for (const auto chunk : _chunks)
+				Memory::free(chunk);
+		}
+
+		UC_TYPE_DELETE_MOVE_COPY(PoolAllocator);
+
+		UC_NODISCARD Size used() const { return _used; }
+		UC_NODISCARD Size capacity() const { return _chunks.size() * ChunkSize; }
+
+		UC_NODISCARD T* allocate()
+		{
+			if (_free == nullptr)
+				grow();
+
+			const auto slot = _free;
+			_free = slot->next;
+			_used++;
+			return reinterpret_cast<T*>(slot->storage);
+		}
+
+		void deallocate(T* ptr) noexcept
+		{
+			const auto slot = reinterpret_cast<Slot*>(ptr);
+			slot->next = _free;
+			_free = slot;
+			_used--;
+		}
+
+		template<typename ... Args>
+		UC_NODISCARD T* create(Args&& ... args)
+		{
+			return new (allocate()) T(std::forward<Args>(args)...);
+		}
+
+		void destroy(T* ptr)
+		{
+			ptr->~T();
+			deallocate(ptr);
+		}
+
+	protected:
+		union Slot
+		{
+			Slot* next;
+			alignas(T) Byte storage[sizeof(T)];
+		};
+
+		Slot* _free = nullptr;
+		List<Slot*> _chunks;
+		Size _used = 0;
+
+		void grow()
+		{
+			const auto chunk = static_cast<Slot*>(UC_ALLOC(sizeof(Slot) * ChunkSize));
+			_chunks.push_back(chunk);
+
+			// First slot of chunk is given first
+			for (Size i = ChunkSize; i > 0; i--)
+			{
+				chunk[i - 1].next = _free;
+				_free = &chunk[i - 1];
+			}
+		}
+	};
+}
\ No newline at end of file
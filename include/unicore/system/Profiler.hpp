@@ -0,0 +1,84 @@
+#pragma once
+#include "unicore/system/Timer.hpp"
+#include "unicore/system/Utility.hpp"
+
+namespace unicore
+{
+	class WriteFileProvider;
+	class Path;
+
+	// Records named time zones of every thread. Each thread writes into
+	// own ring buffer without locks, old zones are overwritten.
+	// Zone names have to be string literals (never freed).
+	class Profiler
+	{
+	public:
+		static constexpr UInt32 ZoneCapacity = 16 * 1024;
+		static constexpr UInt32 FrameCapacity = 1024;
+
+		struct Zone
+		{
+			const char* name;
+			// Nanoseconds since profiler start
+			Int64 begin;
+			Int64 end;
+			UInt32 depth;
+			UInt32 thread;
+		};
+
+		// Nanoseconds since profiler start
+		static Int64 now();
+
+		static UInt32 enter();
+		static void leave(const char* name, Int64 begin, UInt32 depth);
+
+		// Marks start of new frame
+		static void mark_frame();
+
+		static void set_thread_name(StringView name);
+
+		// Appends zones that ended after time, sorted by thread and begin
+		static void collect(List<Zone>& zones, Int64 time = 0);
+		// Appends start times of last frames, oldest first
+		static void collect_frames(List<Int64>& frames);
+		// Appends names of threads, index is Zone::thread
+		static void collect_threads(List<String>& names);
+
+		// Writes recorded zones in Chrome trace event format (chrome://tracing)
+		static Bool write_chrome_trace(WriteFileProvider& provider, const Path& path);
+	};
+
+	class ProfilerScope
+	{
+	public:
+		explicit ProfilerScope(const char* name)
+			: _name(name), _depth(Profiler::enter()), _begin(Profiler::now())
+		{
+		}
+
+		~ProfilerScope()
+		{
+			Profiler::leave(_name, _begin, _depth);
+		}
+
+		UC_TYPE_DELETE_MOVE_COPY(ProfilerScope);
+
+	protected:
+		const char* _name;
+		const UInt32 _depth;
+		const Int64 _begin;
+	};
+}
+
+#if defined(UNICORE_USE_PROFILER)
+#	define UC_PROFILE_SCOPE(name) \
+		const unicore::ProfilerScope UNICORE_CONCAT(uc_profile_scope_, __LINE__)(name)
+#	define UC_PROFILE_FUNCTION() UC_PROFILE_SCOPE(__func__)
+#	define UC_PROFILE_FRAME() unicore::Profiler::mark_frame()
+#	define UC_PROFILE_THREAD(name) unicore::Profiler::set_thread_name(name)
+#else
+#	define UC_PROFILE_SCOPE(name) ((void)0)
+#	define UC_PROFILE_FUNCTION() ((void)0)
+#	define UC_PROFILE_FRAME() ((void)0)
+#	define UC_PROFILE_THREAD(name) ((void)0)
+#endif
\ No newline at end of file
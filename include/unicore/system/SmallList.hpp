@@ -0,0 +1,182 @@
+#pragma once
+#include "unicore/Defs.hpp"
+
+namespace unicore
+{
+	// List with inline storage for first N elements,
+	// allocates only when it grows beyond N
+	template<typename T, Size N>
+	class SmallList
+	{
+		static_assert(N > 0, "Inline capacity must be positive");
+	public:
+		using value_type = T;
+		using iterator = T*;
+		using const_iterator = const T*;
+
+		SmallList() noexcept = default;
+
+		SmallList(std::initializer_list<T> list)
+		{
+			reserve(list.size());
+			for (const auto& value : list)
+				push_back(value);
+		}
+
+		SmallList(const SmallList& other)
+		{
+			reserve(other._size);
+			std::uninitialized_copy(other.begin(), other.end(), _data);
+			_size = other._size;
+		}
+
+		SmallList(SmallList&& other) noexcept
+		{
+			move_from(other);
+		}
+
+		~SmallList()
+		{
+			clear();
+			release();
+		}
+
+		SmallList& operator=(const SmallList& other)
+		{
+			if (this != &other)
+			{
+				clear();
+				reserve(other._size);
+				std::uninitialized_copy(other.begin(), other.end(), _data);
+				_size = other._size;
+			}
+			return *this;
+		}
+
+		SmallList& operator=(SmallList&& other) noexcept
+		{
+			if (this != &other)
+			{
+				clear();
+				release();
+				move_from(other);
+			}
+			return *this;
+		}
+
+		UC_NODISCARD Size size() const { return _size; }
+		UC_NODISCARD Size capacity() const { return _capacity; }
+		UC_NODISCARD bool empty() const { return _size == 0; }
+		UC_NODISCARD bool is_inline() const { return _data == inline_data(); }
+
+		UC_NODISCARD T* data() { return _data; }
+		UC_NODISCARD const T* data() const { return _data; }
+
+		UC_NODISCARD iterator begin() { return _data; }
+		UC_NODISCARD iterator end() { return _data + _size; }
+		UC_NODISCARD const_iterator begin() const { return _data; }
+		UC_NODISCARD const_iterator end() const { return _data + _size; }
+
+		UC_NODISCARD T& operator[](Size index) { return _data[index]; }
+		UC_NODISCARD const T& operator[](Size index) const { return _data[index]; }
+
+		UC_NODISCARD T& back() { return _data[_size - 1]; }
+		UC_NODISCARD const T& back() const { return _data[_size - 1]; }
+
+		void reserve(Size capacity)
+		{
+			if (capacity > _capacity)
+				reallocate(capacity);
+		}
+
+		template<typename... Args>
+		T& emplace_back(Args&&... args)
+		{
+			if (_size == _capacity)
+				reallocate(_capacity * 2);
+
+			const auto ptr = new (_data + _size) T(std::forward<Args>(args)...);
+			_size++;
+			return *ptr;
+		}
+
+		void push_back(const T& value) { emplace_back(value); }
+		void push_back(T&& value) { emplace_back(std::move(value)); }
+
+		template<typename... Args>
+		iterator emplace(const_iterator pos, Args&&... args)
+		{
+			const auto index = pos - _data;
+			emplace_back(std::forward<Args>(args)...);
+			std::rotate(_data + index, _data + _size - 1, _data + _size);
+			return _data + index;
+		}
+
+		iterator insert(const_iterator pos, const T& value) { return emplace(pos, value); }
+		iterator insert(const_iterator pos, T&& value) { return emplace(pos, std::move(value)); }
+
+		iterator erase(const_iterator pos)
+		{
+			const auto index = pos - _data;
+			std::move(_data + index + 1, _data + _size, _data + index);
+			pop_back();
+			return _data + index;
+		}
+
+		void pop_back()
+		{
+			_data[--_size].~T();
+		}
+
+		void clear()
+		{
+			std::destroy(_data, _data + _size);
+			_size = 0;
+		}
+
+	protected:
+		alignas(T) Byte _storage[sizeof(T) * N];
+		T* _data = inline_data();
+		Size _size = 0;
+		Size _capacity = N;
+
+		UC_NODISCARD T* inline_data() { return reinterpret_cast<T*>(_storage); }
+		UC_NODISCARD const T* inline_data() const { return reinterpret_cast<const T*>(_storage); }
+
+		void reallocate(Size capacity)
+		{
+			const auto data = std::allocator<T>().allocate(capacity);
+			std::uninitialized_move(_data, _data + _size, data);
+			std::destroy(_data, _data + _size);
+			release();
+
+			_data = data;
+			_capacity = capacity;
+		}
+
+		void release()
+		{
+			if (!is_inline())
+				std::allocator<T>().deallocate(_data, _capacity);
+
+			_data = inline_data();
+			_capacity = N;
+		}
+
+		void move_from(SmallList& other)
+		{
+			if (other.is_inline())
+			{
+				std::uninitialized_move(other.begin(), other.end(), _data);
+				_size = other._size;
+				other.clear();
+			}
+			else
+			{
+				_data = std::exchange(other._data, other.inline_data());
+				_size = std::exchange(other._size, 0);
+				_capacity = std::exchange(other._capacity, N);
+			}
+		}
+	};
+}
\ No newline at end of file
@@ -1,18 +1,32 @@
 #pragma once
 #include "unicore/system/StringHelper.hpp"
 #include "unicore/system/Unicode.hpp"
+#include <charconv>
 
 namespace unicore
 {
+	// Text builder with inline buffer, allocates only when text
+	// does not fit InlineCapacity. Text is always null-terminated.
 	class StringBuilder
 	{
 	public:
-		String data;
+		static constexpr Size InlineCapacity = 256;
 
-		StringBuilder() noexcept = default;
-		StringBuilder(const StringBuilder& other) noexcept = default;
+		StringBuilder() noexcept { _inline[0] = 0; }
+		StringBuilder(const StringBuilder& other);
 		StringBuilder(StringBuilder&& other) noexcept;
-		~StringBuilder() = default;
+		~StringBuilder();
+
+		UC_NODISCARD Size size() const { return _size; }
+		UC_NODISCARD Size capacity() const { return _capacity - 1; }
+		UC_NODISCARD Bool empty() const { return _size == 0; }
+
+		UC_NODISCARD const Char* c_str() const { return _data; }
+		UC_NODISCARD StringView view() const { return { _data, _size }; }
+		UC_NODISCARD String str() const { return { _data, _size }; }
+
+		void clear();
+		void reserve(Size capacity);
 
 		void append(char c);
 		void append(Char16 c);
@@ -22,7 +36,21 @@ namespace unicore
 		void append(StringView16 text);
 		void append(StringView32 text);
 
-		StringBuilder& operator=(const StringBuilder& other) noexcept = default;
+		template<typename T,
+			std::enable_if_t<std::is_integral_v<T>>* = nullptr>
+		void append_integer(T value, int base = 10)
+		{
+			Char buffer[sizeof(T) * 8 + 1];
+			const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value, base);
+			append(StringView(buffer, result.ptr - buffer));
+		}
+
+		void append_float(Double value, int precision = 2);
+
+		// Zero padded lowercase hex
+		void append_hex(UInt64 value, Size digits = 16);
+
+		StringBuilder& operator=(const StringBuilder& other);
 		StringBuilder& operator=(StringBuilder&& other) noexcept;
 
 		template<typename ... Args>
@@ -30,34 +58,68 @@ namespace unicore
 		{
 			StringBuilder builder;
 			internal_format(builder, format, args...);
-			return builder.data;
+			return builder.str();
 		}
 
 		template<typename ... Args>
 		static StringW format(StringViewW format, const Args& ... args)
 		{
-			// TODO: Optimize (Rewrite without Unicode methods)
 			StringBuilder builder;
 			internal_format(builder, Unicode::to_utf8(format), args...);
-			return Unicode::to_wcs(builder.data);
+			return Unicode::to_wcs(builder.view());
 		}
 
 		template<typename ... Args>
 		static String16 format(StringView16 format, const Args& ... args)
 		{
-			// TODO: Optimize (Rewrite without Unicode methods)
-			StringBuilder builder;
-			internal_format(builder, Unicode::to_utf8(format), args...);
-			return Unicode::to_utf16(builder.data);
+			String16 str;
+			format_to(str, format, args...);
+			return str;
 		}
 
 		template<typename ... Args>
 		static String32 format(StringView32 format, const Args& ... args)
 		{
-			// TODO: Optimize (Rewrite without Unicode methods)
+			String32 str;
+			format_to(str, format, args...);
+			return str;
+		}
+
+		// Appends formatted text to builder
+		template<typename ... Args>
+		static void format_to(StringBuilder& builder, StringView format, const Args& ... args)
+		{
+			internal_format(builder, format, args...);
+		}
+
+		// Writes formatted text to buffer, text is truncated if it does not fit.
+		// Returns length of written text without null terminator.
+		template<typename ... Args>
+		static Size format_to(Char* buffer, Size buffer_size, StringView format, const Args& ... args)
+		{
 			StringBuilder builder;
-			internal_format(builder, Unicode::to_utf8(format), args...);
-			return Unicode::to_utf32(builder.data);
+			internal_format(builder, format, args...);
+			return builder.copy_to(buffer, buffer_size);
+		}
+
+		// Replaces content of str, existing capacity is reused
+		template<typename ... Args>
+		static void format_to(String16& str, StringView16 format, const Args& ... args)
+		{
+			StringBuilder builder;
+			internal_format(builder, StringBuilder(format).view(), args...);
+			str.clear();
+			Unicode::append(builder.view(), str, Unicode::ConvertMode::Replace);
+		}
+
+		// Replaces content of str, existing capacity is reused
+		template<typename ... Args>
+		static void format_to(String32& str, StringView32 format, const Args& ... args)
+		{
+			StringBuilder builder;
+			internal_format(builder, StringBuilder(format).view(), args...);
+			str.clear();
+			Unicode::append(builder.view(), str, Unicode::ConvertMode::Replace);
 		}
 
 		static String quoted(StringView text, Char delim = '\"')
@@ -66,32 +128,50 @@ namespace unicore
 			builder.append(delim);
 			builder.append(text);
 			builder.append(delim);
-			return builder.data;
+			return builder.str();
 		}
 
 		static String16 quoted(StringView16 text, Char16 delim = '\"')
 		{
-			// TODO: Optimize (Rewrite without Unicode methods)
-			StringBuilder builder;
-			builder.append(delim);
-			builder.append(text);
-			builder.append(delim);
-			return Unicode::to_utf16(StringView(builder.data));
+			String16 str;
+			str.reserve(text.size() + 2);
+			str.push_back(delim);
+			str.append(text);
+			str.push_back(delim);
+			return str;
 		}
 
 		static String32 quoted(StringView32 text, Char32 delim = '\"')
 		{
-			// TODO: Optimize (Rewrite without Unicode methods)
-			StringBuilder builder;
-			builder.append(delim);
-			builder.append(text);
-			builder.append(delim);
-			return Unicode::to_utf32(StringView(builder.data));
+			String32 str;
+			str.reserve(text.size() + 2);
+			str.push_back(delim);
+			str.append(text);
+			str.push_back(delim);
+			return str;
 		}
 
 	protected:
 		static constexpr StringView Elem = "{}";
 
+		Char _inline[InlineCapacity];
+		Char* _data = _inline;
+		Size _size = 0;
+		Size _capacity = InlineCapacity;
+
+		template<typename TChar>
+		explicit StringBuilder(BasicStringView<TChar> text)
+			: StringBuilder()
+		{
+			append(text);
+		}
+
+		// Returns place for count characters at the end of text
+		Char* grow(Size count);
+		void release();
+
+		Size copy_to(Char* buffer, Size buffer_size) const;
+
 		static void internal_format(StringBuilder& builder, StringView value)
 		{
 			builder.append(value);
@@ -158,22 +238,23 @@ namespace unicore
 	template<typename T, std::enable_if_t<std::is_enum_v<T>>* = nullptr>
 	extern StringBuilder& operator<<(StringBuilder& builder, T value)
 	{
-		const auto tmp = static_cast<int>(value);
-		const auto str = std::to_string(tmp);
-		return builder << str.c_str();
+		builder.append_integer(static_cast<int>(value));
+		return builder;
 	}
 
 	template<typename T, std::enable_if_t<std::is_pointer_v<T>>* = nullptr>
 	extern StringBuilder& operator<<(StringBuilder& builder, T value)
 	{
-		return builder << "0x" << StringHelper::to_hex(reinterpret_cast<intptr_t>(value));
+		builder.append("0x");
+		builder.append_hex(reinterpret_cast<uintptr_t>(value), sizeof(value) * 2);
+		return builder;
 	}
 
 	template<typename T, std::enable_if_t<std::is_integral_v<T>>* = nullptr>
 	extern StringBuilder& operator<<(StringBuilder& builder, T value)
 	{
-		const auto str = std::to_string(value);
-		return builder << str.c_str();
+		builder.append_integer(value);
+		return builder;
 	}
 
 	template<typename T>
@@ -1,5 +1,6 @@
 #pragma once
 #include "unicore/math/Vector2.hpp"
+#include "unicore/system/FrameArena.hpp"
 
 namespace unicore
 {
@@ -19,6 +20,13 @@ namespace unicore
 		//Vector2f offset = VectorConst2f::Zero;
 	};
 
+	// Line pointing into parsed text, for layouts that live one call
+	struct TextLineView
+	{
+		StringView32 text;
+		Vector2f size = VectorConst2f::Zero;
+	};
+
 	class TextBlock
 	{
 	public:
@@ -28,14 +36,20 @@ namespace unicore
 		UC_NODISCARD const List<TextLine>& lines() const { return _lines; }
 
 		static void parse_lines(StringView32 text_, List<TextLine>& lines);
+		static void parse_lines(StringView32 text, ArenaList<TextLineView>& lines);
 
 		static void calc_line_size(const Font& font, List<TextLine>& lines);
+		static void calc_line_size(const Font& font, ArenaList<TextLineView>& lines);
 
 		static Vector2f calc_align_offset(const Vector2f& size, TextAlign align);
 		static Vector2f calc_align_offset(const Font& font, StringView32 text, TextAlign align);
 
 		static void calc_align_offset(const List<TextLine>& lines,
 			TextAlign align, List<Vector2f>& offset_list, bool round = true);
+		static void calc_align_offset(const List<TextLine>& lines,
+			TextAlign align, ArenaList<Vector2f>& offset_list, bool round = true);
+		static void calc_align_offset(const ArenaList<TextLineView>& lines,
+			TextAlign align, ArenaList<Vector2f>& offset_list, bool round = true);
 
 	protected:
 		Shared<Font> _font;
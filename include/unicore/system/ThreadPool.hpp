@@ -0,0 +1,48 @@
+#pragma once
+#include "unicore/Defs.hpp"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace unicore
+{
+	// Fixed set of worker threads for data parallel loops.
+	// Runs everything on the calling thread when threads are unavailable.
+	class ThreadPool
+	{
+	public:
+		// Total threads including caller, 0 - hardware concurrency
+		explicit ThreadPool(unsigned thread_count = 0);
+		~ThreadPool();
+
+		UC_TYPE_DELETE_MOVE_COPY(ThreadPool);
+
+		UC_NODISCARD unsigned thread_count() const { return static_cast<unsigned>(_threads.size()) + 1; }
+
+		// Call func(index) for every index in [0, count) and wait for completion.
+		// Caller thread takes part in execution. Calls are serialized.
+		void parallel_for(unsigned count, const Action<unsigned>& func);
+
+		static unsigned hardware_concurrency();
+
+	protected:
+		List<std::thread> _threads;
+
+		std::mutex _call_mutex;
+		std::mutex _mutex;
+		std::condition_variable _start_cv;
+		std::condition_variable _done_cv;
+
+		const Action<unsigned>* _func = nullptr;
+		unsigned _count = 0;
+		UInt64 _generation = 0;
+		unsigned _active = 0;
+		bool _stop = false;
+
+		std::atomic<unsigned> _next{ 0 };
+
+		void execute();
+		void worker_loop();
+	};
+}
\ No newline at end of file
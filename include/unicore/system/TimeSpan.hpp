@@ -38,7 +38,7 @@ namespace unicore
 
 		UC_NODISCARD constexpr TimeSpan sub(const TimeSpan& other) const
 		{
-			return TimeSpan(_data + other._data);
+			return TimeSpan(_data - other._data);
 		}
 
 		UC_NODISCARD constexpr uint64_t total_milliseconds() const
@@ -48,7 +48,7 @@ namespace unicore
 
 		UC_NODISCARD constexpr double total_seconds() const
 		{
-			return static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(_data).count()) / 1000;
+			return std::chrono::duration<double>(_data).count();
 		}
 
 		TimeSpan& operator += (const TimeSpan& ts)
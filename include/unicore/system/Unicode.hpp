@@ -3,6 +3,37 @@
 
 namespace unicore::Unicode
 {
+	enum class ConvertMode
+	{
+		// Fail on invalid sequence
+		Strict,
+		// Replace invalid sequence with ReplacementChar
+		Replace,
+	};
+
+	static constexpr Char32 ReplacementChar = 0xFFFD;
+
+	extern Bool validate(StringView str);
+	extern Bool validate(StringView16 str);
+	extern Bool validate(StringView32 str);
+
+	// Exact size of UTF-8 text, invalid characters are counted as ReplacementChar
+	extern Size utf8_size(StringView16 from);
+	extern Size utf8_size(StringView32 from);
+
+	// Writes utf8_size() bytes to out, invalid characters are replaced
+	extern Size write_utf8(StringView16 from, Char* out);
+	extern Size write_utf8(StringView32 from, Char* out);
+
+	// Append converted string to the end of existing one.
+	// On failure in Strict mode destination is left unchanged.
+	extern Bool append(StringView32 from, String& to, ConvertMode mode = ConvertMode::Strict);
+	extern Bool append(StringView32 from, String16& to, ConvertMode mode = ConvertMode::Strict);
+	extern Bool append(StringView16 from, String& to, ConvertMode mode = ConvertMode::Strict);
+	extern Bool append(StringView16 from, String32& to, ConvertMode mode = ConvertMode::Strict);
+	extern Bool append(StringView from, String16& to, ConvertMode mode = ConvertMode::Strict);
+	extern Bool append(StringView from, String32& to, ConvertMode mode = ConvertMode::Strict);
+
 	extern bool try_convert(StringView32 from, String16& to);
 	extern bool try_convert(StringView32 from, StringW& to);
 	extern bool try_convert(StringView32 from, String& to);
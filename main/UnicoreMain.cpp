@@ -1,5 +1,6 @@
 #include "UnicoreMain.hpp"
 #include "unicore/app/RendererApplication.hpp"
+#include "unicore/system/MemoryTracker.hpp"
 
 #if defined(UNICORE_USE_SDL2_MAIN)
 #	include <SDL_main.h>
@@ -14,9 +15,9 @@ namespace unicore
 		Unique<Application> app;
 		RendererApplication* core_render = nullptr;
 
-		State()
+		explicit State(const List<String>& args)
 			: platform(Platform::create())
-			, app(create_main_core({ *platform }))
+			, app(create_main_core({ *platform, args }))
 			, core_render(dynamic_cast<RendererApplication*>(app.get()))
 		{
 		}
@@ -31,15 +32,23 @@ namespace unicore
 
 	static State* g_state = nullptr;
 
-	void state_init()
+	void state_init(const List<String>& args)
 	{
-		g_state = new State();
+		g_state = new State(args);
 		g_state->app->init();
 	}
 
-	void state_done()
+	int state_done()
 	{
+		const auto exit_code = g_state->app->exit_code();
 		delete g_state;
+
+#if defined(UNICORE_USE_MEMORY_TRACKING)
+		PrintLogger logger;
+		MemoryTracker::dump_leaks(logger);
+#endif
+
+		return exit_code;
 	}
 
 	bool state_running()
@@ -55,7 +64,11 @@ namespace unicore
 
 int main(int argc, char* argv[])
 {
-	unicore::state_init();
+	unicore::List<unicore::String> args;
+	for (int i = 1; i < argc; i++)
+		args.emplace_back(argv[i]);
+
+	unicore::state_init(args);
 
 #if defined(UNICORE_PLATFORM_EMSCRIPTEN)
 	emscripten_set_main_loop(unicore::state_frame, 0, 1);
@@ -64,6 +77,5 @@ int main(int argc, char* argv[])
 		unicore::state_frame();
 #endif
 
-	unicore::state_done();
-	return 0;
+	return unicore::state_done();
 }
\ No newline at end of file
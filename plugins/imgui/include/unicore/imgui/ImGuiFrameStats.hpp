@@ -0,0 +1,18 @@
+#pragma once
+#include "unicore/renderer/FrameStats.hpp"
+
+namespace unicore
+{
+	// Window with summary, graph and histogram of FrameStats
+	class ImGuiFrameStats
+	{
+	public:
+		// Has to be called between ImGuiContext frame_begin and frame_end
+		void render(const FrameStats& stats, bool* open = nullptr);
+
+	protected:
+		List<float> _values;
+		FrameStats::Histogram _histogram{};
+		Array<float, FrameStats::HistogramSize> _buckets{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+#include "unicore/system/MemoryTracker.hpp"
+#include "unicore/system/StringBuilder.hpp"
+
+namespace unicore
+{
+	class ResourceCache;
+
+	// Window with MemoryTracker counters per category and largest live sites.
+	// With cache system memory of loaded resources is shown for comparison.
+	class ImGuiMemoryStats
+	{
+	public:
+		UC_NODISCARD Size site_limit() const { return _site_limit; }
+		void set_site_limit(Size value) { _site_limit = value; }
+
+		// Has to be called between ImGuiContext frame_begin and frame_end
+		void render(const ResourceCache* cache = nullptr, bool* open = nullptr);
+
+	protected:
+		Size _site_limit = 16;
+		List<MemoryTracker::SiteInfo> _sites;
+		StringBuilder _builder;
+
+		void text_memory(UInt64 bytes);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+#include "unicore/system/Profiler.hpp"
+
+namespace unicore
+{
+	// Flame view of last complete frame recorded by Profiler.
+	// Every thread has own lane, nested zones are drawn below parent.
+	class ImGuiProfiler
+	{
+	public:
+		UC_NODISCARD Bool paused() const { return _paused; }
+		void set_paused(Bool value) { _paused = value; }
+
+		// Has to be called between ImGuiContext frame_begin and frame_end
+		void render(bool* open = nullptr);
+
+	protected:
+		Bool _paused = false;
+
+		Int64 _frame_begin = 0;
+		Int64 _frame_end = 0;
+
+		List<Profiler::Zone> _zones;
+		List<Int64> _frames;
+		List<String> _threads;
+
+		void update_zones();
+	};
+}
\ No newline at end of file
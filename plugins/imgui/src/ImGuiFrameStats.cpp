@@ -0,0 +1,109 @@
+#include "unicore/imgui/ImGuiFrameStats.hpp"
+#include "unicore/imgui/ImGuiDefs.hpp"
+#include "unicore/math/Math.hpp"
+#include <cfloat>
+
+namespace unicore
+{
+	static double to_milliseconds(const TimeSpan& time)
+	{
+		return static_cast<double>(time.data().count()) / 1000000.0;
+	}
+
+	static void summary_row(const char* name, const FrameStats::Summary& summary)
+	{
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGui::TextUnformatted(name);
+
+		for (const auto& value : { summary.min, summary.avg, summary.p50, summary.p95, summary.p99, summary.max })
+		{
+			ImGui::TableNextColumn();
+			ImGui::Text("%.2f", to_milliseconds(value));
+		}
+	}
+
+	void ImGuiFrameStats::render(const FrameStats& stats, bool* open)
+	{
+		if (!ImGui::Begin("Frame stats", open))
+		{
+			ImGui::End();
+			return;
+		}
+
+		if (stats.empty())
+		{
+			ImGui::TextUnformatted("No frames recorded");
+			ImGui::End();
+			return;
+		}
+
+		const auto& last = stats.last();
+		ImGui::Text("FPS: %.1f, frames: %u/%u", static_cast<double>(stats.fps()),
+			stats.size(), stats.capacity());
+		ImGui::Text("Draw calls: %u, vertices: %u, texture switches: %u",
+			last.render.draw_calls, last.render.vertices, last.render.texture_switches);
+
+		// Summary, ms
+		if (ImGui::BeginTable("summary", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+		{
+			for (const auto name : { "ms", "min", "avg", "p50", "p95", "p99", "max" })
+				ImGui::TableSetupColumn(name);
+			ImGui::TableHeadersRow();
+
+			summary_row("frame", stats.summary(&FrameSample::frame));
+			summary_row("update", stats.summary(&FrameSample::update));
+			summary_row("draw", stats.summary(&FrameSample::draw));
+			summary_row("interval", stats.summary(&FrameSample::interval));
+
+			ImGui::EndTable();
+		}
+
+		// Frame time graph
+		_values.resize(stats.size());
+		float max_value = 0;
+		for (UInt32 i = 0; i < stats.size(); i++)
+		{
+			_values[i] = static_cast<float>(to_milliseconds(stats.get(i).frame));
+			max_value = Math::max(max_value, _values[i]);
+		}
+
+		const auto width = ImGui::GetContentRegionAvail().x;
+		ImGui::PlotLines("##frame", _values.data(), static_cast<int>(_values.size()),
+			0, "Frame, ms", 0, max_value, ImVec2(width, 80));
+
+		// Log histogram, bucket width grows with time
+		stats.histogram(_histogram);
+		UInt32 last_bucket = 0;
+		for (UInt32 i = 0; i < FrameStats::HistogramSize; i++)
+		{
+			_buckets[i] = static_cast<float>(_histogram[i]);
+			if (_histogram[i] > 0)
+				last_bucket = i;
+		}
+
+		ImGui::PlotHistogram("##histogram", _buckets.data(), static_cast<int>(last_bucket + 1),
+			0, "Frame histogram", 0, FLT_MAX, ImVec2(width, 80));
+		if (ImGui::IsItemHovered())
+		{
+			const auto min = ImGui::GetItemRectMin();
+			const auto bucket_width = ImGui::GetItemRectSize().x / static_cast<float>(last_bucket + 1);
+			const auto index = static_cast<UInt32>((ImGui::GetIO().MousePos.x - min.x) / bucket_width);
+			if (index <= last_bucket)
+			{
+				const auto from = index > 0 ? FrameStats::bucket_limit(index - 1) : TimeSpanConst::Zero;
+				if (index + 1 < FrameStats::HistogramSize)
+				{
+					ImGui::SetTooltip("%.2f - %.2f ms: %u", to_milliseconds(from),
+						to_milliseconds(FrameStats::bucket_limit(index)), _histogram[index]);
+				}
+				else
+				{
+					ImGui::SetTooltip(">= %.2f ms: %u", to_milliseconds(from), _histogram[index]);
+				}
+			}
+		}
+
+		ImGui::End();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include "unicore/imgui/ImGuiMemoryStats.hpp"
+#include "unicore/imgui/ImGuiDefs.hpp"
+#include "unicore/resource/ResourceCache.hpp"
+#include "unicore/system/Memory.hpp"
+#include "unicore/system/FrameArena.hpp"
+
+namespace unicore
+{
+	void ImGuiMemoryStats::render(const ResourceCache* cache, bool* open)
+	{
+		if (!ImGui::Begin("Memory", open))
+		{
+			ImGui::End();
+			return;
+		}
+
+		// Arena of main thread is available without tracking
+		const auto& arena = FrameArena::current();
+		ImGui::TextUnformatted("Frame arena:");
+		ImGui::SameLine();
+		text_memory(arena.capacity());
+		ImGui::SameLine();
+		ImGui::TextUnformatted("peak:");
+		ImGui::SameLine();
+		text_memory(arena.peak());
+
+		if (!MemoryTracker::enabled)
+		{
+			ImGui::TextUnformatted("Build with UNICORE_USE_MEMORY_TRACKING to track allocations");
+			ImGui::End();
+			return;
+		}
+
+		const auto total = MemoryTracker::total();
+		const auto frame = MemoryTracker::last_frame();
+
+		ImGui::TextUnformatted("Used:");
+		ImGui::SameLine();
+		text_memory(total.used_bytes);
+		ImGui::SameLine();
+		ImGui::TextUnformatted("peak:");
+		ImGui::SameLine();
+		text_memory(total.peak_bytes);
+
+		ImGui::Text("Last frame: %llu allocations, %llu frees",
+			static_cast<unsigned long long>(frame.alloc_count),
+			static_cast<unsigned long long>(frame.free_count));
+
+		if (cache)
+		{
+			size_t system = 0;
+			cache->calc_memory_use(&system, nullptr);
+
+			ImGui::TextUnformatted("Resources (cache):");
+			ImGui::SameLine();
+			text_memory(system);
+		}
+
+		// Categories
+		if (ImGui::BeginTable("categories", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+		{
+			for (const auto name : { "Category", "Used", "Peak", "Allocs/frame", "Bytes/frame" })
+				ImGui::TableSetupColumn(name);
+			ImGui::TableHeadersRow();
+
+			for (UInt8 i = 0; i < MemoryCategoryCount; i++)
+			{
+				const auto category = static_cast<MemoryCategory>(i);
+				const auto counters = MemoryTracker::category(category);
+				const auto frame_counters = MemoryTracker::last_frame(category);
+
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(memory_category_name(category));
+				ImGui::TableNextColumn();
+				text_memory(counters.used_bytes);
+				ImGui::TableNextColumn();
+				text_memory(counters.peak_bytes);
+				ImGui::TableNextColumn();
+				ImGui::Text("%llu", static_cast<unsigned long long>(frame_counters.alloc_count));
+				ImGui::TableNextColumn();
+				text_memory(frame_counters.alloc_bytes);
+			}
+
+			ImGui::EndTable();
+		}
+
+		// Largest live sites
+		if (ImGui::CollapsingHeader("Live sites"))
+		{
+			_sites.clear();
+			MemoryTracker::collect_live(_sites);
+
+			if (ImGui::BeginTable("sites", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+			{
+				for (const auto name : { "Site", "Category", "Count", "Used" })
+					ImGui::TableSetupColumn(name);
+				ImGui::TableHeadersRow();
+
+				for (Size i = 0; i < _sites.size() && i < _site_limit; i++)
+				{
+					const auto& info = _sites[i];
+
+					ImGui::TableNextRow();
+					ImGui::TableNextColumn();
+					if (info.site.file)
+						ImGui::Text("%s:%u", info.site.file, info.site.line);
+					else
+						ImGui::TextUnformatted("<scope>");
+					ImGui::TableNextColumn();
+					ImGui::TextUnformatted(memory_category_name(info.site.category));
+					ImGui::TableNextColumn();
+					ImGui::Text("%llu", static_cast<unsigned long long>(info.count));
+					ImGui::TableNextColumn();
+					text_memory(info.bytes);
+				}
+
+				ImGui::EndTable();
+			}
+		}
+
+		ImGui::End();
+	}
+
+	void ImGuiMemoryStats::text_memory(UInt64 bytes)
+	{
+		_builder.clear();
+		_builder << MemorySize{ bytes };
+
+		const auto view = _builder.view();
+		ImGui::TextUnformatted(view.data(), view.data() + view.size());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include "unicore/imgui/ImGuiProfiler.hpp"
+#include "unicore/imgui/ImGuiDefs.hpp"
+#include "unicore/math/Math.hpp"
+#include "unicore/experimental/HashString.hpp"
+#include <algorithm>
+
+namespace unicore
+{
+	static ImU32 zone_color(const char* name)
+	{
+		// Same name always gets same color
+		const auto hash = HashString::calc_value(name);
+
+		return IM_COL32(
+			96 + (hash & 0x7F),
+			96 + ((hash >> 8) & 0x7F),
+			96 + ((hash >> 16) & 0x7F), 255);
+	}
+
+	void ImGuiProfiler::render(bool* open)
+	{
+		if (!ImGui::Begin("Profiler", open))
+		{
+			ImGui::End();
+			return;
+		}
+
+		if (!_paused)
+			update_zones();
+
+		ImGui::Checkbox("Pause", &_paused);
+		ImGui::SameLine();
+
+		if (_frame_end <= _frame_begin)
+		{
+			ImGui::TextUnformatted("No frames recorded");
+			ImGui::End();
+			return;
+		}
+
+		const auto frame_time = static_cast<Float>(_frame_end - _frame_begin);
+		ImGui::Text("Frame: %.3f ms, zones: %u",
+			static_cast<double>(frame_time / 1000000.f), static_cast<unsigned>(_zones.size()));
+
+		const auto draw_list = ImGui::GetWindowDrawList();
+		const auto origin = ImGui::GetCursorScreenPos();
+		const auto width = Math::max(ImGui::GetContentRegionAvail().x, 100.f);
+		const auto row_height = ImGui::GetTextLineHeightWithSpacing();
+		const auto text_color = IM_COL32(0, 0, 0, 255);
+		const auto scale = width / frame_time;
+
+		float lane_y = origin.y;
+		for (UInt32 thread = 0; thread < _threads.size(); thread++)
+		{
+			UInt32 max_depth = 0;
+			Bool has_zones = false;
+
+			for (const auto& zone : _zones)
+			{
+				if (zone.thread != thread)
+					continue;
+
+				has_zones = true;
+				max_depth = Math::max(max_depth, zone.depth);
+
+				const auto x0 = origin.x + static_cast<Float>(Math::max(zone.begin, _frame_begin) - _frame_begin) * scale;
+				const auto x1 = origin.x + static_cast<Float>(Math::min(zone.end, _frame_end) - _frame_begin) * scale;
+				const auto y0 = lane_y + row_height * static_cast<Float>(zone.depth + 1);
+
+				const ImVec2 min(x0, y0);
+				const ImVec2 max(Math::max(x1, x0 + 1), y0 + row_height - 1);
+
+				draw_list->AddRectFilled(min, max, zone_color(zone.name));
+
+				if (max.x - min.x > 20)
+				{
+					draw_list->PushClipRect(min, max, true);
+					draw_list->AddText(ImVec2(min.x + 2, min.y), text_color, zone.name);
+					draw_list->PopClipRect();
+				}
+
+				if (ImGui::IsMouseHoveringRect(min, max))
+				{
+					ImGui::SetTooltip("%s\n%.3f ms", zone.name,
+						static_cast<double>(zone.end - zone.begin) / 1000000.0);
+				}
+			}
+
+			if (!has_zones)
+				continue;
+
+			draw_list->AddText(ImVec2(origin.x, lane_y),
+				ImGui::GetColorU32(ImGuiCol_Text), _threads[thread].c_str());
+			lane_y += row_height * static_cast<Float>(max_depth + 2);
+		}
+
+		ImGui::Dummy(ImVec2(width, lane_y - origin.y));
+		ImGui::End();
+	}
+
+	void ImGuiProfiler::update_zones()
+	{
+		_frames.clear();
+		Profiler::collect_frames(_frames);
+
+		// Last frame is not finished yet
+		if (_frames.size() < 2)
+			return;
+
+		_frame_begin = _frames[_frames.size() - 2];
+		_frame_end = _frames[_frames.size() - 1];
+
+		_zones.clear();
+		Profiler::collect(_zones, _frame_begin);
+
+		// Keep only zones that overlap the frame
+		_zones.erase(std::remove_if(_zones.begin(), _zones.end(),
+			[this](const Profiler::Zone& zone) { return zone.begin >= _frame_end; }), _zones.end());
+
+		_threads.clear();
+		Profiler::collect_threads(_threads);
+	}
+}
\ No newline at end of file
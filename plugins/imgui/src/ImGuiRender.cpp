@@ -2,6 +2,7 @@
 #include "unicore/io/Logger.hpp"
 #include "unicore/renderer/Surface.hpp"
 #include "unicore/renderer/Texture.hpp"
+#include "unicore/system/FrameArena.hpp"
 
 namespace unicore
 {
@@ -119,9 +120,8 @@ namespace unicore
 
 					_render.set_clip(r);
 
-					static List<VertexColorTexture2f> s_verts;
-
-					s_verts.resize(pcmd->ElemCount);
+					ArenaScope scope;
+					ArenaList<VertexColorTexture2f> verts(pcmd->ElemCount);
 					for (unsigned i = 0; i < pcmd->ElemCount; i++)
 					{
 						const auto index = idx_buffer[pcmd->IdxOffset + i];
@@ -133,11 +133,11 @@ namespace unicore
 						vertex.uv.x = uv.x;
 						vertex.uv.y = uv.y;
 						vertex.col = Color4b::from_format(pixel_format_abgr, col);
-						s_verts[i] = vertex;
+						verts[i] = vertex;
 					}
 
 					const auto tex = static_cast<Texture*>(pcmd->GetTexID());
-					_render.draw_trianglesf(s_verts.data(), s_verts.size(), tex);
+					_render.draw_trianglesf(verts.data(), verts.size(), tex);
 				}
 			}
 		}
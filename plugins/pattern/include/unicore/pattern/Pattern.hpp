@@ -7,12 +7,16 @@ namespace unicore
 	{
 	public:
 		using ValueType = StdVariant<Int, Int64, Double, String, String32>;
-		using DataType = Dictionary<String32, ValueType>;
+		// Transparent compare, variables are found without copying names
+		using DataType = Dictionary<String32, ValueType, std::less<>>;
 
 		explicit Pattern(StringView32 str, Logger* logger = nullptr);
 
 		UC_NODISCARD String32 execute(const DataType& data = {}) const;
 
+		// Replaces content of result, existing capacity is reused
+		void execute(const DataType& data, String32& result) const;
+
 	protected:
 		Logger* _logger;
 		PatternParser::Data _data;
@@ -9,14 +9,21 @@ namespace unicore
 	}
 
 	String32 Pattern::execute(const DataType& data) const
+	{
+		String32 result;
+		execute(data, result);
+		return result;
+	}
+
+	void Pattern::execute(const DataType& data, String32& result) const
 	{
 		if (_data.tokens.empty())
 		{
 			UC_LOG_ERROR(_logger) << "Trying to execute empty template";
-			return _data.source;
+			result = _data.source;
+			return;
 		}
 
-		// TODO: Optimize
 		StringBuilder builder;
 		for (const auto& token : _data.tokens)
 		{
@@ -27,8 +34,7 @@ namespace unicore
 				break;
 
 			case PatternParser::TokenType::Variable:
-				const String32 key(token.str);
-				if (auto it = data.find(key); it != data.end())
+				if (auto it = data.find(token.str); it != data.end())
 				{
 					std::visit([&](auto&& arg) {
 						using T = std::decay_t<decltype(arg)>;
@@ -45,11 +51,12 @@ namespace unicore
 						//else  static_assert(false, "non-exhaustive visitor!");
 						}, it->second);
 				}
-				else builder << StringBuilder::format(U"[{}]", token.str);
+				else builder << '[' << token.str << ']';
 				break;
 			}
 		}
 
-		return Unicode::to_utf32(builder.data);
+		result.clear();
+		Unicode::append(builder.view(), result, Unicode::ConvertMode::Replace);
 	}
 }
\ No newline at end of file
@@ -2,7 +2,10 @@
 #include "unicore/resource/Resource.hpp"
 #include "unicore/remoteui/Element.hpp"
 #include "unicore/system/Event.hpp"
+#include "unicore/system/Atom.hpp"
 #include "unicore/system/EnumFlag.hpp"
+#include "unicore/system/PackedVariant.hpp"
+#include "unicore/system/SmallList.hpp"
 
 namespace unicore::remoteui
 {
@@ -28,6 +31,11 @@ namespace unicore::remoteui
 		UC_NODISCARD List<Element> get_roots() const;
 
 		// FIND ////////////////////////////////////////////////////////////////////
+		// Tag and name lookups use document indices,
+		// order of found nodes is not specified.
+		// Names are indexed by hash and compared as strings, so documents
+		// with generated names do not grow the global atom table.
+		// Empty name never matches.
 		UC_NODISCARD Element find_by_index(ElementIndex index) const;
 
 		UC_NODISCARD Element find_by_tag(ElementTag tag,
@@ -37,8 +45,12 @@ namespace unicore::remoteui
 
 		UC_NODISCARD Element find_by_name(StringView name,
 			const Element& parent = Element::Empty) const;
+		UC_NODISCARD Element find_by_name(Atom name,
+			const Element& parent = Element::Empty) const;
 		Size find_all_by_name(StringView name, List<Element>& list,
 			const Element& parent = Element::Empty) const;
+		Size find_all_by_name(Atom name, List<Element>& list,
+			const Element& parent = Element::Empty) const;
 
 		UC_NODISCARD Element query(
 			const Predicate<const Element&>& predicate,
@@ -90,7 +102,8 @@ namespace unicore::remoteui
 		// ATTRIBUTES //////////////////////////////////////////////////////////////
 		void set_node_attribute(const Element& node,
 			Attribute attribute, const Variant& value);
-		UC_NODISCARD const Variant& get_node_attribute(const Element& node, Attribute attribute) const;
+		UC_NODISCARD Variant get_node_attribute(const Element& node, Attribute attribute) const;
+		UC_NODISCARD Bool has_node_attribute(const Element& node, Attribute attribute) const;
 
 		UC_NODISCARD Optional<AttributeDict> get_node_attributes(const Element& node) const;
 		UC_NODISCARD Bool get_node_attributes(const Element& node, AttributeDict& dict) const;
@@ -106,23 +119,63 @@ namespace unicore::remoteui
 		Bool unsubscribe_node(const Element& node, UIActionType type);
 
 	protected:
+		struct AttributeValue
+		{
+			Attribute key;
+			PackedVariant value;
+		};
+
+		// Sorted by key, most nodes have only a few attributes
+		using AttributeList = SmallList<AttributeValue, 4>;
+
+		struct NodeChildren
+		{
+			ElementIndex first = ElementIndex_Invalid;
+			ElementIndex last = ElementIndex_Invalid;
+			Size count = 0;
+		};
+
 		struct NodeInfo
 		{
+			UInt16 generation = 0;
+			Bool alive = false;
 			ElementTag tag = ElementTag::Group;
-			// UInt16 sibling_index; ? Optimization
 			ElementIndex parent = ElementIndex_Invalid;
-			AttributeDict attributes;
+			ElementIndex prev_sibling = ElementIndex_Invalid;
+			ElementIndex next_sibling = ElementIndex_Invalid;
+			NodeChildren children;
+			// Node count of whole subtree, without node itself
+			Size descendants = 0;
+			// Position in tag index list
+			Size tag_position = 0;
+			// Hash of Name attribute, valid if node is in name index
+			HashString name_hash;
+			Bool name_indexed = false;
+			// Position in name index list
+			Size name_position = 0;
+			AttributeList attributes;
+			UIActionDict actions;
 		};
 
-		using NodeIndexList = List<ElementIndex>;
+		static constexpr Size TagCount = static_cast<Size>(ElementTag::Input) + 1;
 
 		Logger* _logger;
-		NodeIndexList _roots;
 
-		// TODO: Optimize with list
-		Dictionary<ElementIndex, NodeInfo> _node_infos;
-		Dictionary<ElementIndex, UIActionDict> _node_actions;
-		Dictionary<ElementIndex, NodeIndexList> _node_children;
+		static constexpr UInt16 NodesPerBlock = 256;
+
+		// Slot array in fixed blocks, nodes never move once created.
+		// ElementIndex is slot and generation of the node. Removed slots
+		// are reused with next generation, so old Element values never
+		// resolve to the new node.
+		List<Unique<NodeInfo[]>> _blocks;
+		UInt16 _slot_count = 0;
+		List<UInt16> _free_slots;
+		NodeChildren _roots;
+
+		// Secondary indices for find by name and tag. Names with the
+		// same hash share list, candidates are checked by string.
+		HashDictionary<HashString::ValueType, List<ElementIndex>> _name_index;
+		Array<List<ElementIndex>, TagCount> _tag_index;
 
 		mutable bool _write_protection = false;
 
@@ -142,7 +195,27 @@ namespace unicore::remoteui
 			Bool& _value;
 		};
 
-		ElementIndex::TypeValue _last_index = 0;
+		static constexpr UInt16 index_slot(ElementIndex index)
+		{
+			return static_cast<UInt16>(index.value & 0xFFFF);
+		}
+
+		static constexpr UInt16 index_generation(ElementIndex index)
+		{
+			return static_cast<UInt16>(index.value >> 16);
+		}
+
+		static constexpr ElementIndex make_index(UInt16 slot, UInt16 generation)
+		{
+			return ElementIndex((static_cast<UInt32>(generation) << 16) | slot);
+		}
+
+		// Links between nodes are always valid, no generation check
+		NodeInfo& node_at(ElementIndex index) { return slot_at(index_slot(index)); }
+		UC_NODISCARD const NodeInfo& node_at(ElementIndex index) const { return slot_at(index_slot(index)); }
+
+		NodeInfo& slot_at(UInt16 slot) { return _blocks[slot / NodesPerBlock][slot % NodesPerBlock]; }
+		UC_NODISCARD const NodeInfo& slot_at(UInt16 slot) const { return _blocks[slot / NodesPerBlock][slot % NodesPerBlock]; }
 
 		NodeInfo* get_info(ElementIndex index);
 		UC_NODISCARD const NodeInfo* get_info(ElementIndex index) const;
@@ -153,16 +226,46 @@ namespace unicore::remoteui
 		UIActionDict* get_actions(ElementIndex index);
 		UC_NODISCARD const UIActionDict* get_actions(ElementIndex index) const;
 
-		NodeIndexList* get_children_list(ElementIndex index);
-		UC_NODISCARD const NodeIndexList* get_children_list(ElementIndex index) const;
+		NodeChildren* get_children_list(ElementIndex index);
+		UC_NODISCARD const NodeChildren* get_children_list(ElementIndex index) const;
+
+		void link_child(ElementIndex parent, ElementIndex index, ElementIndex before);
+		void unlink_child(ElementIndex index);
+
+		void add_to_index(ElementIndex index);
+		void remove_from_index(ElementIndex index);
+
+		struct NameKey
+		{
+			StringView value;
+			HashString hash;
+		};
+
+		void add_name_index(ElementIndex index, const PackedVariant& name);
+		void remove_name_index(ElementIndex index);
+
+		UC_NODISCARD const List<ElementIndex>* get_name_candidates(const NameKey& name) const;
+		UC_NODISCARD Bool has_name(ElementIndex index, const NameKey& name) const;
+		UC_NODISCARD Bool is_in_subtree(ElementIndex index, ElementIndex parent) const;
+		// Walk of subtree is faster than filtering of index candidates
+		UC_NODISCARD Bool prefer_subtree_walk(ElementIndex parent, Size candidates) const;
+
+		Bool update_attribute(ElementIndex index, Attribute key, const Variant& value);
+
+		static const PackedVariant* find_attribute(const AttributeList& list, Attribute key);
+		static Bool set_attribute(AttributeList& list, Attribute key, const Variant& value);
+		static void to_attribute_dict(const AttributeList& list, AttributeDict& dict);
 
 		ElementIndex create_index();
 		UC_NODISCARD Element node_from_index(ElementIndex index) const;
 
+		UC_NODISCARD Element internal_find_by_tag(ElementIndex index, ElementTag tag) const;
+		UC_NODISCARD Element internal_find_by_name(ElementIndex index, const NameKey& name) const;
+
 		void internal_find_all_by_tag(ElementIndex index,
 			ElementTag tag, List<Element>& list, Size& count) const;
 		void internal_find_all_by_name(ElementIndex index,
-			StringView name, List<Element>& list, Size& count) const;
+			const NameKey& name, List<Element>& list, Size& count) const;
 
 		Element internal_query(ElementIndex index,
 			const Predicate<const Element&>& predicate) const;
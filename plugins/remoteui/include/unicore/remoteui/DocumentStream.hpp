@@ -0,0 +1,106 @@
+#pragma once
+#include "unicore/remoteui/View.hpp"
+
+namespace unicore::remoteui
+{
+	// Binary delta stream of Document changes. Each frame is a sequence
+	// of commands with varint indices, attribute ids and Variant values.
+	namespace DocumentStream
+	{
+		enum class Command : UInt8
+		{
+			Reset,        // Remove all nodes
+			Create,       // index, parent, tag
+			Remove,       // index
+			Reorder,      // parent, count, children
+			SetAttribute, // index, attribute, value
+		};
+
+		// Variant can't transfer objects, they are written as Empty
+		extern void write_value(List<Byte>& data, const Variant& value);
+		extern Bool read_value(const Byte*& ptr, const Byte* end, Variant& value);
+	}
+
+	// Records changes of document and writes them as one frame on flush.
+	// Repeated writes of the same attribute within a frame are coalesced,
+	// nodes created and removed within a frame are not written at all.
+	class DocumentEncoder : public View
+	{
+	public:
+		struct Stats
+		{
+			Size frames = 0;
+			Size bytes = 0;
+			Size last_frame_bytes = 0;
+			Size coalesced = 0;
+		};
+
+		explicit DocumentEncoder(Logger* logger = nullptr);
+
+		// Appends changes recorded since last flush,
+		// returns false if there were no changes
+		Bool flush(List<Byte>& data);
+
+		// Next flush writes whole document, for newly connected mirror
+		void reset() { on_rebuild(); }
+
+		UC_NODISCARD const Stats& stats() const { return _stats; }
+
+	protected:
+		struct Change
+		{
+			DocumentStream::Command command;
+			ElementIndex index = ElementIndex_Invalid;
+			ElementIndex parent = ElementIndex_Invalid;
+			ElementTag tag = ElementTag::Group;
+			Attribute attribute = Attribute::Type;
+			Variant value;
+			List<ElementIndex> children;
+			Bool skip = false;
+		};
+
+		Logger* _logger;
+		Stats _stats;
+
+		List<Change> _changes;
+		// Change position of attribute value and created nodes in current frame
+		HashDictionary<UInt64, Size> _attribute_changes;
+		HashDictionary<UInt32, Size> _created_nodes;
+
+		static UInt64 attribute_key(ElementIndex index, Attribute attribute)
+		{
+			return (static_cast<UInt64>(index.value) << 8) | static_cast<UInt8>(attribute);
+		}
+
+		void add_node(const Element& node);
+
+		void on_rebuild() override;
+
+		void on_create_node(const Element& node) override;
+		void on_remove_node(const Element& node) override;
+		void on_reorder_children(const Element& node) override;
+		void on_set_attribute(const Element& node, Attribute type, const Optional<Variant>& value) override;
+	};
+
+	// Replays frames of DocumentEncoder into mirror document
+	class DocumentDecoder
+	{
+	public:
+		explicit DocumentDecoder(const Shared<Document>& document, Logger* logger = nullptr);
+
+		UC_NODISCARD const Shared<Document>& document() const { return _document; }
+
+		// Returns false on malformed data, changes before error stay applied
+		Bool apply(const void* data, Size size);
+
+		// Mirror node of source document index
+		UC_NODISCARD Element find_node(ElementIndex index) const;
+
+	protected:
+		Shared<Document> _document;
+		Logger* _logger;
+		HashDictionary<UInt32, Element> _nodes;
+
+		void reset();
+	};
+}
\ No newline at end of file
@@ -110,7 +110,8 @@ namespace unicore::remoteui
 		UIActionDict actions = {};
 	};
 
-	UNICORE_MAKE_INDEX_WITH_INVALID(ElementIndex, UInt16);
+	// Slot in low 16 bits and slot generation in high 16 bits
+	UNICORE_MAKE_INDEX_WITH_INVALID(ElementIndex, UInt32);
 
 	class Document;
 
@@ -0,0 +1,51 @@
+#pragma once
+#include "unicore/Defs.hpp"
+
+namespace unicore::remoteui
+{
+	// Message based connection between document and its remote views
+	class Transport
+	{
+	public:
+		virtual ~Transport() = default;
+
+		UC_NODISCARD virtual Bool connected() const = 0;
+
+		// Queues whole message, returns false if connection is closed
+		virtual Bool send(const void* data, Size size) = 0;
+
+		// Next complete message without blocking,
+		// returns false if there is none yet
+		virtual Bool receive(List<Byte>& message) = 0;
+	};
+
+	// Local connection over socketpair (POSIX) or anonymous pipes (Windows).
+	// Messages are framed with 32-bit length prefix.
+	class PipeTransport : public Transport
+	{
+	public:
+		~PipeTransport() override;
+
+		UC_NODISCARD Bool connected() const override { return _connected; }
+
+		Bool send(const void* data, Size size) override;
+		Bool receive(List<Byte>& message) override;
+
+		// Two connected endpoints
+		static Bool create_pair(Unique<PipeTransport>& first, Unique<PipeTransport>& second);
+
+	protected:
+		PipeTransport(intptr_t read_handle, intptr_t write_handle);
+
+		intptr_t _read_handle;
+		intptr_t _write_handle;
+		Bool _connected = true;
+
+		List<Byte> _input;
+		List<Byte> _output;
+		Size _output_offset = 0;
+
+		void write_pending();
+		void read_available();
+	};
+}
\ No newline at end of file
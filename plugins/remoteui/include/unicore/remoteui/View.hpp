@@ -7,7 +7,7 @@ namespace unicore::remoteui
 	{
 	public:
 		View();
-		virtual ~View() = default;
+		virtual ~View();
 
 		UC_NODISCARD const Shared<Document>& document() const { return _document; }
 		void set_document(const Shared<Document>& document);
@@ -15,11 +15,12 @@ namespace unicore::remoteui
 	protected:
 		Shared<Document> _document;
 
-		const std::function<void(const Element&)> _bind_create_node;
-		const std::function<void(const Element&)> _bind_remove_node;
-		const std::function<void(const Element&)> _bind_reorder_children;
+		DelegateHandle _bind_create_node;
+		DelegateHandle _bind_remove_node;
+		DelegateHandle _bind_reorder_children;
+		DelegateHandle _bind_set_attribute;
 
-		const std::function<void(const Element&, Attribute, const Optional<Variant>&)> _bind_set_attribute;
+		void unsubscribe();
 
 		virtual void on_rebuild() = 0;
 
@@ -60,29 +60,58 @@ namespace unicore::remoteui
 			String id;
 			String title; // text + id;
 			bool mouse_over = false;
+
+			// Decoded attributes, updated only after node changes
+			Bool dirty = true;
+			ElementTag tag = ElementTag::Group;
+			Int type = 0;
+			Bool hidden = false;
+			Bool disabled = false;
+			Float width = 0;
+			Float height = 0;
+			String tooltip;
+
+			// Visible children, updated only after hierarchy changes
+			Bool children_dirty = true;
+			List<Element> children;
 		};
 
-		Dictionary<ElementIndex, CachedInfo> _cached;
+		// Children of clipped groups are expected to have same height
+		static constexpr Size ClipThreshold = 64;
+
+		HashDictionary<UInt32, CachedInfo> _cached;
+		List<Element> _roots;
+		Bool _roots_dirty = true;
 
 		void on_rebuild() override;
 
 		void on_create_node(const Element& node) override;
+		void on_remove_node(const Element& node) override;
+		void on_reorder_children(const Element& node) override;
 		void on_set_attribute(const Element& node,
 			Attribute type, const Optional<Variant>& value) override;
 
+		void set_children_dirty(const Element& node);
+
+		static void update_info(const Element& node, CachedInfo& info);
+		void update_children(const Element& node, List<Element>& children) const;
+
+		void render_children(const List<Element>& children, Size start = 0,
+			LayoutOption layout_option = LayoutOption::None, Bool clip = false);
+
 		Bool render_node(const Element& node, LayoutOption layout_option = LayoutOption::None);
 
-		Bool render_group(const CachedInfo& info, const Element& node,
+		Bool render_group(CachedInfo& info, const Element& node,
 			LayoutOption layout_option = LayoutOption::None);
 
-		Bool render_visual(const CachedInfo& info, const Element& node,
+		Bool render_visual(CachedInfo& info, const Element& node,
 			LayoutOption layout_option = LayoutOption::None);
 
-		Bool render_input(const CachedInfo& info, const Element& node,
+		Bool render_input(CachedInfo& info, const Element& node,
 			LayoutOption layout_option = LayoutOption::None);
 
-		void render_node_header(const Element& node, LayoutOption layout_option);
-		void render_node_footer(const Element& node);
+		void render_node_header(const CachedInfo& info, LayoutOption layout_option);
+		void render_node_footer(CachedInfo& info, const Element& node);
 
 		UC_NODISCARD CachedInfo* get_info(ElementIndex index);
 
@@ -10,9 +10,18 @@ namespace unicore::remoteui
 
 	size_t Document::get_system_memory_use() const
 	{
-		return
+		Size size =
 			sizeof(Document) +
-			(sizeof(NodeInfo) + sizeof(ElementIndex)) * _node_infos.size();
+			sizeof(NodeInfo) * NodesPerBlock * _blocks.size() +
+			sizeof(UInt16) * _free_slots.capacity();
+
+		for (const auto& list : _tag_index)
+			size += sizeof(ElementIndex) * list.capacity();
+
+		for (const auto& [hash, list] : _name_index)
+			size += sizeof(hash) + sizeof(ElementIndex) * list.capacity();
+
+		return size;
 	}
 
 	Size Document::get_roots(List<Element>& list) const
@@ -39,24 +48,23 @@ namespace unicore::remoteui
 		{
 			if (parent.document() != this)
 			{
-				UC_LOG_WARNING(_logger) << "Failed find by id. Parent "
+				UC_LOG_WARNING(_logger) << "Failed find by tag. Parent "
 					<< parent << " from other document";
 				return Element::Empty;
 			}
 
-			const auto& info = get_info(parent.index());
-			if (info->tag == tag)
-				return parent;
+			if (!get_info(parent.index()))
+				return Element::Empty;
 		}
 
-		if (const auto children = get_children_list(parent.index()))
+		const auto& candidates = _tag_index[static_cast<Size>(tag)];
+		if (prefer_subtree_walk(parent.index(), candidates.size()))
+			return internal_find_by_tag(parent.index(), tag);
+
+		for (const auto index : candidates)
 		{
-			for (const auto child_index : *children)
-			{
-				const auto child = node_from_index(child_index);
-				if (auto find = find_by_tag(tag, child); !find.empty())
-					return find;
-			}
+			if (is_in_subtree(index, parent.index()))
+				return node_from_index(index);
 		}
 
 		return Element::Empty;
@@ -68,27 +76,48 @@ namespace unicore::remoteui
 		Size count = 0;
 
 		WriteProtectionGuard guard(_write_protection);
-		if (parent.valid())
+		if (!parent.empty())
 		{
 			if (parent.document() != this)
 			{
-				UC_LOG_WARNING(_logger) << "Failed to find all by type. Parent "
+				UC_LOG_WARNING(_logger) << "Failed to find all by tag. Parent "
 					<< parent << " from other document";
 				return 0;
 			}
 
+			if (!get_info(parent.index()))
+				return 0;
+		}
+
+		const auto& candidates = _tag_index[static_cast<Size>(tag)];
+		if (prefer_subtree_walk(parent.index(), candidates.size()))
+		{
 			internal_find_all_by_tag(parent.index(), tag, list, count);
+			return count;
 		}
-		else
+
+		for (const auto index : candidates)
 		{
-			internal_find_all_by_tag(ElementIndex_Invalid, tag, list, count);
+			if (is_in_subtree(index, parent.index()))
+			{
+				list.push_back(node_from_index(index));
+				count++;
+			}
 		}
 
 		return count;
 	}
 
+	Element Document::find_by_name(Atom name, const Element& parent) const
+	{
+		return find_by_name(name.str(), parent);
+	}
+
 	Element Document::find_by_name(StringView name, const Element& parent) const
 	{
+		if (name.empty())
+			return Element::Empty;
+
 		WriteProtectionGuard guard(_write_protection);
 		if (!parent.empty())
 		{
@@ -99,33 +128,39 @@ namespace unicore::remoteui
 				return Element::Empty;
 			}
 
-			const auto info = get_info(parent.index());
-			if (const auto it = info->attributes.find(Attribute::Name); it != info->attributes.end())
-			{
-				StringView info_name;
-				if (it->second.try_get_string(info_name) &&
-					StringHelper::equals(info_name, name))
-					return parent;
-			}
+			if (!get_info(parent.index()))
+				return Element::Empty;
 		}
 
-		if (const auto children = get_children_list(parent.index()))
+		const NameKey key{ name, HashString(name) };
+		const auto candidates = get_name_candidates(key);
+		if (candidates == nullptr)
+			return Element::Empty;
+
+		if (prefer_subtree_walk(parent.index(), candidates->size()))
+			return internal_find_by_name(parent.index(), key);
+
+		for (const auto index : *candidates)
 		{
-			for (const auto child_index : *children)
-			{
-				const auto child = node_from_index(child_index);
-				if (auto find = find_by_name(name, child); !find.empty())
-					return find;
-			}
+			if (has_name(index, key) && is_in_subtree(index, parent.index()))
+				return node_from_index(index);
 		}
 
 		return Element::Empty;
 	}
 
+	Size Document::find_all_by_name(Atom name,
+		List<Element>& list, const Element& parent) const
+	{
+		return find_all_by_name(name.str(), list, parent);
+	}
+
 	Size Document::find_all_by_name(StringView name,
 		List<Element>& list, const Element& parent) const
 	{
 		Size count = 0;
+		if (name.empty())
+			return count;
 
 		WriteProtectionGuard guard(_write_protection);
 		if (!parent.empty())
@@ -137,11 +172,28 @@ namespace unicore::remoteui
 				return 0;
 			}
 
-			internal_find_all_by_name(parent.index(), name, list, count);
+			if (!get_info(parent.index()))
+				return 0;
 		}
-		else
+
+		const NameKey key{ name, HashString(name) };
+		const auto candidates = get_name_candidates(key);
+		if (candidates == nullptr)
+			return 0;
+
+		if (prefer_subtree_walk(parent.index(), candidates->size()))
 		{
-			internal_find_all_by_name(ElementIndex_Invalid, name, list, count);
+			internal_find_all_by_name(parent.index(), key, list, count);
+			return count;
+		}
+
+		for (const auto index : *candidates)
+		{
+			if (has_name(index, key) && is_in_subtree(index, parent.index()))
+			{
+				list.push_back(node_from_index(index));
+				count++;
+			}
 		}
 
 		return count;
@@ -234,7 +286,7 @@ namespace unicore::remoteui
 			break;
 
 		case UIActionType::OnChange:
-			info->attributes[Attribute::Value] = value;
+			set_attribute(info->attributes, Attribute::Value, value);
 			UC_LOG_DEBUG(_logger) << "Node " << node << " value changed to " << value;
 			if (actions != nullptr)
 			{
@@ -265,6 +317,12 @@ namespace unicore::remoteui
 			return Element::Empty;
 		}
 
+		if (!parent.empty() && !is_node_valid(parent))
+		{
+			UC_LOG_ERROR(_logger) << "Failed to create node. Parent is invalid";
+			return Element::Empty;
+		}
+
 		if (!parent.empty() && parent.tag() != ElementTag::Group)
 		{
 			UC_LOG_ERROR(_logger) << "Failed to create node. Only group tag can have children";
@@ -308,6 +366,12 @@ namespace unicore::remoteui
 			return Element::Empty;
 		}
 
+		if (!at_parent.empty() && !is_node_valid(at_parent))
+		{
+			UC_LOG_ERROR(_logger) << "Failed to duplicate node. Parent is invalid";
+			return Element::Empty;
+		}
+
 		if (!at_parent.empty() && at_parent.tag() != ElementTag::Group)
 		{
 			UC_LOG_ERROR(_logger) << "Failed to duplicate node. Only group tag can have children";
@@ -339,42 +403,15 @@ namespace unicore::remoteui
 			// ATTRIBUTES
 			for (const auto& key : AttributeKeys)
 			{
-				auto it = info->attributes.find(key);
-				auto jt = options.attributes.find(key);
+				const auto it = options.attributes.find(key);
+				const auto& value = it != options.attributes.end() ? it->second : Variant::Empty;
 
-				if (it != info->attributes.end() &&
-					jt != options.attributes.end())
-				{
-					if (it->second != jt->second)
-					{
-						info->attributes[key] = jt->second;
-						_event_set_attribute(node, key, jt->second);
-					}
-				}
-				else if (it != info->attributes.end())
-				{
-					info->attributes.erase(it);
-					_event_set_attribute(node, key, Variant::Empty);
-				}
-				else if (jt != options.attributes.end())
-				{
-					info->attributes[key] = jt->second;
-					_event_set_attribute(node, key, jt->second);
-				}
+				if (update_attribute(node.index(), key, value))
+					_event_set_attribute(node, key, value);
 			}
 
 			// ACTIONS
-			const auto it = _node_actions.find(node.index());
-			if (it != _node_actions.end())
-			{
-				if (options.actions.empty())
-					_node_actions.erase(it);
-				else it->second = options.actions;
-			}
-			else if (!options.actions.empty())
-			{
-				_node_actions[node.index()] = options.actions;
-			}
+			info->actions = options.actions;
 
 			return true;
 		}
@@ -423,18 +460,20 @@ namespace unicore::remoteui
 
 			if (const auto children = get_children_list(node.index()))
 			{
-				for (const auto child_index : *children)
+				for (auto child_index = children->first; child_index != ElementIndex_Invalid;
+					child_index = node_at(child_index).next_sibling)
 					list.push_back(node_from_index(child_index));
-				return children->size();
+				return children->count;
 			}
 
 			return 0;
 		}
 
-		for (const auto root_index : _roots)
+		for (auto root_index = _roots.first; root_index != ElementIndex_Invalid;
+			root_index = node_at(root_index).next_sibling)
 			list.push_back(node_from_index(root_index));
 
-		return _roots.size();
+		return _roots.count;
 	}
 
 	List<Element> Document::get_node_children(const Element& node) const
@@ -455,13 +494,13 @@ namespace unicore::remoteui
 				return Element::Empty;
 			}
 
-			if (const auto children = get_children_list(node.index()); children != nullptr)
+			if (const auto children = get_children_list(node.index());
+				children != nullptr && index >= 0 && static_cast<Size>(index) < children->count)
 			{
-				if (const auto it = std::find(children->begin(), children->end(), node.index()); it != children->end())
-				{
-					const auto value = static_cast<ElementIndex::TypeValue>(it - children->begin());
-					return node_from_index(ElementIndex(value));
-				}
+				auto child_index = children->first;
+				for (; index > 0; index--)
+					child_index = node_at(child_index).next_sibling;
+				return node_from_index(child_index);
 			}
 		}
 
@@ -480,12 +519,12 @@ namespace unicore::remoteui
 			}
 
 			if (const auto children = get_children_list(node.index()))
-				return children->size();
+				return children->count;
 
 			return 0;
 		}
 
-		return _roots.size();
+		return _roots.count;
 	}
 
 	int Document::get_node_sibling_index(const Element& node) const
@@ -499,13 +538,11 @@ namespace unicore::remoteui
 
 		if (const auto& info = get_info(node); info != nullptr)
 		{
-			const auto children = get_children_list(info->parent);
-			UC_ASSERT_MSG(children != nullptr, "Children is null");
-
-			if (const auto it = std::find(children->begin(), children->end(), node.index()); it != children->end())
-				return it - children->begin();
-
-			UC_ASSERT_ALWAYS_MSG("Index not found");
+			int index = 0;
+			for (auto prev = info->prev_sibling; prev != ElementIndex_Invalid;
+				prev = node_at(prev).prev_sibling)
+				index++;
+			return index;
 		}
 
 		return -1;
@@ -522,24 +559,23 @@ namespace unicore::remoteui
 
 		if (const auto& info = get_info(node.index()); info != nullptr)
 		{
-			if (const auto children = get_children_list(info->parent); children != nullptr)
+			const auto parent = info->parent;
+			const auto children = get_children_list(parent);
+			UC_ASSERT_MSG(children != nullptr, "Children is null");
+
+			new_index = Math::clamp<int>(new_index, 0, static_cast<int>(children->count) - 1);
+			if (get_node_sibling_index(node) != new_index)
 			{
-				new_index = Math::clamp<int>(new_index, 0, children->size() - 1);
+				unlink_child(node.index());
 
-				if (const auto it = std::find(children->begin(), children->end(), node.index()); it != children->end())
-				{
-					if (const auto old_index = it - children->begin(); old_index != new_index)
-					{
-						children->erase(children->begin() + old_index);
-						children->insert(children->begin() + new_index, node.index());
-
-						_event_reorder_children.invoke(node_from_index(info->parent));
-					}
-					return true;
-				}
+				auto before = children->first;
+				for (int i = 0; i < new_index; i++)
+					before = node_at(before).next_sibling;
 
-				UC_ASSERT_ALWAYS_MSG("Index not found");
+				link_child(parent, node.index(), before);
+				_event_reorder_children.invoke(node_from_index(parent));
 			}
+			return true;
 		}
 
 		return false;
@@ -547,38 +583,16 @@ namespace unicore::remoteui
 
 	Element Document::get_node_next_sibling(const Element& node) const
 	{
-		if (const auto& info = get_info(node); info != nullptr)
-		{
-			const auto children = get_children_list(info->parent);
-			UC_ASSERT_MSG(children != nullptr, "Children is null");
-
-			if (const auto it = std::find(children->begin(), children->end(), node.index()); it != children->end())
-			{
-				if (const auto index = it - children->begin(); index + 1 < children->size())
-					return node_from_index(children->at(index + 1));
-			}
-
-			UC_ASSERT_ALWAYS_MSG("Index not found");
-		}
+		if (const auto& info = get_info(node); info != nullptr && info->next_sibling != ElementIndex_Invalid)
+			return node_from_index(info->next_sibling);
 
 		return Element::Empty;
 	}
 
 	Element Document::get_node_prev_sibling(const Element& node) const
 	{
-		if (const auto& info = get_info(node); info != nullptr)
-		{
-			const auto children = get_children_list(info->parent);
-			UC_ASSERT_MSG(children != nullptr, "Children is null");
-
-			if (const auto it = std::find(children->begin(), children->end(), node.index()); it != children->end())
-			{
-				if (const auto index = it - children->end(); index > 0)
-					return node_from_index(children->at(index - 1));
-			}
-
-			UC_ASSERT_ALWAYS_MSG("Index not found");
-		}
+		if (const auto& info = get_info(node); info != nullptr && info->prev_sibling != ElementIndex_Invalid)
+			return node_from_index(info->prev_sibling);
 
 		return Element::Empty;
 	}
@@ -588,49 +602,43 @@ namespace unicore::remoteui
 		Attribute attribute, const Variant& value)
 	{
 		UC_ASSERT_MSG(!_write_protection, "Write protection is On");
-		if (const auto info = get_info(node))
+		if (get_info(node))
 		{
-			if (const auto it = info->attributes.find(attribute); it != info->attributes.end())
-			{
-				if (value != Variant::Empty)
-				{
-					if (it->second != value)
-					{
-						it->second = value;
-						if (!_event_set_attribute.empty())
-							_event_set_attribute.invoke(node, attribute, value);
-					}
-				}
-				else
-				{
-					info->attributes.erase(it);
-					if (!_event_set_attribute.empty())
-						_event_set_attribute.invoke(node, attribute, Variant::Empty);
-				}
-			}
-			else if (value != Variant::Empty)
-			{
-				info->attributes[attribute] = value;
-				if (!_event_set_attribute.empty())
-					_event_set_attribute.invoke(node, attribute, value);
-			}
+			if (update_attribute(node.index(), attribute, value) &&
+				!_event_set_attribute.empty())
+				_event_set_attribute.invoke(node, attribute, value);
 		}
 	}
 
-	const Variant& Document::get_node_attribute(const Element& node, Attribute attribute) const
+	Variant Document::get_node_attribute(const Element& node, Attribute attribute) const
 	{
 		if (const auto info = get_info(node))
 		{
-			if (const auto it = info->attributes.find(attribute); it != info->attributes.end())
-				return it->second;
+			if (const auto value = find_attribute(info->attributes, attribute))
+				return value->to_variant();
 		}
 		return Variant::Empty;
 	}
 
+	Bool Document::has_node_attribute(const Element& node, Attribute attribute) const
+	{
+		if (const auto info = get_info(node))
+		{
+			const auto value = find_attribute(info->attributes, attribute);
+			return value != nullptr && *value != PackedVariant::Empty;
+		}
+
+		return false;
+	}
+
 	Optional<AttributeDict> Document::get_node_attributes(const Element& node) const
 	{
 		if (const auto info = get_info(node))
-			return info->attributes;
+		{
+			AttributeDict dict;
+			to_attribute_dict(info->attributes, dict);
+			return dict;
+		}
 
 		return std::nullopt;
 	}
@@ -639,7 +647,8 @@ namespace unicore::remoteui
 	{
 		if (const auto info = get_info(node))
 		{
-			dict = info->attributes;
+			dict.clear();
+			to_attribute_dict(info->attributes, dict);
 			return true;
 		}
 
@@ -648,21 +657,30 @@ namespace unicore::remoteui
 
 	StringView Document::get_node_name(const Element& node) const
 	{
-		const auto value = get_node_attribute(node, Attribute::Hidden);
-		if (StringView view; value.try_get_string(view))
-			return view;
+		if (const auto info = get_info(node))
+		{
+			const auto value = find_attribute(info->attributes, Attribute::Name);
+			if (StringView view; value != nullptr && value->try_get_string(view))
+				return view;
+		}
 
 		return {};
 	}
 
 	void Document::set_node_name(const Element& node, StringView value)
 	{
-		set_node_attribute(node, Attribute::Hidden, value);
+		set_node_attribute(node, Attribute::Name, value);
 	}
 
 	Bool Document::get_node_hidden(const Element& node) const
 	{
-		return get_node_attribute(node, Attribute::Hidden).get_bool();
+		if (const auto info = get_info(node))
+		{
+			if (const auto value = find_attribute(info->attributes, Attribute::Hidden))
+				return value->get_bool();
+		}
+
+		return false;
 	}
 
 	void Document::set_node_hidden(const Element& node, Bool value)
@@ -683,7 +701,8 @@ namespace unicore::remoteui
 			return;
 		}
 
-		_node_actions[node.index()][type] = action;
+		if (const auto info = get_info(node.index()))
+			info->actions[type] = action;
 	}
 
 	Bool Document::unsubscribe_node(const Element& node, UIActionType type)
@@ -711,14 +730,26 @@ namespace unicore::remoteui
 
 	Document::NodeInfo* Document::get_info(ElementIndex index)
 	{
-		const auto it = _node_infos.find(index);
-		return it != _node_infos.end() ? &it->second : nullptr;
+		if (const auto slot = index_slot(index); slot < _slot_count)
+		{
+			auto& info = slot_at(slot);
+			if (info.alive && info.generation == index_generation(index))
+				return &info;
+		}
+
+		return nullptr;
 	}
 
 	const Document::NodeInfo* Document::get_info(ElementIndex index) const
 	{
-		const auto it = _node_infos.find(index);
-		return it != _node_infos.end() ? &it->second : nullptr;
+		if (const auto slot = index_slot(index); slot < _slot_count)
+		{
+			auto& info = slot_at(slot);
+			if (info.alive && info.generation == index_generation(index))
+				return &info;
+		}
+
+		return nullptr;
 	}
 
 	Document::NodeInfo* Document::get_info(const Element& node)
@@ -733,41 +764,291 @@ namespace unicore::remoteui
 
 	UIActionDict* Document::get_actions(ElementIndex index)
 	{
-		const auto it = _node_actions.find(index);
-		return it != _node_actions.end() ? &it->second : nullptr;
+		const auto info = get_info(index);
+		return info != nullptr ? &info->actions : nullptr;
 	}
 
 	const UIActionDict* Document::get_actions(ElementIndex index) const
 	{
-		const auto it = _node_actions.find(index);
-		return it != _node_actions.end() ? &it->second : nullptr;
+		const auto info = get_info(index);
+		return info != nullptr ? &info->actions : nullptr;
 	}
 
-	Document::NodeIndexList* Document::get_children_list(ElementIndex index)
+	Document::NodeChildren* Document::get_children_list(ElementIndex index)
 	{
 		if (index != ElementIndex_Invalid)
 		{
-			const auto it = _node_children.find(index);
-			return it != _node_children.end() ? &it->second : nullptr;
+			const auto info = get_info(index);
+			return info != nullptr ? &info->children : nullptr;
 		}
 
-		return !_roots.empty() ? &_roots : nullptr;
+		return &_roots;
 	}
 
-	const Document::NodeIndexList* Document::get_children_list(ElementIndex index) const
+	const Document::NodeChildren* Document::get_children_list(ElementIndex index) const
 	{
 		if (index != ElementIndex_Invalid)
 		{
-			const auto it = _node_children.find(index);
-			return it != _node_children.end() ? &it->second : nullptr;
+			const auto info = get_info(index);
+			return info != nullptr ? &info->children : nullptr;
 		}
 
-		return !_roots.empty() ? &_roots : nullptr;
+		return &_roots;
+	}
+
+	void Document::link_child(ElementIndex parent, ElementIndex index, ElementIndex before)
+	{
+		auto& children = *get_children_list(parent);
+		auto& info = node_at(index);
+
+		info.parent = parent;
+		info.next_sibling = before;
+
+		if (before != ElementIndex_Invalid)
+		{
+			auto& next = node_at(before);
+			info.prev_sibling = next.prev_sibling;
+			next.prev_sibling = index;
+		}
+		else
+		{
+			info.prev_sibling = children.last;
+			children.last = index;
+		}
+
+		if (info.prev_sibling != ElementIndex_Invalid)
+			node_at(info.prev_sibling).next_sibling = index;
+		else children.first = index;
+
+		children.count++;
+
+		for (auto it = parent; it != ElementIndex_Invalid; it = node_at(it).parent)
+			node_at(it).descendants += info.descendants + 1;
+	}
+
+	void Document::unlink_child(ElementIndex index)
+	{
+		auto& info = node_at(index);
+		auto& children = *get_children_list(info.parent);
+
+		if (info.prev_sibling != ElementIndex_Invalid)
+			node_at(info.prev_sibling).next_sibling = info.next_sibling;
+		else children.first = info.next_sibling;
+
+		if (info.next_sibling != ElementIndex_Invalid)
+			node_at(info.next_sibling).prev_sibling = info.prev_sibling;
+		else children.last = info.prev_sibling;
+
+		children.count--;
+
+		for (auto it = info.parent; it != ElementIndex_Invalid; it = node_at(it).parent)
+			node_at(it).descendants -= info.descendants + 1;
+
+		info.parent = ElementIndex_Invalid;
+		info.prev_sibling = ElementIndex_Invalid;
+		info.next_sibling = ElementIndex_Invalid;
+	}
+
+	void Document::add_to_index(ElementIndex index)
+	{
+		auto& info = node_at(index);
+
+		auto& tag_list = _tag_index[static_cast<Size>(info.tag)];
+		info.tag_position = tag_list.size();
+		tag_list.push_back(index);
+
+		if (const auto name = find_attribute(info.attributes, Attribute::Name))
+			add_name_index(index, *name);
+	}
+
+	void Document::remove_from_index(ElementIndex index)
+	{
+		auto& info = node_at(index);
+
+		// Swap with last, order of tag list is not preserved
+		auto& tag_list = _tag_index[static_cast<Size>(info.tag)];
+		const auto last = tag_list.back();
+		tag_list[info.tag_position] = last;
+		node_at(last).tag_position = info.tag_position;
+		tag_list.pop_back();
+
+		remove_name_index(index);
+	}
+
+	void Document::add_name_index(ElementIndex index, const PackedVariant& name)
+	{
+		StringView value;
+		if (!name.try_get_string(value) || value.empty())
+			return;
+
+		auto& info = node_at(index);
+		info.name_hash = HashString(value);
+		info.name_indexed = true;
+
+		auto& name_list = _name_index[info.name_hash.value()];
+		info.name_position = name_list.size();
+		name_list.push_back(index);
+	}
+
+	void Document::remove_name_index(ElementIndex index)
+	{
+		auto& info = node_at(index);
+		if (!info.name_indexed)
+			return;
+
+		const auto it = _name_index.find(info.name_hash.value());
+		info.name_indexed = false;
+
+		if (it == _name_index.end())
+			return;
+
+		// Swap with last, same as tag list
+		auto& list = it->second;
+		const auto last = list.back();
+		list[info.name_position] = last;
+		node_at(last).name_position = info.name_position;
+		list.pop_back();
+
+		if (list.empty())
+			_name_index.erase(it);
+	}
+
+	const List<ElementIndex>* Document::get_name_candidates(const NameKey& name) const
+	{
+		const auto it = _name_index.find(name.hash.value());
+		return it != _name_index.end() ? &it->second : nullptr;
+	}
+
+	Bool Document::has_name(ElementIndex index, const NameKey& name) const
+	{
+		const auto& info = node_at(index);
+		if (!info.name_indexed || info.name_hash != name.hash)
+			return false;
+
+		// Same hash, different names are possible
+		const auto value = find_attribute(info.attributes, Attribute::Name);
+		StringView view;
+		return value != nullptr && value->try_get_string(view) && view == name.value;
+	}
+
+	Bool Document::is_in_subtree(ElementIndex index, ElementIndex parent) const
+	{
+		if (parent == ElementIndex_Invalid)
+			return true;
+
+		for (auto it = index; it != ElementIndex_Invalid; it = node_at(it).parent)
+		{
+			if (it == parent)
+				return true;
+		}
+
+		return false;
+	}
+
+	Bool Document::prefer_subtree_walk(ElementIndex parent, Size candidates) const
+	{
+		// Each candidate is checked by walking up to the parent,
+		// small subtrees (item templates) are faster to walk directly
+		if (parent == ElementIndex_Invalid)
+			return false;
+
+		return node_at(parent).descendants < candidates * 4;
+	}
+
+	Bool Document::update_attribute(ElementIndex index, Attribute key, const Variant& value)
+	{
+		auto& info = node_at(index);
+		if (key != Attribute::Name)
+			return set_attribute(info.attributes, key, value);
+
+		if (const auto name = find_attribute(info.attributes, key))
+		{
+			if (name->equals(value))
+				return false;
+
+			remove_name_index(index);
+		}
+
+		const auto changed = set_attribute(info.attributes, key, value);
+		if (const auto name = find_attribute(info.attributes, key))
+			add_name_index(index, *name);
+		return changed;
+	}
+
+	const PackedVariant* Document::find_attribute(const AttributeList& list, Attribute key)
+	{
+		for (const auto& item : list)
+		{
+			if (item.key == key)
+				return &item.value;
+
+			if (item.key > key)
+				break;
+		}
+
+		return nullptr;
+	}
+
+	Bool Document::set_attribute(AttributeList& list, Attribute key, const Variant& value)
+	{
+		auto it = list.begin();
+		while (it != list.end() && it->key < key)
+			++it;
+
+		if (it != list.end() && it->key == key)
+		{
+			if (value == Variant::Empty)
+			{
+				list.erase(it);
+				return true;
+			}
+
+			if (!it->value.equals(value))
+			{
+				it->value = PackedVariant(value);
+				return true;
+			}
+
+			return false;
+		}
+
+		if (value == Variant::Empty)
+			return false;
+
+		list.insert(it, { key, PackedVariant(value) });
+		return true;
+	}
+
+	void Document::to_attribute_dict(const AttributeList& list, AttributeDict& dict)
+	{
+		for (const auto& [key, value] : list)
+			dict[key] = value.to_variant();
 	}
 
 	ElementIndex Document::create_index()
 	{
-		return ElementIndex(_last_index++);
+		UInt16 slot;
+		if (!_free_slots.empty())
+		{
+			slot = _free_slots.back();
+			_free_slots.pop_back();
+		}
+		else
+		{
+			// Last slot value is reserved for ElementIndex_Invalid
+			if (_slot_count >= index_slot(ElementIndex_Invalid))
+				return ElementIndex_Invalid;
+
+			if (_slot_count % NodesPerBlock == 0)
+				_blocks.push_back(std::make_unique<NodeInfo[]>(NodesPerBlock));
+
+			slot = _slot_count++;
+		}
+
+		auto& info = slot_at(slot);
+		info.alive = true;
+
+		return make_index(slot, info.generation);
 	}
 
 	Element Document::node_from_index(ElementIndex index) const
@@ -775,6 +1056,42 @@ namespace unicore::remoteui
 		return { this, index };
 	}
 
+	Element Document::internal_find_by_tag(ElementIndex index, ElementTag tag) const
+	{
+		if (const auto info = get_info(index); info && info->tag == tag)
+			return node_from_index(index);
+
+		if (const auto children = get_children_list(index); children != nullptr)
+		{
+			for (auto child_index = children->first; child_index != ElementIndex_Invalid;
+				child_index = node_at(child_index).next_sibling)
+			{
+				if (auto find = internal_find_by_tag(child_index, tag); !find.empty())
+					return find;
+			}
+		}
+
+		return Element::Empty;
+	}
+
+	Element Document::internal_find_by_name(ElementIndex index, const NameKey& name) const
+	{
+		if (index != ElementIndex_Invalid && has_name(index, name))
+			return node_from_index(index);
+
+		if (const auto children = get_children_list(index); children != nullptr)
+		{
+			for (auto child_index = children->first; child_index != ElementIndex_Invalid;
+				child_index = node_at(child_index).next_sibling)
+			{
+				if (auto find = internal_find_by_name(child_index, name); !find.empty())
+					return find;
+			}
+		}
+
+		return Element::Empty;
+	}
+
 	void Document::internal_find_all_by_tag(ElementIndex index,
 		ElementTag tag, List<Element>& list, Size& count) const
 	{
@@ -786,29 +1103,25 @@ namespace unicore::remoteui
 
 		if (const auto children = get_children_list(index); children != nullptr)
 		{
-			for (const auto child_index : *children)
+			for (auto child_index = children->first; child_index != ElementIndex_Invalid;
+				child_index = node_at(child_index).next_sibling)
 				internal_find_all_by_tag(child_index, tag, list, count);
 		}
 	}
 
 	void Document::internal_find_all_by_name(ElementIndex index,
-		StringView name, List<Element>& list, Size& count) const
+		const NameKey& name, List<Element>& list, Size& count) const
 	{
-		const auto info = get_info(index);
-		if (const auto it = info->attributes.find(Attribute::Name); it != info->attributes.end())
+		if (index != ElementIndex_Invalid && has_name(index, name))
 		{
-			StringView info_name;
-			if (it->second.try_get_string(info_name) &&
-				StringHelper::equals(info_name, name))
-			{
-				list.push_back(node_from_index(index));
-				count++;
-			}
+			list.push_back(node_from_index(index));
+			count++;
 		}
 
 		if (const auto children = get_children_list(index); children != nullptr)
 		{
-			for (const auto child_index : *children)
+			for (auto child_index = children->first; child_index != ElementIndex_Invalid;
+				child_index = node_at(child_index).next_sibling)
 				internal_find_all_by_name(child_index, name, list, count);
 		}
 	}
@@ -824,7 +1137,8 @@ namespace unicore::remoteui
 
 		if (const auto children = get_children_list(index); children != nullptr)
 		{
-			for (const auto child_index : *children)
+			for (auto child_index = children->first; child_index != ElementIndex_Invalid;
+				child_index = node_at(child_index).next_sibling)
 			{
 				if (auto find = internal_query(child_index, predicate); !find.empty())
 					return find;
@@ -849,7 +1163,8 @@ namespace unicore::remoteui
 
 		if (const auto children = get_children_list(index); children != nullptr)
 		{
-			for (const auto child_index : *children)
+			for (auto child_index = children->first; child_index != ElementIndex_Invalid;
+				child_index = node_at(child_index).next_sibling)
 				internal_query_all(child_index, predicate, list, count);
 		}
 	}
@@ -860,24 +1175,24 @@ namespace unicore::remoteui
 		UC_ASSERT_MSG(!_write_protection, "Write protection is On");
 
 		const auto index = create_index();
-		auto& info = _node_infos[index];
+		if (index == ElementIndex_Invalid)
+		{
+			UC_LOG_ERROR(_logger) << "Failed to create node. Node limit reached";
+			return ElementIndex_Invalid;
+		}
 
+		auto& info = node_at(index);
 		info.tag = tag;
-		info.parent = ElementIndex_Invalid;
-		info.attributes = options.attributes;
 
-		if (!options.actions.empty())
-			_node_actions[index] = options.actions;
+		// Dictionary is sorted by key already
+		info.attributes.reserve(options.attributes.size());
+		for (const auto& [key, value] : options.attributes)
+			info.attributes.push_back({ key, PackedVariant(value) });
 
-		if (parent != ElementIndex_Invalid)
-		{
-			info.parent = parent;
-			_node_children[parent].push_back(index);
-		}
-		else
-		{
-			_roots.push_back(index);
-		}
+		info.actions = options.actions;
+
+		link_child(parent, index, ElementIndex_Invalid);
+		add_to_index(index);
 
 		if (!_event_create_node.empty())
 			_event_create_node.invoke(node_from_index(index));
@@ -887,49 +1202,59 @@ namespace unicore::remoteui
 
 	ElementIndex Document::internal_duplicate(const Element& node, ElementIndex parent)
 	{
+		// Children are collected first, node can be duplicated into itself
+		ElementTag tag;
+		ElementOptions options;
+		List<ElementIndex> children;
+
 		if (const auto info = get_info(node))
 		{
-			ElementOptions options;
-			options.attributes = info->attributes;
-
-			if (const auto actions = get_actions(node.index()); actions != nullptr)
-				options.actions = *actions;
-
-			const auto new_index = internal_create_node(info->tag, options, parent);
-			if (const auto children = get_children_list(node.index()); children != nullptr)
-			{
-				for (const auto& child : *children)
-					internal_duplicate(node_from_index(child), new_index);
-			}
+			tag = info->tag;
+			to_attribute_dict(info->attributes, options.attributes);
+			options.actions = info->actions;
+
+			children.reserve(info->children.count);
+			for (auto child_index = info->children.first; child_index != ElementIndex_Invalid;
+				child_index = node_at(child_index).next_sibling)
+				children.push_back(child_index);
+		}
+		else return ElementIndex_Invalid;
 
-			return new_index;
+		const auto new_index = internal_create_node(tag, options, parent);
+		if (new_index != ElementIndex_Invalid)
+		{
+			for (const auto child_index : children)
+				internal_duplicate(node_from_index(child_index), new_index);
 		}
 
-		return ElementIndex_Invalid;
+		return new_index;
 	}
 
 	void Document::internal_remove_node(ElementIndex index, Size& count)
 	{
+		if (!get_info(index))
+			return;
+
 		// REMOVE CHILDREN
-		if (const auto it = _node_children.find(index); it != _node_children.end())
-		{
-			for (const auto child_index : it->second)
-				internal_remove_node(child_index, count);
+		while (node_at(index).children.first != ElementIndex_Invalid)
+			internal_remove_node(node_at(index).children.first, count);
 
-			_node_children.erase(it);
-		}
+		if (!_event_remove_node.empty())
+			_event_remove_node.invoke(node_from_index(index));
 
-		// REMOVE ACTIONS
-		if (const auto it = _node_actions.find(index); it != _node_actions.end())
-			_node_actions.erase(it);
+		unlink_child(index);
+		remove_from_index(index);
 
-		if (const auto it = _node_infos.find(index); it != _node_infos.end())
-		{
-			if (!_event_remove_node.empty())
-				_event_remove_node.invoke(node_from_index(index));
+		// Next generation invalidates all Element values of this slot
+		auto& info = node_at(index);
+		info.alive = false;
+		info.generation++;
+		info.tag = ElementTag::Group;
+		info.attributes.clear();
+		info.actions.clear();
 
-			_node_infos.erase(index);
-		}
+		_free_slots.push_back(index_slot(index));
+		count++;
 	}
 
 	bool Document::call_action_default(const UIAction& action, const Element& node)
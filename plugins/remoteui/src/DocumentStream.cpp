@@ -0,0 +1,748 @@
+#include "unicore/remoteui/DocumentStream.hpp"
+#include "unicore/io/Logger.hpp"
+#include "unicore/system/Memory.hpp"
+
+namespace unicore::remoteui
+{
+	namespace DocumentStream
+	{
+		enum class ValueType : UInt8
+		{
+			Bool, Int, Int64, Float, Double,
+			String, String32,
+			Vector2i, Vector2f, Vector3i, Vector3f,
+			Rangei, Rangef, Recti, Rectf,
+			Color3b, Color3f, Color4b, Color4f,
+		};
+
+		// WRITE /////////////////////////////////////////////////////////////////
+		static void write_varint(List<Byte>& data, UInt64 value)
+		{
+			while (value >= 0x80)
+			{
+				data.push_back(static_cast<Byte>(value | 0x80));
+				value >>= 7;
+			}
+			data.push_back(static_cast<Byte>(value));
+		}
+
+		static void write_zigzag(List<Byte>& data, Int64 value)
+		{
+			write_varint(data, (static_cast<UInt64>(value) << 1) ^ static_cast<UInt64>(value >> 63));
+		}
+
+		// Invalid index is written as 0
+		static void write_index(List<Byte>& data, ElementIndex index)
+		{
+			write_varint(data, static_cast<UInt32>(index.value + 1));
+		}
+
+		template<typename T>
+		static void write_raw(List<Byte>& data, T value)
+		{
+			const auto size = data.size();
+			data.resize(size + sizeof(T));
+			Memory::copy(data.data() + size, &value, sizeof(T));
+		}
+
+		template<typename T>
+		static void write_ints(List<Byte>& data, std::initializer_list<T> values)
+		{
+			for (const auto value : values)
+				write_zigzag(data, value);
+		}
+
+		template<typename T>
+		static void write_floats(List<Byte>& data, std::initializer_list<T> values)
+		{
+			for (const auto value : values)
+				write_raw(data, value);
+		}
+
+		template<typename T>
+		static void write_bytes(List<Byte>& data, std::initializer_list<T> values)
+		{
+			for (const auto value : values)
+				data.push_back(value);
+		}
+
+		static void write_type(List<Byte>& data, ValueType type)
+		{
+			data.push_back(static_cast<Byte>(type));
+		}
+
+		void write_value(List<Byte>& data, const Variant& value)
+		{
+			std::visit([&data](const auto& item)
+			{
+				using T = std::decay_t<decltype(item)>;
+
+				if constexpr (std::is_same_v<T, Bool>)
+				{
+					write_type(data, ValueType::Bool);
+					data.push_back(item ? 1 : 0);
+				}
+				else if constexpr (std::is_same_v<T, Int>)
+				{
+					write_type(data, ValueType::Int);
+					write_zigzag(data, item);
+				}
+				else if constexpr (std::is_same_v<T, Int64>)
+				{
+					write_type(data, ValueType::Int64);
+					write_zigzag(data, item);
+				}
+				else if constexpr (std::is_same_v<T, Float>)
+				{
+					write_type(data, ValueType::Float);
+					write_raw(data, item);
+				}
+				else if constexpr (std::is_same_v<T, Double>)
+				{
+					write_type(data, ValueType::Double);
+					write_raw(data, item);
+				}
+				else if constexpr (std::is_same_v<T, String>)
+				{
+					write_type(data, ValueType::String);
+					write_varint(data, item.size());
+					data.insert(data.end(), item.begin(), item.end());
+				}
+				else if constexpr (std::is_same_v<T, String32>)
+				{
+					write_type(data, ValueType::String32);
+					write_varint(data, item.size());
+					for (const auto c : item)
+						write_varint(data, static_cast<UInt32>(c));
+				}
+				else if constexpr (std::is_same_v<T, Vector2i>)
+				{
+					write_type(data, ValueType::Vector2i);
+					write_ints<Int>(data, { item.x, item.y });
+				}
+				else if constexpr (std::is_same_v<T, Vector2f>)
+				{
+					write_type(data, ValueType::Vector2f);
+					write_floats<Float>(data, { item.x, item.y });
+				}
+				else if constexpr (std::is_same_v<T, Vector3i>)
+				{
+					write_type(data, ValueType::Vector3i);
+					write_ints<Int>(data, { item.x, item.y, item.z });
+				}
+				else if constexpr (std::is_same_v<T, Vector3f>)
+				{
+					write_type(data, ValueType::Vector3f);
+					write_floats<Float>(data, { item.x, item.y, item.z });
+				}
+				else if constexpr (std::is_same_v<T, Rangei>)
+				{
+					write_type(data, ValueType::Rangei);
+					write_ints<Int>(data, { item.min, item.max });
+				}
+				else if constexpr (std::is_same_v<T, Rangef>)
+				{
+					write_type(data, ValueType::Rangef);
+					write_floats<Float>(data, { item.min, item.max });
+				}
+				else if constexpr (std::is_same_v<T, Recti>)
+				{
+					write_type(data, ValueType::Recti);
+					write_ints<Int>(data, { item.pos.x, item.pos.y, item.size.x, item.size.y });
+				}
+				else if constexpr (std::is_same_v<T, Rectf>)
+				{
+					write_type(data, ValueType::Rectf);
+					write_floats<Float>(data, { item.pos.x, item.pos.y, item.size.x, item.size.y });
+				}
+				else if constexpr (std::is_same_v<T, Color3b>)
+				{
+					write_type(data, ValueType::Color3b);
+					write_bytes<UInt8>(data, { item.r, item.g, item.b });
+				}
+				else if constexpr (std::is_same_v<T, Color3f>)
+				{
+					write_type(data, ValueType::Color3f);
+					write_floats<Float>(data, { item.r, item.g, item.b });
+				}
+				else if constexpr (std::is_same_v<T, Color4b>)
+				{
+					write_type(data, ValueType::Color4b);
+					write_bytes<UInt8>(data, { item.r, item.g, item.b, item.a });
+				}
+				else if constexpr (std::is_same_v<T, Color4f>)
+				{
+					write_type(data, ValueType::Color4f);
+					write_floats<Float>(data, { item.r, item.g, item.b, item.a });
+				}
+				else
+				{
+					write_type(data, ValueType::Bool);
+					data.push_back(0);
+				}
+			}, value.data());
+		}
+
+		// READ //////////////////////////////////////////////////////////////////
+		static Bool read_varint(const Byte*& ptr, const Byte* end, UInt64& value)
+		{
+			value = 0;
+			for (unsigned shift = 0; shift < 64; shift += 7)
+			{
+				if (ptr >= end)
+					return false;
+
+				const auto byte = *ptr++;
+				value |= static_cast<UInt64>(byte & 0x7F) << shift;
+				if ((byte & 0x80) == 0)
+					return true;
+			}
+
+			return false;
+		}
+
+		static Bool read_zigzag(const Byte*& ptr, const Byte* end, Int64& value)
+		{
+			UInt64 raw;
+			if (!read_varint(ptr, end, raw))
+				return false;
+
+			value = static_cast<Int64>(raw >> 1) ^ -static_cast<Int64>(raw & 1);
+			return true;
+		}
+
+		static Bool read_index(const Byte*& ptr, const Byte* end, ElementIndex& index)
+		{
+			UInt64 value;
+			if (!read_varint(ptr, end, value) || value > 0xFFFFFFFF)
+				return false;
+
+			index = ElementIndex(static_cast<UInt32>(value - 1));
+			return true;
+		}
+
+		template<typename T>
+		static Bool read_raw(const Byte*& ptr, const Byte* end, T& value)
+		{
+			if (static_cast<Size>(end - ptr) < sizeof(T))
+				return false;
+
+			Memory::copy(&value, ptr, sizeof(T));
+			ptr += sizeof(T);
+			return true;
+		}
+
+		template<typename T>
+		static Bool read_ints(const Byte*& ptr, const Byte* end, std::initializer_list<T*> values)
+		{
+			for (const auto value : values)
+			{
+				Int64 raw;
+				if (!read_zigzag(ptr, end, raw))
+					return false;
+				*value = static_cast<T>(raw);
+			}
+			return true;
+		}
+
+		template<typename T>
+		static Bool read_floats(const Byte*& ptr, const Byte* end, std::initializer_list<T*> values)
+		{
+			for (const auto value : values)
+			{
+				if (!read_raw(ptr, end, *value))
+					return false;
+			}
+			return true;
+		}
+
+		template<typename T>
+		static Bool read_bytes(const Byte*& ptr, const Byte* end, std::initializer_list<T*> values)
+		{
+			if (static_cast<Size>(end - ptr) < values.size())
+				return false;
+
+			for (const auto value : values)
+				*value = *ptr++;
+			return true;
+		}
+
+		Bool read_value(const Byte*& ptr, const Byte* end, Variant& value)
+		{
+			if (ptr >= end)
+				return false;
+
+			switch (static_cast<ValueType>(*ptr++))
+			{
+			case ValueType::Bool:
+				if (ptr >= end)
+					return false;
+				value = *ptr++ != 0;
+				return true;
+
+			case ValueType::Int:
+			{
+				Int64 raw;
+				if (!read_zigzag(ptr, end, raw))
+					return false;
+				value = static_cast<Int>(raw);
+				return true;
+			}
+
+			case ValueType::Int64:
+			{
+				Int64 raw;
+				if (!read_zigzag(ptr, end, raw))
+					return false;
+				value = raw;
+				return true;
+			}
+
+			case ValueType::Float:
+			{
+				Float raw;
+				if (!read_raw(ptr, end, raw))
+					return false;
+				value = raw;
+				return true;
+			}
+
+			case ValueType::Double:
+			{
+				Double raw;
+				if (!read_raw(ptr, end, raw))
+					return false;
+				value = raw;
+				return true;
+			}
+
+			case ValueType::String:
+			{
+				UInt64 size;
+				if (!read_varint(ptr, end, size) || size > static_cast<UInt64>(end - ptr))
+					return false;
+
+				value = String(reinterpret_cast<const char*>(ptr), static_cast<Size>(size));
+				ptr += size;
+				return true;
+			}
+
+			case ValueType::String32:
+			{
+				UInt64 size;
+				if (!read_varint(ptr, end, size) || size > static_cast<UInt64>(end - ptr))
+					return false;
+
+				String32 str;
+				str.reserve(static_cast<Size>(size));
+				for (UInt64 i = 0; i < size; i++)
+				{
+					UInt64 c;
+					if (!read_varint(ptr, end, c))
+						return false;
+					str.push_back(static_cast<Char32>(c));
+				}
+				value = str;
+				return true;
+			}
+
+			case ValueType::Vector2i:
+			{
+				Vector2i vec;
+				if (!read_ints<Int>(ptr, end, { &vec.x, &vec.y }))
+					return false;
+				value = vec;
+				return true;
+			}
+
+			case ValueType::Vector2f:
+			{
+				Vector2f vec;
+				if (!read_floats<Float>(ptr, end, { &vec.x, &vec.y }))
+					return false;
+				value = vec;
+				return true;
+			}
+
+			case ValueType::Vector3i:
+			{
+				Vector3i vec;
+				if (!read_ints<Int>(ptr, end, { &vec.x, &vec.y, &vec.z }))
+					return false;
+				value = vec;
+				return true;
+			}
+
+			case ValueType::Vector3f:
+			{
+				Vector3f vec;
+				if (!read_floats<Float>(ptr, end, { &vec.x, &vec.y, &vec.z }))
+					return false;
+				value = vec;
+				return true;
+			}
+
+			case ValueType::Rangei:
+			{
+				Rangei range;
+				if (!read_ints<Int>(ptr, end, { &range.min, &range.max }))
+					return false;
+				value = range;
+				return true;
+			}
+
+			case ValueType::Rangef:
+			{
+				Rangef range;
+				if (!read_floats<Float>(ptr, end, { &range.min, &range.max }))
+					return false;
+				value = range;
+				return true;
+			}
+
+			case ValueType::Recti:
+			{
+				Recti rect;
+				if (!read_ints<Int>(ptr, end, { &rect.pos.x, &rect.pos.y, &rect.size.x, &rect.size.y }))
+					return false;
+				value = rect;
+				return true;
+			}
+
+			case ValueType::Rectf:
+			{
+				Rectf rect;
+				if (!read_floats<Float>(ptr, end, { &rect.pos.x, &rect.pos.y, &rect.size.x, &rect.size.y }))
+					return false;
+				value = rect;
+				return true;
+			}
+
+			case ValueType::Color3b:
+			{
+				Color3b color;
+				if (!read_bytes<UInt8>(ptr, end, { &color.r, &color.g, &color.b }))
+					return false;
+				value = color;
+				return true;
+			}
+
+			case ValueType::Color3f:
+			{
+				Color3f color;
+				if (!read_floats<Float>(ptr, end, { &color.r, &color.g, &color.b }))
+					return false;
+				value = color;
+				return true;
+			}
+
+			case ValueType::Color4b:
+			{
+				Color4b color;
+				if (!read_bytes<UInt8>(ptr, end, { &color.r, &color.g, &color.b, &color.a }))
+					return false;
+				value = color;
+				return true;
+			}
+
+			case ValueType::Color4f:
+			{
+				Color4f color;
+				if (!read_floats<Float>(ptr, end, { &color.r, &color.g, &color.b, &color.a }))
+					return false;
+				value = color;
+				return true;
+			}
+			}
+
+			return false;
+		}
+	}
+
+	// ENCODER ///////////////////////////////////////////////////////////////////
+	DocumentEncoder::DocumentEncoder(Logger* logger)
+		: _logger(logger)
+	{
+	}
+
+	Bool DocumentEncoder::flush(List<Byte>& data)
+	{
+		using namespace DocumentStream;
+
+		const auto start = data.size();
+		for (const auto& change : _changes)
+		{
+			if (change.skip)
+				continue;
+
+			data.push_back(static_cast<Byte>(change.command));
+			switch (change.command)
+			{
+			case Command::Reset:
+				break;
+
+			case Command::Create:
+				write_index(data, change.index);
+				write_index(data, change.parent);
+				data.push_back(static_cast<Byte>(change.tag));
+				break;
+
+			case Command::Remove:
+				write_index(data, change.index);
+				break;
+
+			case Command::Reorder:
+				write_index(data, change.parent);
+				write_varint(data, change.children.size());
+				for (const auto index : change.children)
+					write_index(data, index);
+				break;
+
+			case Command::SetAttribute:
+				write_index(data, change.index);
+				data.push_back(static_cast<Byte>(change.attribute));
+				write_value(data, change.value);
+				break;
+			}
+		}
+
+		_changes.clear();
+		_attribute_changes.clear();
+		_created_nodes.clear();
+
+		const auto size = data.size() - start;
+		if (size == 0)
+			return false;
+
+		_stats.frames++;
+		_stats.bytes += size;
+		_stats.last_frame_bytes = size;
+		return true;
+	}
+
+	void DocumentEncoder::add_node(const Element& node)
+	{
+		on_create_node(node);
+
+		for (const auto& child : node.get_children())
+			add_node(child);
+	}
+
+	void DocumentEncoder::on_rebuild()
+	{
+		_changes.clear();
+		_attribute_changes.clear();
+		_created_nodes.clear();
+
+		Change change;
+		change.command = DocumentStream::Command::Reset;
+		_changes.push_back(change);
+
+		if (_document)
+		{
+			for (const auto& node : _document->get_roots())
+				add_node(node);
+		}
+	}
+
+	void DocumentEncoder::on_create_node(const Element& node)
+	{
+		Change change;
+		change.command = DocumentStream::Command::Create;
+		change.index = node.index();
+		change.parent = node.parent().index();
+		change.tag = node.tag();
+
+		_created_nodes[node.index().value] = _changes.size();
+		_changes.push_back(change);
+
+		if (AttributeDict dict; _document->get_node_attributes(node, dict))
+		{
+			for (const auto& [key, value] : dict)
+				on_set_attribute(node, key, value);
+		}
+	}
+
+	void DocumentEncoder::on_remove_node(const Element& node)
+	{
+		for (const auto key : AttributeKeys)
+		{
+			if (const auto it = _attribute_changes.find(attribute_key(node.index(), key));
+				it != _attribute_changes.end())
+			{
+				_changes[it->second].skip = true;
+				_attribute_changes.erase(it);
+			}
+		}
+
+		// Created in this frame, mirror doesn't know about it yet
+		if (const auto it = _created_nodes.find(node.index().value); it != _created_nodes.end())
+		{
+			_changes[it->second].skip = true;
+			_created_nodes.erase(it);
+			return;
+		}
+
+		Change change;
+		change.command = DocumentStream::Command::Remove;
+		change.index = node.index();
+		_changes.push_back(change);
+	}
+
+	void DocumentEncoder::on_reorder_children(const Element& node)
+	{
+		Change change;
+		change.command = DocumentStream::Command::Reorder;
+		change.parent = node.index();
+
+		for (const auto& child : _document->get_node_children(node))
+			change.children.push_back(child.index());
+
+		_changes.push_back(change);
+	}
+
+	void DocumentEncoder::on_set_attribute(const Element& node,
+		Attribute type, const Optional<Variant>& value)
+	{
+		const auto& new_value = value.has_value() ? value.value() : Variant::Empty;
+
+		const auto key = attribute_key(node.index(), type);
+		if (const auto it = _attribute_changes.find(key); it != _attribute_changes.end())
+		{
+			_changes[it->second].value = new_value;
+			_stats.coalesced++;
+			return;
+		}
+
+		Change change;
+		change.command = DocumentStream::Command::SetAttribute;
+		change.index = node.index();
+		change.attribute = type;
+		change.value = new_value;
+
+		_attribute_changes[key] = _changes.size();
+		_changes.push_back(change);
+	}
+
+	// DECODER ///////////////////////////////////////////////////////////////////
+	DocumentDecoder::DocumentDecoder(const Shared<Document>& document, Logger* logger)
+		: _document(document), _logger(logger)
+	{
+	}
+
+	Bool DocumentDecoder::apply(const void* data, Size size)
+	{
+		using namespace DocumentStream;
+
+		auto ptr = static_cast<const Byte*>(data);
+		const auto end = ptr + size;
+
+		while (ptr < end)
+		{
+			const auto command = static_cast<Command>(*ptr++);
+			switch (command)
+			{
+			case Command::Reset:
+				reset();
+				break;
+
+			case Command::Create:
+			{
+				ElementIndex index, parent;
+				if (!read_index(ptr, end, index) || !read_index(ptr, end, parent) || ptr >= end)
+					return false;
+
+				const auto tag = static_cast<ElementTag>(*ptr++);
+
+				auto local_parent = Element::Empty;
+				if (parent != ElementIndex_Invalid)
+				{
+					local_parent = find_node(parent);
+					if (local_parent.empty())
+					{
+						if (_logger)
+							UC_LOG_ERROR(_logger) << "Failed to create node. Unknown parent " << parent.value;
+						return false;
+					}
+				}
+
+				_nodes[index.value] = _document->create_node(tag, {}, local_parent);
+				break;
+			}
+
+			case Command::Remove:
+			{
+				ElementIndex index;
+				if (!read_index(ptr, end, index))
+					return false;
+
+				if (const auto it = _nodes.find(index.value); it != _nodes.end())
+				{
+					if (_document->is_node_valid(it->second))
+						_document->remove_node(it->second);
+					_nodes.erase(it);
+				}
+				break;
+			}
+
+			case Command::Reorder:
+			{
+				ElementIndex parent;
+				UInt64 count;
+				if (!read_index(ptr, end, parent) || !read_varint(ptr, end, count))
+					return false;
+
+				// Children unknown to mirror were created and removed within frame
+				int position = 0;
+				for (UInt64 i = 0; i < count; i++)
+				{
+					ElementIndex index;
+					if (!read_index(ptr, end, index))
+						return false;
+
+					if (const auto node = find_node(index); !node.empty())
+						_document->set_node_sibling_index(node, position++);
+				}
+				break;
+			}
+
+			case Command::SetAttribute:
+			{
+				ElementIndex index;
+				Variant value;
+				if (!read_index(ptr, end, index) || ptr >= end)
+					return false;
+
+				const auto attribute = static_cast<Attribute>(*ptr++);
+				if (!read_value(ptr, end, value))
+					return false;
+
+				if (const auto node = find_node(index); !node.empty())
+					_document->set_node_attribute(node, attribute, value);
+				break;
+			}
+
+			default:
+				if (_logger)
+					UC_LOG_ERROR(_logger) << "Unknown command " << static_cast<int>(command);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	Element DocumentDecoder::find_node(ElementIndex index) const
+	{
+		const auto it = _nodes.find(index.value);
+		return it != _nodes.end() ? it->second : Element::Empty;
+	}
+
+	void DocumentDecoder::reset()
+	{
+		for (const auto& node : _document->get_roots())
+			_document->remove_node(node);
+
+		_nodes.clear();
+	}
+}
\ No newline at end of file
@@ -50,7 +50,7 @@ namespace unicore::remoteui
 
 	Bool Element::has(Attribute attribute) const
 	{
-		return _document ? _document->get_node_attribute(*this, attribute) != Variant::Empty : false;
+		return _document ? _document->has_node_attribute(*this, attribute) : false;
 	}
 
 	StringView Element::name() const
@@ -0,0 +1,213 @@
+#include "unicore/remoteui/Transport.hpp"
+#include "unicore/system/Memory.hpp"
+#if defined(UNICORE_PLATFORM_WINDOWS)
+#	define WIN32_LEAN_AND_MEAN
+#	define NOMINMAX
+#	include <Windows.h>
+#elif defined(UNICORE_PLATFORM_POSIX)
+#	include <sys/socket.h>
+#	include <unistd.h>
+#	include <cerrno>
+#endif
+
+namespace unicore::remoteui
+{
+	static constexpr Size HeaderSize = sizeof(UInt32);
+	static constexpr Size ReadChunkSize = 64 * 1024;
+
+	PipeTransport::PipeTransport(intptr_t read_handle, intptr_t write_handle)
+		: _read_handle(read_handle), _write_handle(write_handle)
+	{
+	}
+
+	PipeTransport::~PipeTransport()
+	{
+#if defined(UNICORE_PLATFORM_WINDOWS)
+		CloseHandle(reinterpret_cast<HANDLE>(_read_handle));
+		CloseHandle(reinterpret_cast<HANDLE>(_write_handle));
+#elif defined(UNICORE_PLATFORM_POSIX)
+		close(static_cast<int>(_read_handle));
+#endif
+	}
+
+	Bool PipeTransport::send(const void* data, Size size)
+	{
+		if (!_connected)
+			return false;
+
+		const auto header = static_cast<UInt32>(size);
+		const auto offset = _output.size();
+		_output.resize(offset + HeaderSize + size);
+		Memory::copy(_output.data() + offset, &header, HeaderSize);
+		Memory::copy(_output.data() + offset + HeaderSize, data, size);
+
+		write_pending();
+		return _connected;
+	}
+
+	Bool PipeTransport::receive(List<Byte>& message)
+	{
+		write_pending();
+
+		if (_input.size() < HeaderSize)
+			read_available();
+
+		if (_input.size() >= HeaderSize)
+		{
+			UInt32 size;
+			Memory::copy(&size, _input.data(), HeaderSize);
+
+			if (_input.size() < HeaderSize + size)
+				read_available();
+
+			if (_input.size() >= HeaderSize + size)
+			{
+				message.assign(_input.begin() + HeaderSize, _input.begin() + HeaderSize + size);
+				_input.erase(_input.begin(), _input.begin() + HeaderSize + size);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+#if defined(UNICORE_PLATFORM_WINDOWS)
+	Bool PipeTransport::create_pair(Unique<PipeTransport>& first, Unique<PipeTransport>& second)
+	{
+		HANDLE read_a, write_a, read_b, write_b;
+		if (!CreatePipe(&read_a, &write_a, nullptr, 0))
+			return false;
+
+		if (!CreatePipe(&read_b, &write_b, nullptr, 0))
+		{
+			CloseHandle(read_a);
+			CloseHandle(write_a);
+			return false;
+		}
+
+		first.reset(new PipeTransport(
+			reinterpret_cast<intptr_t>(read_a), reinterpret_cast<intptr_t>(write_b)));
+		second.reset(new PipeTransport(
+			reinterpret_cast<intptr_t>(read_b), reinterpret_cast<intptr_t>(write_a)));
+		return true;
+	}
+
+	// Anonymous pipes have no non-blocking write, messages are written whole
+	void PipeTransport::write_pending()
+	{
+		const auto handle = reinterpret_cast<HANDLE>(_write_handle);
+		while (_connected && _output_offset < _output.size())
+		{
+			DWORD written = 0;
+			const auto size = static_cast<DWORD>(_output.size() - _output_offset);
+			if (!WriteFile(handle, _output.data() + _output_offset, size, &written, nullptr))
+				_connected = false;
+
+			_output_offset += written;
+		}
+
+		_output.clear();
+		_output_offset = 0;
+	}
+
+	void PipeTransport::read_available()
+	{
+		const auto handle = reinterpret_cast<HANDLE>(_read_handle);
+
+		DWORD available = 0;
+		if (!PeekNamedPipe(handle, nullptr, 0, nullptr, &available, nullptr))
+		{
+			_connected = false;
+			return;
+		}
+
+		if (available == 0)
+			return;
+
+		const auto offset = _input.size();
+		_input.resize(offset + available);
+
+		DWORD count = 0;
+		if (!ReadFile(handle, _input.data() + offset, available, &count, nullptr))
+			_connected = false;
+
+		_input.resize(offset + count);
+	}
+#elif defined(UNICORE_PLATFORM_POSIX)
+#	if defined(MSG_NOSIGNAL)
+	static constexpr int SendFlags = MSG_DONTWAIT | MSG_NOSIGNAL;
+#	else
+	static constexpr int SendFlags = MSG_DONTWAIT;
+#	endif
+
+	Bool PipeTransport::create_pair(Unique<PipeTransport>& first, Unique<PipeTransport>& second)
+	{
+		int fds[2];
+		if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+			return false;
+
+#	if defined(SO_NOSIGPIPE)
+		const int value = 1;
+		setsockopt(fds[0], SOL_SOCKET, SO_NOSIGPIPE, &value, sizeof(value));
+		setsockopt(fds[1], SOL_SOCKET, SO_NOSIGPIPE, &value, sizeof(value));
+#	endif
+
+		first.reset(new PipeTransport(fds[0], fds[0]));
+		second.reset(new PipeTransport(fds[1], fds[1]));
+		return true;
+	}
+
+	// Socket buffer can be full, the rest is written on next send/receive
+	void PipeTransport::write_pending()
+	{
+		const auto fd = static_cast<int>(_write_handle);
+		while (_connected && _output_offset < _output.size())
+		{
+			const auto count = ::send(fd, _output.data() + _output_offset,
+				_output.size() - _output_offset, SendFlags);
+
+			if (count < 0)
+			{
+				if (errno == EINTR)
+					continue;
+
+				if (errno != EAGAIN && errno != EWOULDBLOCK)
+					_connected = false;
+				break;
+			}
+
+			_output_offset += static_cast<Size>(count);
+		}
+
+		if (_output_offset == _output.size())
+		{
+			_output.clear();
+			_output_offset = 0;
+		}
+	}
+
+	void PipeTransport::read_available()
+	{
+		const auto fd = static_cast<int>(_read_handle);
+		while (_connected)
+		{
+			const auto offset = _input.size();
+			_input.resize(offset + ReadChunkSize);
+
+			const auto count = recv(fd, _input.data() + offset, ReadChunkSize, MSG_DONTWAIT);
+			_input.resize(offset + (count > 0 ? static_cast<Size>(count) : 0));
+
+			if (count > 0)
+				continue;
+
+			if (count == 0)
+				_connected = false;
+			else if (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK)
+				_connected = false;
+			else if (errno == EINTR)
+				continue;
+			break;
+		}
+	}
+#endif
+}
\ No newline at end of file
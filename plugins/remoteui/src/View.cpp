@@ -2,12 +2,11 @@
 
 namespace unicore::remoteui
 {
-	View::View()
-		: _bind_create_node([this](auto& node) { on_create_node(node); })
-		, _bind_remove_node([this](auto& node) { on_remove_node(node); })
-		, _bind_reorder_children([this](auto& node) { on_reorder_children(node); })
-		, _bind_set_attribute([this](auto& node, auto type, auto& value) { on_set_attribute(node, type, value); })
+	View::View() = default;
+
+	View::~View()
 	{
+		unsubscribe();
 	}
 
 	void View::set_document(const Shared<Document>& document)
@@ -15,24 +14,29 @@ namespace unicore::remoteui
 		if (_document == document)
 			return;
 
-		if (_document)
-		{
-			_document->on_create_node() -= _bind_create_node;
-			_document->on_remove_node() -= _bind_remove_node;
-			_document->on_reorder_children() -= _bind_reorder_children;
-			_document->on_set_attribute() -= _bind_set_attribute;
-		}
+		unsubscribe();
 
 		_document = document;
 
 		if (_document)
 		{
-			_document->on_create_node() += _bind_create_node;
-			_document->on_remove_node() += _bind_remove_node;
-			_document->on_reorder_children() += _bind_reorder_children;
-			_document->on_set_attribute() += _bind_set_attribute;
+			_bind_create_node = _document->on_create_node().add<&View::on_create_node>(this);
+			_bind_remove_node = _document->on_remove_node().add<&View::on_remove_node>(this);
+			_bind_reorder_children = _document->on_reorder_children().add<&View::on_reorder_children>(this);
+			_bind_set_attribute = _document->on_set_attribute().add<&View::on_set_attribute>(this);
 		}
 
 		on_rebuild();
 	}
+
+	void View::unsubscribe()
+	{
+		if (!_document)
+			return;
+
+		_document->on_create_node() -= _bind_create_node;
+		_document->on_remove_node() -= _bind_remove_node;
+		_document->on_reorder_children() -= _bind_reorder_children;
+		_document->on_set_attribute() -= _bind_set_attribute;
+	}
 }
\ No newline at end of file
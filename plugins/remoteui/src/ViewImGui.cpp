@@ -9,6 +9,12 @@ namespace unicore::remoteui
 {
 	static unsigned s_last_id = 0;
 
+	static Bool is_table_row(const Element& node)
+	{
+		return node.tag() == ElementTag::Group &&
+			node.type().get_enum<GroupType>() == GroupType::TableRow;
+	}
+
 	ViewImGui::ViewImGui(ImGuiContext& context, Logger& logger)
 		: _logger(logger)
 		, _context(context)
@@ -56,7 +62,13 @@ namespace unicore::remoteui
 
 		if (ImGui::Begin(str.c_str(), nullptr, window_flags))
 		{
-			for (auto& node : _document->get_roots())
+			if (_roots_dirty)
+			{
+				update_children(Element::Empty, _roots);
+				_roots_dirty = false;
+			}
+
+			for (const auto& node : _roots)
 				render_node(node);
 
 			_pos = ImGuiConvert::convert(ImGui::GetWindowPos());
@@ -77,6 +89,8 @@ namespace unicore::remoteui
 	void ViewImGui::on_rebuild()
 	{
 		_cached.clear();
+		_roots.clear();
+		_roots_dirty = true;
 
 		if (_document)
 		{
@@ -91,30 +105,96 @@ namespace unicore::remoteui
 
 		CachedInfo info;
 		info.id = StringBuilder::format("##{}", StringHelper::to_hex(node.index().value));
-		info.title = node.text().get_string() + info.id;
 
-		_cached[node.index()] = info;
+		_cached[node.index().value] = info;
+		set_children_dirty(node.parent());
 
 		for (const auto& child : node.get_children())
 			on_create_node(child);
 	}
 
+	void ViewImGui::on_remove_node(const Element& node)
+	{
+		View::on_remove_node(node);
+
+		_cached.erase(node.index().value);
+		set_children_dirty(node.parent());
+	}
+
+	void ViewImGui::on_reorder_children(const Element& node)
+	{
+		View::on_reorder_children(node);
+
+		set_children_dirty(node);
+	}
+
 	void ViewImGui::on_set_attribute(const Element& node,
 		Attribute type, const Optional<Variant>& value)
 	{
 		View::on_set_attribute(node, type, value);
 
-		if (type == Attribute::Text)
+		if (const auto info = get_info(node.index()))
+			info->dirty = true;
+
+		if (type == Attribute::Hidden)
+			set_children_dirty(node.parent());
+	}
+
+	void ViewImGui::set_children_dirty(const Element& node)
+	{
+		if (node.empty())
+			_roots_dirty = true;
+		else if (const auto info = get_info(node.index()))
+			info->children_dirty = true;
+	}
+
+	void ViewImGui::update_info(const Element& node, CachedInfo& info)
+	{
+		info.tag = node.tag();
+		info.type = node.type().get_int();
+		info.hidden = node.hidden();
+		info.disabled = node.disabled();
+		info.width = node.get(Attribute::Width).get_float();
+		info.height = node.get(Attribute::Height).get_float();
+		info.title = node.text().get_string() + info.id;
+		info.tooltip = node.get(Attribute::Tooltip).get_string();
+		info.dirty = false;
+	}
+
+	void ViewImGui::update_children(const Element& node, List<Element>& children) const
+	{
+		children.clear();
+
+		if (node.empty())
+			_document->get_roots(children);
+		else node.get_children(children);
+
+		children.erase(std::remove_if(children.begin(), children.end(),
+			[](const Element& child) { return child.hidden(); }), children.end());
+	}
+
+	void ViewImGui::render_children(const List<Element>& children,
+		Size start, LayoutOption layout_option, Bool clip)
+	{
+		if (!clip || children.size() - start < ClipThreshold)
+		{
+			for (auto i = start; i < children.size(); i++)
+				render_node(children[i], layout_option);
+			return;
+		}
+
+		ImGuiListClipper clipper;
+		clipper.Begin(static_cast<int>(children.size() - start));
+		while (clipper.Step())
 		{
-			if (const auto info = get_info(node.index()))
-				info->title = value->get_string() + info->id;
+			for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+				render_node(children[start + i], layout_option);
 		}
+		clipper.End();
 	}
 
 	Bool ViewImGui::render_node(const Element& node, LayoutOption layout_option)
 	{
-		if (node.hidden()) return false;
-
 		const auto cached_info = get_info(node.index());
 		if (!cached_info)
 		{
@@ -122,17 +202,19 @@ namespace unicore::remoteui
 			return false;
 		}
 
-		const auto tag = node.tag();
-		const auto& title = cached_info->title;
+		if (cached_info->dirty)
+			update_info(node, *cached_info);
 
-		Bool bool_value;
+		if (cached_info->hidden) return false;
 
-		String str;
-		String32 str32;
-
-		switch (tag)
+		switch (cached_info->tag)
 		{
 		case ElementTag::Group: // GROUP ////////////////////////////////////////////
+			if (cached_info->children_dirty)
+			{
+				update_children(node, cached_info->children);
+				cached_info->children_dirty = false;
+			}
 			return render_group(*cached_info, node, layout_option);
 
 		case ElementTag::Visual: // VISUAL //////////////////////////////////////////
@@ -145,35 +227,34 @@ namespace unicore::remoteui
 		return false;
 	}
 
-	Bool ViewImGui::render_group(const CachedInfo& info,
+	Bool ViewImGui::render_group(CachedInfo& info,
 		const Element& node, LayoutOption layout_option)
 	{
 		const auto& id = info.id;
 		const auto& title = info.title;
 
-		const auto width = node.get(Attribute::Width).get_float();
-		const auto height = node.get(Attribute::Height).get_float();
+		const auto width = info.width;
+		const auto height = info.height;
 
 		Bool bool_value;
 		String str;
 		String32 str32;
 
-		List<Element> children;
-		node.get_children(children);
+		const auto& children = info.children;
 
-		switch (node.type().get_enum<GroupType>())
+		switch (static_cast<GroupType>(info.type))
 		{
 		case GroupType::Vertical: // VERTICAL ////////////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			ImGui::BeginGroup();
 			for (const auto& child : children)
 				render_node(child);
 			ImGui::EndGroup();
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 
 		case GroupType::Horizontal: // HORIZONTAL ////////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			ImGui::BeginGroup();
 			for (unsigned i = 0; i < children.size(); i++)
 			{
@@ -182,35 +263,31 @@ namespace unicore::remoteui
 				render_node(children[i], option);
 			}
 			ImGui::EndGroup();
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 
 		case GroupType::Child: // CHILD //////////////////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			if (ImGui::BeginChild(id.c_str(), { width, height }, false, ImGuiWindowFlags_AlwaysAutoResize))
-			{
-				for (const auto& child : children)
-					render_node(child);
-			}
+				render_children(children, 0, LayoutOption::None, true);
 			ImGui::EndChild();
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 
 		case GroupType::List: // LIST ////////////////////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			if (ImGui::BeginListBox(id.c_str(), { width, height }))
 			{
-				for (const auto& child : children)
-					render_node(child);
+				render_children(children, 0, LayoutOption::None, true);
 				ImGui::EndListBox();
 			}
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 
 		case GroupType::Tree: // TREE ////////////////////////////////////////////
 			bool_value = node.value().get_bool();
 			ImGui::SetNextItemOpen(bool_value);
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			if (ImGui::TreeNode(title.c_str()))
 			{
 				if (!bool_value)
@@ -223,64 +300,71 @@ namespace unicore::remoteui
 			}
 			else if (bool_value)
 				_update_events.push_back({ node, UIActionType::OnChange, !bool_value });
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 
 		case GroupType::Combo: // COMBO //////////////////////////////////////////
 			str = node.value().get_string();
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			if (ImGui::BeginCombo(title.c_str(), str.c_str()))
 			{
 				for (const auto& child : children)
 					render_node(child);
 				ImGui::EndCombo();
 			}
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 
 		case GroupType::Flex: // FLEX ////////////////////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			if (ImGui::BeginListBox(id.c_str(), { width, height }))
 			{
 				for (const auto& child : children)
 					render_node(child, LayoutOption::SameLineFlex);
 				ImGui::EndListBox();
 			}
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 
 		case GroupType::Table: // TABLE //////////////////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			if (ImGui::BeginTable(id.c_str(), node.value().get_int(1),
 				ImGuiTableFlags_Resizable | ImGuiTableFlags_SizingStretchProp))
 			{
-				for (const auto& child : children)
-					render_node(child);
+				// Headers go before rows, only rows are clipped
+				Size rows_start = 0;
+				while (rows_start < children.size() && !is_table_row(children[rows_start]))
+					rows_start++;
+
+				for (Size i = 0; i < rows_start; i++)
+					render_node(children[i]);
+
+				render_children(children, rows_start, LayoutOption::None, true);
 				ImGui::EndTable();
 			}
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 
 		case GroupType::TableHeader: // TABLE HEADER /////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			str = node.text().get_string();
 			ImGui::TableNextColumn();
 			ImGui::TableHeader(str.c_str());
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 
 		case GroupType::TableRow: // TABLE ROW ///////////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			ImGui::TableNextRow();
 			ImGui::BeginGroup();
 			for (const auto& child : children)
 				render_node(child);
 			ImGui::EndGroup();
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 
 		case GroupType::TableCell: // TABLE CELL /////////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			ImGui::TableNextColumn();
 			ImGui::BeginGroup();
 			if (node.get(Attribute::Text).try_get_string(str))
@@ -292,7 +376,7 @@ namespace unicore::remoteui
 					render_node(child);
 			}
 			ImGui::EndGroup();
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 
 		case GroupType::Popup: // POPUP //////////////////////////////////////////
@@ -343,12 +427,12 @@ namespace unicore::remoteui
 		return true;
 	}
 
-	Bool ViewImGui::render_visual(const CachedInfo& info,
+	Bool ViewImGui::render_visual(CachedInfo& info,
 		const Element& node, LayoutOption layout_option)
 	{
 		const auto& id = info.id;
-		const auto width = node.get(Attribute::Width).get_float();
-		const auto height = node.get(Attribute::Height).get_float();
+		const auto width = info.width;
+		const auto height = info.height;
 
 		Float float_value;
 		String str;
@@ -359,35 +443,35 @@ namespace unicore::remoteui
 		ImTextureID texture_id;
 		ImVec2 size, uv0, uv1;
 
-		switch (node.type().get_enum<VisualType>())
+		switch (static_cast<VisualType>(info.type))
 		{
 		case VisualType::Text: // TEXT ///////////////////////////////////////////
 			str = node.get(Attribute::Text).get_string();
 
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			ImGui::Text("%s", str.c_str());
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 
 		case VisualType::Color: // COLOR /////////////////////////////////////////
 			col4_value = node.value().get_color4f();
 
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			if (ImGui::ColorButton(id.c_str(), ImGuiConvert::convert_color(col4_value)))
 				_update_events.push_back({ node, UIActionType::OnClick, Variant::Empty });
 
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 
 		case VisualType::Image: // IMAGE /////////////////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			if (get_texture(node.value(), texture_id, size, uv0, uv1))
 			{
 				const ImVec2 s = { width > 0 ? width : size.x, height > 0 ? height : size.y };
 				ImGui::Image(texture_id, s, uv0, uv1);
 			}
 			else ImGui::Image(nullptr, { width, height });
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 
 		case VisualType::Progress: // PROGRESS ///////////////////////////////////
@@ -397,37 +481,37 @@ namespace unicore::remoteui
 			};
 			float_value = Math::inverse_lerp(
 				range_f.min, range_f.max, node.value().get_float());
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			if (node.get(Attribute::Text).try_get_string(str))
 				ImGui::ProgressBar(float_value, { width, height }, str.c_str());
 			else ImGui::ProgressBar(float_value, { width, height });
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 
 		case VisualType::Separator: // SEPARATOR /////////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			ImGui::Separator();
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 
 		case VisualType::Bullet: // BULLET ///////////////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			ImGui::Bullet();
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 		}
 
 		return false;
 	}
 
-	Bool ViewImGui::render_input(const CachedInfo& info,
+	Bool ViewImGui::render_input(CachedInfo& info,
 		const Element& node, LayoutOption layout_option)
 	{
 		const auto& id = info.id;
 		const auto& title = info.title;
 
-		const auto width = node.get(Attribute::Width).get_float();
-		const auto height = node.get(Attribute::Height).get_float();
+		const auto width = info.width;
+		const auto height = info.height;
 
 		Bool bool_value;
 		Int int_value;
@@ -446,64 +530,64 @@ namespace unicore::remoteui
 		ImTextureID texture_id;
 		ImVec2 size, uv0, uv1;
 
-		render_node_header(node, layout_option);
-		switch (node.type().get_enum<InputType>())
+		render_node_header(info, layout_option);
+		switch (static_cast<InputType>(info.type))
 		{
 		case InputType::Text: // TEXT ////////////////////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			str = node.value().get_string();
 			if (ImGui::InputText(id.c_str(), &str))
 				_update_events.push_back({ node, UIActionType::OnChange, str });
-			render_node_footer(node);
+			render_node_footer(info, node);
 			break;
 
 		case InputType::TextArea: // TEXTAREA ////////////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			str = node.value().get_string();
 			if (ImGui::InputTextMultiline(id.c_str(), &str, { width, height }))
 				_update_events.push_back({ node, UIActionType::OnChange, str });
-			render_node_footer(node);
+			render_node_footer(info, node);
 			break;
 
 		case InputType::Toggle: // TOGGLE ////////////////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			bool_value = node.value().get_bool();
 			if (ImGui::Checkbox(id.c_str(), &bool_value))
 				_update_events.push_back({ node, UIActionType::OnChange, bool_value });
-			render_node_footer(node);
+			render_node_footer(info, node);
 			break;
 
 		case InputType::Radio: // RADIO //////////////////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			bool_value = node.value().get_bool();
 			if (ImGui::RadioButton(id.c_str(), bool_value))
 			{
 				_update_events.push_back({ node, UIActionType::OnChange, !bool_value });
 				ImGui::CloseCurrentPopup();
 			}
-			render_node_footer(node);
+			render_node_footer(info, node);
 			break;
 
 		case InputType::Button: // BUTTON ////////////////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			if (ImGui::Button(title.c_str(), { width, height }))
 			{
 				_update_events.push_back({ node, UIActionType::OnClick, Variant::Empty });
 				ImGui::CloseCurrentPopup();
 			}
-			render_node_footer(node);
+			render_node_footer(info, node);
 			break;
 
 		case InputType::Item: // ITEM ////////////////////////////////////////////
 			bool_value = node.value().get_bool();
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			if (ImGui::Selectable(title.c_str(), bool_value))
 				_update_events.push_back({ node, UIActionType::OnClick, Variant::Empty });
-			render_node_footer(node);
+			render_node_footer(info, node);
 			break;
 
 		case InputType::Image: // IMAGE //////////////////////////////////////////
-			render_node_header(node, layout_option);
+			render_node_header(info, layout_option);
 			ImGui::PushID(id.c_str());
 			if (get_texture(node.value(), texture_id, size, uv0, uv1))
 			{
@@ -526,7 +610,7 @@ namespace unicore::remoteui
 				}
 			}
 			ImGui::PopID();
-			render_node_footer(node);
+			render_node_footer(info, node);
 			return true;
 
 		case InputType::Integer: // INTEGER //////////////////////////////////////
@@ -598,14 +682,14 @@ namespace unicore::remoteui
 			break;
 		}
 
-		render_node_footer(node);
+		render_node_footer(info, node);
 		return true;
 	}
 
 	void ViewImGui::render_node_header(
-		const Element& node, LayoutOption layout_option)
+		const CachedInfo& info, LayoutOption layout_option)
 	{
-		if (node.disabled())
+		if (info.disabled)
 			ImGui::BeginDisabled(true);
 
 		switch (layout_option)
@@ -630,36 +714,29 @@ namespace unicore::remoteui
 		}
 	}
 
-	void ViewImGui::render_node_footer(const Element& node)
+	void ViewImGui::render_node_footer(CachedInfo& info, const Element& node)
 	{
 		const bool is_item_hovered = ImGui::IsItemHovered();
 
-		if (node.disabled())
+		if (info.disabled)
 			ImGui::EndDisabled();
 
-		if (const auto info = get_info(node.index()))
+		if (info.mouse_over != is_item_hovered)
 		{
-			if (info->mouse_over != is_item_hovered)
-			{
-				const auto event_type = info->mouse_over
-					? UIActionType::OnMouseLeave : UIActionType::OnMouseEnter;
-				_update_events.push_back({ node, event_type, Variant::Empty });
-				info->mouse_over = is_item_hovered;
-				//UC_LOG_DEBUG(_logger) << "Mouse " << event_type << " at " << node;
-			}
+			const auto event_type = info.mouse_over
+				? UIActionType::OnMouseLeave : UIActionType::OnMouseEnter;
+			_update_events.push_back({ node, event_type, Variant::Empty });
+			info.mouse_over = is_item_hovered;
+			//UC_LOG_DEBUG(_logger) << "Mouse " << event_type << " at " << node;
 		}
 
-		String tooltip;
-		if (node.get(Attribute::Tooltip).try_get_string(tooltip))
-		{
-			if (is_item_hovered)
-				ImGui::SetTooltip("%s", tooltip.c_str());
-		}
+		if (is_item_hovered && !info.tooltip.empty())
+			ImGui::SetTooltip("%s", info.tooltip.c_str());
 	}
 
 	ViewImGui::CachedInfo* ViewImGui::get_info(ElementIndex index)
 	{
-		const auto it = _cached.find(index);
+		const auto it = _cached.find(index.value);
 		return it != _cached.end() ? &it->second : nullptr;
 	}
 
@@ -0,0 +1,15 @@
+#pragma once
+#include "unicore/renderer/Surface.hpp"
+#if defined(UNICORE_USE_STB_IMAGE_WRITE)
+
+namespace unicore
+{
+	class WriteFile;
+
+	class StbSurfaceWriter
+	{
+	public:
+		static bool write_png(WriteFile& file, const Surface& surface);
+	};
+}
+#endif
\ No newline at end of file
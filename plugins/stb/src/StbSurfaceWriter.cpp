@@ -0,0 +1,41 @@
+#include "unicore/stb/StbSurfaceWriter.hpp"
+#if defined(UNICORE_USE_STB_IMAGE_WRITE)
+#include "unicore/io/File.hpp"
+#include "unicore/renderer/PixelConvert.hpp"
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+namespace unicore
+{
+	struct StbWriteContext
+	{
+		WriteFile& file;
+		bool valid = true;
+	};
+
+	static void stbi_stream_write(void* user, void* data, int size)
+	{
+		const auto context = static_cast<StbWriteContext*>(user);
+		if (context->valid)
+			context->valid = context->file.write(data, static_cast<size_t>(size));
+	}
+
+	bool StbSurfaceWriter::write_png(WriteFile& file, const Surface& surface)
+	{
+		const auto& size = surface.size();
+		if (size.x <= 0 || size.y <= 0)
+			return false;
+
+		// stb expects RGBA bytes
+		List<Color4b> pixels(size.area());
+		PixelConvert::to_colors(surface.format(),
+			static_cast<const UInt32*>(surface.data()), pixels.data(), pixels.size());
+
+		StbWriteContext context{ file };
+		const auto result = stbi_write_png_to_func(&stbi_stream_write, &context,
+			size.x, size.y, 4, pixels.data(), size.x * 4);
+
+		return result != 0 && context.valid && file.flush();
+	}
+}
+#endif
\ No newline at end of file
@@ -1,8 +1,10 @@
 #include "unicore/stb/StbTTFontFactory.hpp"
 #if defined(UNICORE_USE_STB_TRUETYPE)
 #include "unicore/io/Logger.hpp"
+#include "unicore/system/Profiler.hpp"
 #include "unicore/resource/BinaryData.hpp"
 #include "unicore/renderer/Canvas.hpp"
+#include "unicore/renderer/PixelConvert.hpp"
 #include "unicore/renderer/Surface.hpp"
 #include "unicore/renderer/Renderer.hpp"
 #include "unicore/stb/StbRectPack.hpp"
@@ -59,6 +61,8 @@ namespace unicore
 	Shared<TexturedFont> StbTTFontFactory::create(
 		const TTFontOptions& options, Logger* logger)
 	{
+		UC_PROFILE_SCOPE("StbTTFontFactory::create");
+
 		if (!valid()) return nullptr;
 
 		const auto scale = stbtt_ScaleForPixelHeight(
@@ -125,19 +129,14 @@ namespace unicore
 			const Recti packed = { r.pos.x + 1, r.pos.y + 1, r.size.x - 2, r.size.y - 2 };
 
 #if 1
-			int bm_offset = 0;
-			int surface_offset = packed.pos.x + packed.pos.y * surface_size.x;
-			auto surface_data = static_cast<UInt32*>(font_surface.data());
-
-			for (int y = 0; y < packed.size.y; y++, surface_offset += surface_size.x - packed.size.x)
-				for (int x = 0; x < packed.size.x; x++, bm_offset++, surface_offset++)
-				{
-					const auto a = item_bm[i][bm_offset];
-					//const Color4b color(255, 255, 255, a);
-					//color.to_format(font_surface.format());
-					// TODO: Use surface format
-					surface_data[surface_offset] = 0x00FFFFFF + (a << 24);
-				}
+			const auto surface_data = static_cast<UInt32*>(font_surface.data());
+			for (int y = 0; y < packed.size.y; y++)
+			{
+				PixelConvert::expand_alpha(font_surface.format(),
+					item_bm[i] + y * packed.size.x,
+					surface_data + packed.pos.x + (packed.pos.y + y) * surface_size.x,
+					packed.size.x);
+			}
 #else
 			for (int y = 0; y < packed.h; y++)
 				for (int x = 0; x < packed.w; x++)
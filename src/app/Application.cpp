@@ -1,5 +1,6 @@
 #include "unicore/app/Application.hpp"
 #include "unicore/system/TimeSpan.hpp"
+#include "unicore/system/Profiler.hpp"
 #include "unicore/platform/Time.hpp"
 #include "unicore/platform/Input.hpp"
 #include "unicore/platform/Plugin.hpp"
@@ -16,11 +17,15 @@ namespace unicore
 		, input(platform.input)
 		, file_system(platform.file_system)
 		, resources(platform.resources)
+		, args(settings.args)
 	{
+		UC_PROFILE_THREAD("Main");
+
 		_modules.add(platform);
 		_modules.add(input);
 		_modules.add(file_system);
 		_modules.add(resources);
+		_modules.add(jobs);
 	}
 
 	Application::~Application()
@@ -45,10 +50,31 @@ namespace unicore
 
 	void Application::update()
 	{
+		if (update_platform())
+			update_simulation();
+	}
+
+	Bool Application::update_platform()
+	{
+		UC_PROFILE_SCOPE("Platform");
+
+		jobs.dispatch_main();
+
 		platform.update();
 
-		if (time.delta() > TimeSpanConst::Zero)
-			on_update();
+		_fixed_steps = fixed_step.update();
+		return _fixed_steps > 0 || time.delta() > TimeSpanConst::Zero;
+	}
+
+	void Application::update_simulation()
+	{
+		UC_PROFILE_SCOPE("Update");
+
+		for (unsigned i = 0; i < _fixed_steps; i++)
+			on_fixed_update(fixed_step.step());
+		_fixed_steps = 0;
+
+		on_update();
 	}
 
 	void Application::add_plugin(Unique<Plugin>&& plugin)
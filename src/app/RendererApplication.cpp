@@ -1,5 +1,9 @@
 #include "unicore/app/RendererApplication.hpp"
 #include "unicore/platform/Time.hpp"
+#include "unicore/math/Math.hpp"
+#include "unicore/system/Profiler.hpp"
+#include "unicore/system/MemoryTracker.hpp"
+#include "unicore/system/FrameArena.hpp"
 
 namespace unicore
 {
@@ -11,26 +15,95 @@ namespace unicore
 		_modules.add(renderer);
 	}
 
+	int RendererApplication::fps() const
+	{
+		return Math::round_to_int(frame_stats.fps());
+	}
+
+	void RendererApplication::set_frame_latency(UInt8 latency)
+	{
+		_frame_latency = Math::min(latency, MaxFrameLatency);
+		_update_slot = 0;
+		_draw_slot = 0;
+		_update_count = 0;
+	}
+
 	void RendererApplication::update()
 	{
+		AutoTimer timer(_frame_sample.update);
 		DisplayApplication::update();
-
-		_fps_counter.update(time.delta());
 	}
 
 	void RendererApplication::draw()
 	{
+		UC_PROFILE_SCOPE("Draw");
+		AutoTimer timer(_frame_sample.draw);
+
 		if (renderer.begin_frame())
 		{
 			on_draw();
 			renderer.end_frame();
-			_fps_counter.frame();
+			_frame_sample.render = renderer.stats();
 		}
 	}
 
 	void RendererApplication::frame()
 	{
-		update();
-		draw();
+		UC_PROFILE_FRAME();
+		UC_MEMORY_FRAME();
+		UC_PROFILE_SCOPE("Frame");
+
+		const auto start = Timer::now();
+		_frame_sample = {};
+		if (_frame_start.has_value())
+			_frame_sample.interval = start - _frame_start.value();
+		_frame_start = start;
+
+		if (_frame_latency > 0)
+			frame_pipelined();
+		else
+		{
+			_screen_size[_update_slot] = renderer.screen_size();
+			update();
+			draw();
+		}
+
+		_frame_sample.frame = Timer::now() - start;
+		frame_stats.add(_frame_sample);
+
+		// Transient data of main thread lives until end of frame
+		FrameArena::current().reset();
+	}
+
+	void RendererApplication::frame_pipelined()
+	{
+		// Platform and input are changed on main thread only
+		const auto need_update = update_platform();
+
+		const auto slot_count = _frame_latency + 1;
+
+		JobHandle update_job;
+		if (need_update)
+		{
+			_update_slot = static_cast<UInt8>(_update_count % slot_count);
+			_update_count++;
+			// Renderer can resize screen in draw while update is running
+			_screen_size[_update_slot] = renderer.screen_size();
+			update_job = jobs.schedule([this]
+			{
+				AutoTimer timer(_frame_sample.update);
+				update_simulation();
+			});
+		}
+
+		// Frame updated latency frames ago is drawn while update is running
+		if (_update_count > _frame_latency)
+		{
+			_draw_slot = static_cast<UInt8>((_update_count - 1 - _frame_latency) % slot_count);
+			draw();
+		}
+
+		// Update has to finish before platform state is changed on next frame
+		jobs.wait(update_job);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,501 @@
+#include "unicore/io/AsyncLogger.hpp"
+#include "unicore/system/Memory.hpp"
+#include "unicore/math/Math.hpp"
+#include <algorithm>
+#include <charconv>
+#include <csignal>
+#include <cstring>
+#include <exception>
+#include <iterator>
+
+#if defined(UNICORE_PLATFORM_WINDOWS)
+#	include <io.h>
+#else
+#	include <unistd.h>
+#endif
+
+#if defined(UNICORE_PLATFORM_EMSCRIPTEN) && !defined(__EMSCRIPTEN_PTHREADS__)
+#	define UNICORE_ASYNC_LOGGER_INLINE
+#endif
+
+namespace unicore
+{
+	namespace
+	{
+		constexpr int CrashLockAttempts = 1000;
+
+		struct Registry
+		{
+			std::mutex mutex;
+			List<AsyncLogger*> loggers;
+		};
+
+		// Never destroyed, crash handler can be called after static destructors
+		Registry& get_registry()
+		{
+			static const auto registry = new Registry();
+			return *registry;
+		}
+
+		constexpr int CrashSignals[] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+		void (*s_prev_signals[std::size(CrashSignals)])(int) = {};
+		std::terminate_handler s_prev_terminate = nullptr;
+
+		void write_stderr(const char* text, Size size)
+		{
+#if defined(UNICORE_PLATFORM_WINDOWS)
+			_write(2, text, static_cast<unsigned>(size));
+#else
+			UC_UNUSED const auto result = ::write(STDERR_FILENO, text, size);
+#endif
+		}
+
+		// Only async-signal-safe calls here: no locks, formatting or allocations.
+		// Registry is read without lock, it changes only when loggers are created.
+		void on_crash_signal(int signal)
+		{
+			Size pending = 0;
+			for (const auto logger : get_registry().loggers)
+				pending += logger->pending();
+
+			if (pending > 0)
+			{
+				static constexpr StringView Prefix = "AsyncLogger: lost ";
+				static constexpr StringView Suffix = " messages on fatal signal\n";
+
+				char buffer[64];
+				Memory::copy(buffer, Prefix.data(), Prefix.size());
+				auto end = std::to_chars(buffer + Prefix.size(), buffer + sizeof(buffer), pending).ptr;
+				Memory::copy(end, Suffix.data(), Suffix.size());
+				end += Suffix.size();
+
+				write_stderr(buffer, end - buffer);
+			}
+
+			// Previous handler (or default one) handles signal again
+			for (Size i = 0; i < std::size(CrashSignals); i++)
+			{
+				if (CrashSignals[i] == signal)
+				{
+					const auto prev = s_prev_signals[i];
+					std::signal(signal, prev != SIG_ERR ? prev : SIG_DFL);
+					break;
+				}
+			}
+
+			std::raise(signal);
+		}
+
+		void on_terminate()
+		{
+			AsyncLogger::flush_all();
+
+			if (s_prev_terminate)
+				s_prev_terminate();
+			std::abort();
+		}
+	}
+
+	AsyncLogger::AsyncLogger(Logger& target, const AsyncLoggerSettings& settings)
+		: _target(target), _settings(settings), _start(Timer::now()), _flush_time(_start)
+	{
+		Size capacity = 2;
+		while (capacity < settings.capacity)
+			capacity <<= 1;
+
+		_records = std::make_unique<Record[]>(capacity);
+		_mask = capacity - 1;
+		for (Size i = 0; i < capacity; i++)
+			_records[i].sequence.store(i, std::memory_order_relaxed);
+
+		{
+			auto& registry = get_registry();
+			std::lock_guard lock(registry.mutex);
+			registry.loggers.push_back(this);
+		}
+
+		if (settings.flush_on_crash)
+			install_crash_handler();
+
+#if !defined(UNICORE_ASYNC_LOGGER_INLINE)
+		_thread = std::thread([this] { thread_loop(); });
+#endif
+	}
+
+	AsyncLogger::~AsyncLogger()
+	{
+#if !defined(UNICORE_ASYNC_LOGGER_INLINE)
+		{
+			std::lock_guard lock(_mutex);
+			_stop = true;
+		}
+		_cv.notify_one();
+		_thread.join();
+#endif
+
+		flush();
+
+		auto& registry = get_registry();
+		std::lock_guard lock(registry.mutex);
+		registry.loggers.erase(std::remove(
+			registry.loggers.begin(), registry.loggers.end(), this), registry.loggers.end());
+	}
+
+	void AsyncLogger::write(LogType type, const StringView text)
+	{
+		Size position;
+		if (const auto record = acquire(position))
+		{
+			record->type = type;
+			record->format = nullptr;
+			record->time = _settings.timestamps ? now() : 0;
+			record->size = static_cast<UInt32>(text.size());
+
+			if (text.size() <= PayloadSize)
+				std::memcpy(record->data, text.data(), text.size());
+			else
+			{
+				record->text = static_cast<char*>(UC_ALLOC_TAG(text.size(), MemoryCategory::Logger));
+				std::memcpy(record->text, text.data(), text.size());
+			}
+
+			commit(record, position);
+		}
+	}
+
+	void AsyncLogger::flush()
+	{
+		const auto tail = _tail.load(std::memory_order_acquire);
+
+		std::lock_guard lock(_consume_mutex);
+		// Records before tail can still be filled by other threads
+		while (_head.load(std::memory_order_relaxed) < tail)
+		{
+			if (consume() == 0)
+				std::this_thread::yield();
+		}
+
+		flush_target();
+	}
+
+	void AsyncLogger::flush_all()
+	{
+		// Crash can happen while registry is locked
+		auto& registry = get_registry();
+		std::unique_lock lock(registry.mutex, std::try_to_lock);
+		if (!lock.owns_lock())
+			return;
+
+		for (const auto logger : registry.loggers)
+			logger->try_flush();
+	}
+
+	void AsyncLogger::install_crash_handler()
+	{
+		static std::once_flag once;
+		std::call_once(once, []
+		{
+			s_prev_terminate = std::set_terminate(&on_terminate);
+			for (Size i = 0; i < std::size(CrashSignals); i++)
+				s_prev_signals[i] = std::signal(CrashSignals[i], &on_crash_signal);
+		});
+	}
+
+	// ArgWriter //////////////////////////////////////////////////////////////////
+	void AsyncLogger::ArgWriter::put(ArgType type, const void* value, Size count)
+	{
+		const Size header = type == ArgType::String ? 1 + sizeof(UInt32) : 1;
+		if (size + header + count > capacity)
+			grow(header + count);
+
+		data[size++] = static_cast<Byte>(type);
+		if (type == ArgType::String)
+		{
+			const auto length = static_cast<UInt32>(count);
+			std::memcpy(data + size, &length, sizeof(length));
+			size += sizeof(length);
+		}
+
+		std::memcpy(data + size, value, count);
+		size += static_cast<UInt32>(count);
+	}
+
+	void AsyncLogger::ArgWriter::grow(Size count)
+	{
+		capacity = Math::max(capacity * 2, size + count);
+
+		const auto buffer = static_cast<Byte*>(UC_ALLOC_TAG(capacity, MemoryCategory::Logger));
+		std::memcpy(buffer, data, size);
+		if (heap)
+			UC_FREE(heap);
+
+		data = heap = buffer;
+	}
+
+	// Ring ///////////////////////////////////////////////////////////////////////
+	AsyncLogger::Record* AsyncLogger::acquire(Size& position)
+	{
+		position = _tail.load(std::memory_order_relaxed);
+		while (true)
+		{
+			auto& record = _records[position & _mask];
+			const auto sequence = record.sequence.load(std::memory_order_acquire);
+			const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+			if (diff == 0)
+			{
+				if (_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					return &record;
+			}
+			else if (diff < 0)
+			{
+				// Ring is full
+				if (_settings.policy == AsyncLoggerPolicy::Drop)
+				{
+					_dropped.fetch_add(1, std::memory_order_relaxed);
+					return nullptr;
+				}
+
+				if (_sleeping.exchange(false))
+					wake();
+				std::this_thread::yield();
+				position = _tail.load(std::memory_order_relaxed);
+			}
+			else position = _tail.load(std::memory_order_relaxed);
+		}
+	}
+
+	void AsyncLogger::commit(Record* record, Size position)
+	{
+		record->sequence.store(position + 1, std::memory_order_release);
+
+#if defined(UNICORE_ASYNC_LOGGER_INLINE)
+		std::lock_guard lock(_consume_mutex);
+		consume();
+		_target.flush();
+#else
+		// Sleeping consumer polls ring every flush_interval, so it is woken
+		// only when ring fills up and wake up missed here costs one poll
+		if (position - _head.load(std::memory_order_relaxed) >= (_mask + 1) / 4 &&
+			_sleeping.load(std::memory_order_relaxed) && _sleeping.exchange(false))
+			wake();
+#endif
+	}
+
+	void AsyncLogger::wake()
+	{
+		{
+			std::lock_guard lock(_mutex);
+		}
+		_cv.notify_one();
+	}
+
+	Bool AsyncLogger::has_pending() const
+	{
+		const auto head = _head.load(std::memory_order_relaxed);
+		return _records[head & _mask].sequence.load(std::memory_order_acquire) == head + 1;
+	}
+
+	Size AsyncLogger::consume()
+	{
+		Size count = 0;
+		auto head = _head.load(std::memory_order_relaxed);
+
+		// Batch is limited by capacity, busy producers can not hold it forever
+		while (count <= _mask)
+		{
+			auto& record = _records[head & _mask];
+			if (record.sequence.load(std::memory_order_acquire) != head + 1)
+				break;
+
+			format(record);
+			if (record.text)
+			{
+				UC_FREE(record.text);
+				record.text = nullptr;
+			}
+
+			record.sequence.store(head + _mask + 1, std::memory_order_release);
+			_head.store(++head, std::memory_order_relaxed);
+			count++;
+		}
+
+		if (const auto dropped = _dropped.load(std::memory_order_relaxed); dropped != _reported_dropped)
+		{
+			_builder.clear();
+			_builder << "Dropped " << (dropped - _reported_dropped) << " messages";
+			_target.write(LogType::Warning, _builder.view());
+
+			_reported_dropped = dropped;
+			count++;
+		}
+
+		return count;
+	}
+
+	void AsyncLogger::format(const Record& record)
+	{
+		_builder.clear();
+
+		if (_settings.timestamps)
+		{
+			const auto time = Timer(Timer::ClockType::time_point(Timer::ClockType::duration(record.time)));
+			const auto ms = (time - _start).total_milliseconds();
+			const auto fraction = ms % 1000;
+
+			_builder << '[' << ms / 1000 << '.';
+			if (fraction < 100) _builder.append('0');
+			if (fraction < 10) _builder.append('0');
+			_builder << fraction << "] ";
+		}
+
+		if (!record.format)
+		{
+			const auto text = record.text ? record.text : reinterpret_cast<const char*>(record.data);
+			_builder.append(StringView(text, record.size));
+			_target.write(record.type, _builder.view());
+			return;
+		}
+
+		static constexpr StringView Elem = "{}";
+
+		const auto args = record.text ? reinterpret_cast<const Byte*>(record.text) : record.data;
+		StringView format(record.format);
+		Size offset = 0;
+		while (offset < record.size)
+		{
+			const auto pos = format.find(Elem);
+			if (pos == StringView::npos)
+				break;
+
+			_builder.append(format.substr(0, pos));
+			format = format.substr(pos + Elem.size());
+
+			const auto type = static_cast<ArgType>(args[offset++]);
+			const auto value = args + offset;
+			switch (type)
+			{
+			case ArgType::Int:
+			{
+				Int64 i;
+				std::memcpy(&i, value, sizeof(i));
+				_builder << i;
+				offset += sizeof(i);
+			}
+			break;
+
+			case ArgType::UInt:
+			{
+				UInt64 i;
+				std::memcpy(&i, value, sizeof(i));
+				_builder << i;
+				offset += sizeof(i);
+			}
+			break;
+
+			case ArgType::Float:
+			{
+				float f;
+				std::memcpy(&f, value, sizeof(f));
+				_builder << f;
+				offset += sizeof(f);
+			}
+			break;
+
+			case ArgType::Double:
+			{
+				double d;
+				std::memcpy(&d, value, sizeof(d));
+				_builder << d;
+				offset += sizeof(d);
+			}
+			break;
+
+			case ArgType::Bool:
+			{
+				bool b;
+				std::memcpy(&b, value, sizeof(b));
+				_builder << b;
+				offset += sizeof(b);
+			}
+			break;
+
+			case ArgType::Char:
+			{
+				Char32 c;
+				std::memcpy(&c, value, sizeof(c));
+				_builder.append(c);
+				offset += sizeof(c);
+			}
+			break;
+
+			case ArgType::String:
+			{
+				UInt32 length;
+				std::memcpy(&length, value, sizeof(length));
+				_builder.append(StringView(reinterpret_cast<const char*>(value + sizeof(length)), length));
+				offset += sizeof(length) + length;
+			}
+			break;
+			}
+		}
+
+		// Placeholders without arguments stay as is
+		_builder.append(format);
+		_target.write(record.type, _builder.view());
+	}
+
+	void AsyncLogger::try_flush()
+	{
+		// Consumer can be in the middle of batch
+		std::unique_lock lock(_consume_mutex, std::defer_lock);
+		for (int i = 0; i < CrashLockAttempts && !lock.try_lock(); i++)
+			std::this_thread::yield();
+
+		if (!lock.owns_lock())
+			return;
+
+		consume();
+		flush_target();
+	}
+
+	void AsyncLogger::flush_target()
+	{
+		_target.flush();
+		_unflushed = 0;
+		_flush_time = Timer::now();
+	}
+
+	void AsyncLogger::thread_loop()
+	{
+		while (true)
+		{
+			TimeSpan wait_time = _settings.flush_interval;
+			{
+				std::lock_guard lock(_consume_mutex);
+				const auto count = consume();
+				_unflushed += count;
+
+				if (_unflushed > 0)
+				{
+					const auto elapsed = Timer::now() - _flush_time;
+					if (_unflushed > _mask / 2 || elapsed >= _settings.flush_interval)
+						flush_target();
+					else wait_time = _settings.flush_interval - elapsed;
+				}
+
+				if (count > 0)
+					continue;
+			}
+
+			std::unique_lock lock(_mutex);
+			if (_stop)
+				break;
+
+			_sleeping.store(true, std::memory_order_relaxed);
+			if (!has_pending())
+				_cv.wait_for(lock, wait_time.data());
+			_sleeping.store(false, std::memory_order_relaxed);
+		}
+	}
+}
\ No newline at end of file
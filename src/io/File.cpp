@@ -19,6 +19,11 @@ namespace unicore
 		return std::make_shared<BinaryData>(std::move(chunk));
 	}
 
+	Shared<BasicBinaryData> ReadFile::map()
+	{
+		return as_data();
+	}
+
 	bool WriteFile::write(const MemoryChunk& chunk, size_t* bytes_written)
 	{
 		return write(chunk.data(), chunk.size(), bytes_written);
@@ -21,6 +21,6 @@ namespace unicore
 
 	Shared<Resource> WriteFileLoader::load(const Context& context)
 	{
-		return _provider.create_new(context.path);
+		return _provider.create_new(Path(context.path));
 	}
 }
\ No newline at end of file
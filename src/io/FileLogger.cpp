@@ -2,15 +2,38 @@
 
 namespace unicore
 {
-	FileLogger::FileLogger(const Shared<WriteFile>& file)
-		: _file(file), _writer(*file.get())
+	FileLogger::FileLogger(const Shared<WriteFile>& file, Size buffer_size)
+		: _file(file), _buffer_size(buffer_size)
 	{}
 
+	FileLogger::~FileLogger()
+	{
+		write_buffer();
+	}
+
 	void FileLogger::write(LogType type, const StringView text)
 	{
-		_writer.write(type_to_str(type));
-		_writer.write(" ");
-		_writer.write(text);
-		_writer.write("\n");
+		_buffer.append(type_to_str(type));
+		_buffer.append(' ');
+		_buffer.append(text);
+		_buffer.append('\n');
+
+		if (_buffer.size() > _buffer_size)
+			write_buffer();
+	}
+
+	void FileLogger::flush()
+	{
+		write_buffer();
+		_file->flush();
+	}
+
+	void FileLogger::write_buffer()
+	{
+		if (_buffer.empty())
+			return;
+
+		_file->write(_buffer.c_str(), _buffer.size());
+		_buffer.clear();
 	}
 }
\ No newline at end of file
@@ -13,18 +13,18 @@ namespace unicore
 		return sizeof(FileProvider);
 	}
 
-	bool FileProvider::exists(const Path& path) const
+	bool FileProvider::exists(PathView path) const
 	{
 		return stats(path).has_value();
 	}
 
-	bool FileProvider::is_file(const Path& path) const
+	bool FileProvider::is_file(PathView path) const
 	{
 		const auto info = stats(path);
 		return info.has_value() && info.value().type == FileType::File;
 	}
 
-	bool FileProvider::is_directory(const Path& path) const
+	bool FileProvider::is_directory(PathView path) const
 	{
 		const auto info = stats(path);
 		return info.has_value() && info.value().type == FileType::Directory;
@@ -87,7 +87,7 @@ namespace unicore
 	}
 
 	// ReadFileProvider ///////////////////////////////////////////////////////////
-	Shared<MemoryChunk> ReadFileProvider::read_chunk(const Path& path)
+	Shared<MemoryChunk> ReadFileProvider::read_chunk(PathView path)
 	{
 		if (const auto stream = open_read(path))
 		{
@@ -132,12 +132,12 @@ namespace unicore
 		return sizeof(DirectoryFileProvider);
 	}
 
-	Optional<FileStats> DirectoryFileProvider::stats(const Path& path) const
+	Optional<FileStats> DirectoryFileProvider::stats(PathView path) const
 	{
 		return _provider.stats(make_path(path));
 	}
 
-	bool DirectoryFileProvider::exists(const Path& path) const
+	bool DirectoryFileProvider::exists(PathView path) const
 	{
 		return _provider.exists(make_path(path));
 	}
@@ -149,7 +149,7 @@ namespace unicore
 		return _provider.enumerate_entries(make_path(path), search_pattern, name_list, options);
 	}
 
-	Shared<ReadFile> DirectoryFileProvider::open_read(const Path& path)
+	Shared<ReadFile> DirectoryFileProvider::open_read(PathView path)
 	{
 		return _provider.open_read(make_path(path));
 	}
@@ -160,12 +160,12 @@ namespace unicore
 		return sizeof(CachedFileProvider);
 	}
 
-	bool CachedFileProvider::exists(const Path& path) const
+	bool CachedFileProvider::exists(PathView path) const
 	{
 		return contains(path);
 	}
 
-	Optional<FileStats> CachedFileProvider::stats(const Path& path) const
+	Optional<FileStats> CachedFileProvider::stats(PathView path) const
 	{
 		const auto data = find_data(path);
 		return data.has_value() ? stats_index(data.value()) : std::nullopt;
@@ -176,17 +176,17 @@ namespace unicore
 		List<String>& name_list, const EnumerateOptions& options) const
 	{
 		uint16_t count = 0;
-		for (const auto& [entry_path, entry_index] : _entries)
+		for (const auto& [entry_atom, entry_index] : _entries)
 		{
-			if (entry_path.starts_with(path))
+			if (StringHelper::starts_with(entry_atom.str(), StringView(path.data())))
 			{
 				// TODO: Optimize enumeration
-				auto parent_path = entry_path.parent_path();
-				if (path == parent_path)
+				const PathView entry_path(entry_atom.str());
+				if (entry_path.parent_path() == path)
 				{
 					if (enumerate_index(entry_index, options))
 					{
-						name_list.push_back(entry_path.filename());
+						name_list.emplace_back(entry_path.filename());
 						count++;
 					}
 				}
@@ -196,7 +196,7 @@ namespace unicore
 		return count;
 	}
 
-	Shared<ReadFile> CachedFileProvider::open_read(const Path& path)
+	Shared<ReadFile> CachedFileProvider::open_read(PathView path)
 	{
 		const auto data = find_data(path);
 		return data.has_value() ? open_read_index(data.value()) : nullptr;
@@ -26,7 +26,7 @@ namespace unicore
 		_providers.insert(_providers.begin(), _write);
 	}
 
-	Optional<FileStats> FileSystem::stats(const Path& path) const
+	Optional<FileStats> FileSystem::stats(PathView path) const
 	{
 		for (const auto& provider : _providers)
 		{
@@ -57,7 +57,7 @@ namespace unicore
 		return names.size();
 	}
 
-	Shared<ReadFile> FileSystem::open_read(const Path& path)
+	Shared<ReadFile> FileSystem::open_read(PathView path)
 	{
 		for (const auto& provider : _providers)
 		{
@@ -6,7 +6,7 @@ namespace unicore
 {
 	void PrintLogger::write(LogType type, const StringView text)
 	{
-		printf("%s %s\n", type_to_str(type), text.data());
+		printf("%s %.*s\n", type_to_str(type), static_cast<int>(text.size()), text.data());
 	}
 
 	const char* Logger::type_to_str(LogType type)
@@ -34,23 +34,39 @@ namespace unicore
 			logger->write(type, text);
 	}
 
+	void MultiLogger::flush()
+	{
+		for (const auto logger : list)
+			logger->flush();
+	}
+
 	ProxyLogger::ProxyLogger(const StringView prefix, Logger& logger)
 		: _prefix(prefix), _logger(logger)
 	{}
 
 	void ProxyLogger::write(LogType type, const StringView text)
 	{
-		const auto str = StringBuilder::format("{}{}", _prefix, text);
-		_logger.write(type, str);
+		StringBuilder builder;
+		builder.append(_prefix);
+		builder.append(text);
+		_logger.write(type, builder.view());
+	}
+
+	void ProxyLogger::flush()
+	{
+		_logger.flush();
 	}
 
 	LogHelper::LogHelper(Logger& logger, LogType type)
 		: _logger(logger), _type(type)
+#if defined(UNICORE_USE_MEMORY_TRACKING)
+		, _memory_scope(UC_MEMORY_SITE(MemoryCategory::Logger))
+#endif
 	{
 	}
 
 	LogHelper::~LogHelper()
 	{
-		_logger.write(_type, data);
+		_logger.write(_type, view());
 	}
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "unicore/io/MemoryFile.hpp"
 #include "unicore/math/Math.hpp"
+#include "unicore/resource/BinaryData.hpp"
 
 namespace unicore
 {
@@ -60,6 +61,11 @@ namespace unicore
 		return false;
 	}
 
+	Shared<BasicBinaryData> ReadMemoryFile::map()
+	{
+		return std::make_shared<BinaryDataView>(_chunk->data(), _chunk->size(), _chunk);
+	}
+
 	// WriteMemoryFile ////////////////////////////////////////////////////////////
 	WriteMemoryFile::WriteMemoryFile(size_t size)
 		: _bytes(size, 0)
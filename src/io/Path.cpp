@@ -30,19 +30,24 @@ namespace unicore
 	Path::Path(StringView path)
 		: _data(prepare(path))
 	{
-		_hash = calc_hash(_data);
+		_hash = PathView::calc_hash(_data);
 	}
 
 	Path::Path(StringView16 path)
 		: _data(prepare(Unicode::to_utf8(path)))
 	{
-		_hash = calc_hash(_data);
+		_hash = PathView::calc_hash(_data);
 	}
 
 	Path::Path(StringView32 path)
 		: _data(prepare(Unicode::to_utf8(path)))
 	{
-		_hash = calc_hash(_data);
+		_hash = PathView::calc_hash(_data);
+	}
+
+	Path::Path(PathView path)
+		: _data(path.data()), _hash(path.hash())
+	{
 	}
 
 	Path::Path(Path&& other) noexcept
@@ -51,8 +56,8 @@ namespace unicore
 	{
 	}
 
-	Path::Path(StringView path, std::size_t hash)
-		: _data(path), _hash(hash)
+	Path::Path(String&& data, size_t hash)
+		: _data(std::move(data)), _hash(hash)
 	{
 	}
 
@@ -87,8 +92,7 @@ namespace unicore
 
 	bool Path::has_extension(StringView ext) const
 	{
-		// TODO: Optimize
-		return extension() == ext;
+		return PathView(*this).extension() == ext;
 	}
 
 	bool Path::starts_with(const Path& path) const
@@ -99,10 +103,7 @@ namespace unicore
 
 	void Path::parent_path(Path& parentPath) const
 	{
-		const auto pos = find_filename_pos(_data);
-		if (pos != String::npos)
-			parentPath = Path(_data.substr(0, pos));
-		else parentPath.clear();
+		parentPath = Path(PathView(*this).parent_path());
 	}
 
 	Path Path::parent_path() const
@@ -147,7 +148,7 @@ namespace unicore
 		const auto pos = find_filename_pos(_data);
 		if (pos != String::npos)
 		{
-			parentDir = Path(_data.substr(0, pos));
+			parentDir = Path(PathView(*this).parent_path());
 			fileName = _data.substr(pos + 1);
 		}
 		else
@@ -204,7 +205,7 @@ namespace unicore
 			_data = filename;
 		}
 
-		_hash = calc_hash(_data);
+		_hash = PathView::calc_hash(_data);
 	}
 
 	void Path::replace_extension(StringView ext)
@@ -215,21 +216,21 @@ namespace unicore
 			return;
 
 		_data += ext;
-		_hash = calc_hash(_data);
+		_hash = PathView::calc_hash(_data);
 	}
 
 	void Path::remove_extension()
 	{
 		if (const auto pos = find_extension_pos(_data); pos != String::npos)
 		{
-			_data = _data.substr(0, pos);
-			_hash = calc_hash(_data);
+			_data.resize(pos);
+			_hash = PathView::calc_hash(_data);
 		}
 	}
 
 	bool Path::equals(const Path& other) const
 	{
-		return _hash == other._hash || _data == other._data;
+		return _hash == other._hash && _data == other._data;
 	}
 
 	int Path::compare(const Path& other) const
@@ -239,7 +240,7 @@ namespace unicore
 		if (_hash > other._hash)
 			return +1;
 
-		return _data == other._data;
+		return _data.compare(other._data);
 	}
 
 	Path Path::operator/(const String& file) const
@@ -253,15 +254,24 @@ namespace unicore
 		return combine(_data, file);
 	}
 
-	Path Path::operator/(const Path& path) const
+	Path Path::operator/(PathView path) const
 	{
 		if (path.empty())
 			return *this;
 
 		if (empty())
-			return path;
+			return Path(path);
+
+		// Both paths are normalized, only separator between them is required
+		String data;
+		data.reserve(_data.size() + path.data().size() + 1);
+		data += _data;
+		if (path.data().front() != DirSeparator)
+			data += DirSeparator;
+		data += path.data();
 
-		return combine(_data, path._data);
+		const auto hash = PathView::calc_hash(data);
+		return { std::move(data), hash };
 	}
 
 	void Path::native_path(String& nativePath) const
@@ -282,10 +292,25 @@ namespace unicore
 		return str;
 	}
 
+	String Path::combine_native(PathView base, PathView path)
+	{
+		String str;
+		str.reserve(base.data().size() + path.data().size() + 1);
+		str += base.data();
+		if (!base.empty() && !path.empty() && path.data().front() != DirSeparator)
+			str += DirSeparator;
+		str += path.data();
+
+		if constexpr (DirSeparator != NativeDirSeparator)
+			std::replace(str.begin(), str.end(), DirSeparator, NativeDirSeparator);
+
+		return str;
+	}
+
 	Path Path::to_lower() const
 	{
 #if defined (UNICORE_PLATFORM_WINDOWS)
-		return Path(_data, _hash);
+		return *this;
 #else
 		auto tmp = _data;
 		std::transform(tmp.begin(), tmp.end(), tmp.begin(), towlower);
@@ -338,44 +363,61 @@ namespace unicore
 
 	String Path::prepare(const StringView _path)
 	{
-		static const String DoubleDirSeparator
-			= { DirSeparator, DirSeparator };
+		// Single pass: fix separators, collapse duplicates
+		String path;
+		path.reserve(_path.size());
 
-		auto path = String(_path);
-#if defined (UNICORE_PLATFORM_WINDOWS)
+		for (auto c : _path)
 		{
-			//wchar_t BUFFER[MAX_PATH];
-			//// TODO: Optimize
-			//if (PathCanonicalizeW(BUFFER, path.data()))
-			//	path = BUFFER;
-		}
-#endif
-		size_t pos;
-		while ((pos = path.find(WrongDirSeparator)) != String::npos)
-			path[pos] = DirSeparator;
-
-		while ((pos = path.find(DoubleDirSeparator)) != String::npos)
-			path = path.replace(pos, DoubleDirSeparator.size(), 1, DirSeparator);
+			if (c == WrongDirSeparator)
+				c = DirSeparator;
 
-		const auto endPos = path.find_last_not_of(DirSeparator);
-		if (endPos + 1 < path.size())
-			path = path.substr(0, endPos + 1);
+			if (c == DirSeparator && !path.empty() && path.back() == DirSeparator)
+				continue;
 
 #if defined (UNICORE_PLATFORM_WINDOWS)
-		std::transform(path.begin(), path.end(), path.begin(), towlower);
+			c = static_cast<Char>(towlower(c));
 #endif
+			path.push_back(c);
+		}
+
+		while (!path.empty() && path.back() == DirSeparator)
+			path.pop_back();
 
 		return path;
 	}
 
-	size_t Path::calc_hash(const StringView str)
+	// PathView ///////////////////////////////////////////////////////////////////
+	bool PathView::starts_with(PathView path) const
 	{
-		static constexpr HashFunc<String> hash_func;
-		return !str.empty() ? hash_func(str.data()) : 0;
+		return StringHelper::starts_with(_data, path._data);
+	}
+
+	PathView PathView::parent_path() const
+	{
+		const auto pos = Path::find_filename_pos(_data);
+		return pos != StringView::npos ? PathView(_data.substr(0, pos)) : PathView();
+	}
+
+	StringView PathView::filename() const
+	{
+		const auto pos = Path::find_filename_pos(_data);
+		return pos != StringView::npos ? _data.substr(pos + 1) : _data;
+	}
+
+	StringView PathView::extension() const
+	{
+		const auto pos = Path::find_extension_pos(_data);
+		return pos != StringView::npos ? _data.substr(pos) : StringView();
 	}
 
 	UNICODE_STRING_BUILDER_FORMAT(const Path&)
 	{
 		return builder << '\'' << value.data() << '\'';
 	}
+
+	UNICODE_STRING_BUILDER_FORMAT(const PathView&)
+	{
+		return builder << '\'' << value.data() << '\'';
+	}
 }
\ No newline at end of file
@@ -34,4 +34,15 @@ namespace unicore
 		// TODO: Check range
 		return static_cast <float> (next()) / static_cast <float> (std::random_device::max());
 	}
+
+	// SeededRandom ///////////////////////////////////////////////////////////////
+	uint32_t SeededRandom::next()
+	{
+		return static_cast<uint32_t>(_engine());
+	}
+
+	float SeededRandom::next_float_01()
+	{
+		return static_cast<float>(_engine() >> 8) / static_cast<float>(1 << 24);
+	}
 }
\ No newline at end of file
@@ -3,6 +3,141 @@
 
 namespace unicore
 {
+	namespace
+	{
+		template<typename TList>
+		void internal_circle(TList& out,
+			const Vector2f& center, float radius, unsigned segments)
+		{
+			if (Math::equals(radius, 0.0f))
+				return;
+
+			if (segments == 0)
+			{
+				const float lng = 2 * Math::Pi * radius;
+				segments = Math::max(3, Math::floor_to_int(lng / 10));
+			}
+
+			out.reserve(segments);
+			for (unsigned i = 0; i < segments; i++)
+			{
+				const Radians angle = (360_deg / segments) * i;
+				const auto cos = angle.cos();
+				const auto sin = angle.sin();
+				out.emplace_back(center.x + radius * cos, center.y + radius * sin);
+			}
+		}
+
+		template<typename TList>
+		void internal_ellipse(TList& out,
+			const Vector2f& center, const Vector2f& radius, unsigned segments)
+		{
+			if (segments == 0)
+			{
+				const float a = Math::Pi * radius.x * radius.y + Math::pow(radius.x + radius.y);
+				const float lng = 4 * (a / (radius.x - radius.y));
+				segments = Math::max(3, Math::floor_to_int(lng / 100));
+			}
+
+			out.reserve(segments);
+			for (unsigned i = 0; i < segments; i++)
+			{
+				const Radians angle = (360_deg / segments) * i;
+				const auto cos = angle.cos();
+				const auto sin = angle.sin();
+				out.emplace_back(center.x + radius.x * cos, center.y + radius.y * sin);
+			}
+		}
+
+		template<typename TList>
+		void internal_star(TList& out,
+			const Vector2f& center, unsigned count, float radius, float radius_inner)
+		{
+			if (count >= 2)
+			{
+				if (radius_inner <= 0)
+					radius_inner = radius * .5f;
+
+				const int segments = count * 2;
+				const float step = 360.f / segments;
+				out.reserve(segments + 2);
+
+				for (int i = 0; i <= segments; i++)
+				{
+					const auto angle = -Degrees(180 + step * i);
+					const float size = Math::even(i) ? radius : radius_inner;
+
+					float sin, cos;
+					angle.sin_cos(sin, cos);
+
+					out.emplace_back(center.x + size * sin, center.y + size * cos);
+				}
+			}
+		}
+
+		template<typename TList>
+		void internal_bezier3(TList& out,
+			const Vector2f& p0, const Vector2f& p1, const Vector2f& p2,
+			unsigned segments)
+		{
+			if (segments == 0)
+				segments = 20;
+
+			const float step = 1.0f / static_cast<float>(segments);
+
+			out.push_back(Curve::bezier3(0.0f, p0, p1, p2));
+
+			for (unsigned i = 1; i < segments; i++)
+			{
+				out.push_back(Curve::bezier3(
+					step * static_cast<float>(i), p0, p1, p2));
+			}
+
+			out.push_back(Curve::bezier3(1.0f, p0, p1, p2));
+		}
+
+		template<typename TList>
+		void internal_bezier4(TList& out,
+			const Vector2f& p0, const Vector2f& p1,
+			const Vector2f& p2, const Vector2f& p3, unsigned segments)
+		{
+			if (segments == 0)
+				segments = 20;
+
+			const float step = 1.0f / static_cast<float>(segments);
+
+			out.push_back(Curve::bezier4(0.0f, p0, p1, p2, p3));
+
+			for (unsigned i = 1; i < segments; i++)
+			{
+				out.push_back(Curve::bezier4(
+					step * static_cast<float>(i), p0, p1, p2, p3));
+			}
+
+			out.push_back(Curve::bezier4(1.0f, p0, p1, p2, p3));
+		}
+
+		template<typename TList>
+		void internal_spline(TList& out,
+			const Vector2f* points, unsigned points_count, unsigned segments)
+		{
+			if (segments == 0)
+				segments = 20;
+
+			const float step = 1.0f / static_cast<float>(segments);
+
+			out.push_back(Curve::spline(0.0f, points, points_count));
+
+			for (unsigned i = 1; i < segments; i++)
+			{
+				out.push_back(Curve::spline(
+					step * static_cast<float>(i), points, points_count));
+			}
+
+			out.push_back(Curve::spline(1.0f, points, points_count));
+		}
+	}
+
 	void ShapePrimitive::rect(List<Vector2f>& out, const Rectf& value)
 	{
 		value.push_points(out);
@@ -19,23 +154,13 @@ namespace unicore
 	void ShapePrimitive::circle(List<Vector2f>& out,
 		const Vector2f& center, float radius, unsigned segments)
 	{
-		if (Math::equals(radius, 0.0f))
-			return;
-
-		if (segments == 0)
-		{
-			const float lng = 2 * Math::Pi * radius;
-			segments = Math::max(3, Math::floor_to_int(lng / 10));
-		}
+		internal_circle(out, center, radius, segments);
+	}
 
-		out.reserve(segments);
-		for (unsigned i = 0; i < segments; i++)
-		{
-			const Radians angle = (360_deg / segments) * i;
-			const auto cos = angle.cos();
-			const auto sin = angle.sin();
-			out.emplace_back(center.x + radius * cos, center.y + radius * sin);
-		}
+	void ShapePrimitive::circle(ArenaList<Vector2f>& out,
+		const Vector2f& center, float radius, unsigned segments)
+	{
+		internal_circle(out, center, radius, segments);
 	}
 
 	List<Vector2f> ShapePrimitive::circle(
@@ -50,21 +175,13 @@ namespace unicore
 	void ShapePrimitive::ellipse(List<Vector2f>& out,
 		const Vector2f& center, const Vector2f& radius, unsigned segments)
 	{
-		if (segments == 0)
-		{
-			const float a = Math::Pi * radius.x * radius.y + Math::pow(radius.x + radius.y);
-			const float lng = 4 * (a / (radius.x - radius.y));
-			segments = Math::max(3, Math::floor_to_int(lng / 100));
-		}
+		internal_ellipse(out, center, radius, segments);
+	}
 
-		out.reserve(segments);
-		for (unsigned i = 0; i < segments; i++)
-		{
-			const Radians angle = (360_deg / segments) * i;
-			const auto cos = angle.cos();
-			const auto sin = angle.sin();
-			out.emplace_back(center.x + radius.x * cos, center.y + radius.y * sin);
-		}
+	void ShapePrimitive::ellipse(ArenaList<Vector2f>& out,
+		const Vector2f& center, const Vector2f& radius, unsigned segments)
+	{
+		internal_ellipse(out, center, radius, segments);
 	}
 
 	List<Vector2f> ShapePrimitive::ellipse(
@@ -79,26 +196,13 @@ namespace unicore
 	void ShapePrimitive::star(List<Vector2f>& out,
 		const Vector2f& center, unsigned count, float radius, float radius_inner)
 	{
-		if (count >= 2)
-		{
-			if (radius_inner <= 0)
-				radius_inner = radius * .5f;
-
-			const int segments = count * 2;
-			const float step = 360.f / segments;
-			out.reserve(segments + 2);
-
-			for (int i = 0; i <= segments; i++)
-			{
-				const auto angle = -Degrees(180 + step * i);
-				const float size = Math::even(i) ? radius : radius_inner;
-
-				float sin, cos;
-				angle.sin_cos(sin, cos);
+		internal_star(out, center, count, radius, radius_inner);
+	}
 
-				out.emplace_back(center.x + size * sin, center.y + size * cos);
-			}
-		}
+	void ShapePrimitive::star(ArenaList<Vector2f>& out,
+		const Vector2f& center, unsigned count, float radius, float radius_inner)
+	{
+		internal_star(out, center, count, radius, radius_inner);
 	}
 
 	List<Vector2f> ShapePrimitive::star(const Vector2f& center,
@@ -114,20 +218,14 @@ namespace unicore
 		const Vector2f& p0, const Vector2f& p1, const Vector2f& p2,
 		unsigned segments)
 	{
-		if (segments == 0)
-			segments = 20;
-
-		const float step = 1.0f / static_cast<float>(segments);
-
-		out.push_back(Curve::bezier3(0.0f, p0, p1, p2));
-
-		for (unsigned i = 1; i < segments; i++)
-		{
-			out.push_back(Curve::bezier3(
-				step * static_cast<float>(i), p0, p1, p2));
-		}
+		internal_bezier3(out, p0, p1, p2, segments);
+	}
 
-		out.push_back(Curve::bezier3(1.0f, p0, p1, p2));
+	void ShapePrimitive::bezier3(ArenaList<Vector2f>& out,
+		const Vector2f& p0, const Vector2f& p1, const Vector2f& p2,
+		unsigned segments)
+	{
+		internal_bezier3(out, p0, p1, p2, segments);
 	}
 
 	List<Vector2f> ShapePrimitive::bezier3(
@@ -144,20 +242,14 @@ namespace unicore
 		const Vector2f& p0, const Vector2f& p1,
 		const Vector2f& p2, const Vector2f& p3, unsigned segments)
 	{
-		if (segments == 0)
-			segments = 20;
-
-		const float step = 1.0f / static_cast<float>(segments);
-
-		out.push_back(Curve::bezier4(0.0f, p0, p1, p2, p3));
-
-		for (unsigned i = 1; i < segments; i++)
-		{
-			out.push_back(Curve::bezier4(
-				step * static_cast<float>(i), p0, p1, p2, p3));
-		}
+		internal_bezier4(out, p0, p1, p2, p3, segments);
+	}
 
-		out.push_back(Curve::bezier4(1.0f, p0, p1, p2, p3));
+	void ShapePrimitive::bezier4(ArenaList<Vector2f>& out,
+		const Vector2f& p0, const Vector2f& p1,
+		const Vector2f& p2, const Vector2f& p3, unsigned segments)
+	{
+		internal_bezier4(out, p0, p1, p2, p3, segments);
 	}
 
 	List<Vector2f> ShapePrimitive::bezier4(
@@ -173,20 +265,13 @@ namespace unicore
 	void ShapePrimitive::spline(List<Vector2f>& out,
 		const Vector2f* points, unsigned points_count, unsigned segments)
 	{
-		if (segments == 0)
-			segments = 20;
-
-		const float step = 1.0f / static_cast<float>(segments);
-
-		out.push_back(Curve::spline(0.0f, points, points_count));
-
-		for (unsigned i = 1; i < segments; i++)
-		{
-			out.push_back(Curve::spline(
-				step * static_cast<float>(i), points, points_count));
-		}
+		internal_spline(out, points, points_count, segments);
+	}
 
-		out.push_back(Curve::spline(1.0f, points, points_count));
+	void ShapePrimitive::spline(ArenaList<Vector2f>& out,
+		const Vector2f* points, unsigned points_count, unsigned segments)
+	{
+		internal_spline(out, points, points_count, segments);
 	}
 
 	List<Vector2f> ShapePrimitive::spline(
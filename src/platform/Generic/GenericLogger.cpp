@@ -4,6 +4,6 @@ namespace unicore
 {
 	void GenericLogger::write(LogType type, const StringView text)
 	{
-		printf("%s %s\n", type_to_str(type), text.data());
+		printf("%s %.*s\n", type_to_str(type), static_cast<int>(text.size()), text.data());
 	}
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "PosixFile.hpp"
 #if defined(UNICORE_PLATFORM_POSIX)
+#include "unicore/resource/BinaryData.hpp"
+#include <sys/mman.h>
 
 namespace unicore
 {
@@ -41,6 +43,22 @@ namespace unicore
 		return result == size;
 	}
 
+	Shared<BasicBinaryData> PosixFile::map()
+	{
+		const auto file_size = size();
+		if (file_size <= 0)
+			return ReadFile::map();
+
+		const auto length = static_cast<size_t>(file_size);
+		const auto data = mmap(nullptr, length,
+			PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(_handle), 0);
+		if (data == MAP_FAILED)
+			return ReadFile::map();
+
+		const Shared<void> owner(data, [length](void* ptr) { munmap(ptr, length); });
+		return std::make_shared<BinaryDataView>(data, length, owner);
+	}
+
 	bool PosixFile::flush()
 	{
 		return fflush(_handle) == 0;
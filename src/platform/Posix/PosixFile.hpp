@@ -18,6 +18,8 @@ namespace unicore
 		UC_NODISCARD bool eof() const override;
 		bool read(void* buffer, size_t size, size_t* bytes_read) override;
 
+		Shared<BasicBinaryData> map() override;
+
 		bool flush() override;
 		bool write(const void* buffer, size_t size, size_t* bytes_written) override;
 
@@ -20,14 +20,14 @@ namespace unicore
 	{
 	}
 
-	bool PosixFileProvider::exists(const Path& path) const
+	bool PosixFileProvider::exists(PathView path) const
 	{
 		const auto native_path = to_native(path);
 		struct stat data;
 		return stat(native_path.c_str(), &data) == 0;
 	}
 
-	Optional<FileStats> PosixFileProvider::stats(const Path& path) const
+	Optional<FileStats> PosixFileProvider::stats(PathView path) const
 	{
 		const auto native_path = to_native(path);
 
@@ -115,7 +115,7 @@ namespace unicore
 		return false;
 	}
 
-	Shared<ReadFile> PosixFileProvider::open_read(const Path& path)
+	Shared<ReadFile> PosixFileProvider::open_read(PathView path)
 	{
 		const auto native_path = to_native(path);
 		auto handle = fopen(native_path.c_str(), "rb");
@@ -149,9 +149,9 @@ namespace unicore
 #endif
 	}
 
-	String PosixFileProvider::to_native(const Path& path) const
+	String PosixFileProvider::to_native(PathView path) const
 	{
-		return (_current_dir / path).native_path();
+		return Path::combine_native(_current_dir, path);
 	}
 }
 
@@ -11,8 +11,8 @@ namespace unicore
 		explicit PosixFileProvider(Logger& logger);
 		PosixFileProvider(Logger& logger, const Path& current_dir);
 
-		UC_NODISCARD bool exists(const Path& path) const override;
-		UC_NODISCARD Optional<FileStats> stats(const Path& path) const override;
+		UC_NODISCARD bool exists(PathView path) const override;
+		UC_NODISCARD Optional<FileStats> stats(PathView path) const override;
 
 		uint16_t enumerate_entries(const Path& path,
 			StringView search_pattern, List<String>& name_list,
@@ -21,7 +21,7 @@ namespace unicore
 		bool create_directory(const Path& path) override;
 		bool delete_directory(const Path& path, bool recursive) override;
 
-		Shared<ReadFile> open_read(const Path& path) override;
+		Shared<ReadFile> open_read(PathView path) override;
 		Shared<WriteFile> create_new(const Path& path) override;
 
 		bool delete_file(const Path& path) override;
@@ -31,7 +31,7 @@ namespace unicore
 		Path _current_dir;
 
 		UC_NODISCARD Path get_current_dir() const;
-		UC_NODISCARD String to_native(const Path& path) const;
+		UC_NODISCARD String to_native(PathView path) const;
 	};
 }
 
@@ -12,7 +12,12 @@ namespace unicore
 		: _logger(settings.logger)
 		, _looper(looper)
 		, _handle(nullptr)
+		, _headless(settings.mode.window_flags.has(DisplayWindowFlag::Headless))
 	{
+		// Works without display server, environment variable still has priority
+		if (_headless)
+			SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+
 		SDL_Init(SDL_INIT_VIDEO);
 		SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "1");
 		SDL_SetHint(SDL_HINT_RENDER_DRIVER, "opengl");
@@ -36,12 +41,12 @@ namespace unicore
 		SDL_SetWindowData(_handle, window_data_name, this);
 		update_mode();
 
-		_looper.add_listener(this);
+		_listener = _looper.add_listener(this);
 	}
 
 	SDL2Display::~SDL2Display()
 	{
-		_looper.remove_listener(this);
+		_looper.remove_listener(_listener);
 		SDL_DestroyWindow(_handle);
 	}
 
@@ -159,10 +164,20 @@ namespace unicore
 
 		if (flags & SDL_WINDOW_RESIZABLE)
 			_mode.window_flags |= DisplayWindowFlag::Resizable;
+
+		if (_headless)
+			_mode.window_flags |= DisplayWindowFlag::Headless;
 	}
 
 	Uint32 SDL2Display::make_flags(DisplayMode& mode) const
 	{
+		if (_headless)
+		{
+			mode.fullscreen = false;
+			mode.window_flags = DisplayWindowFlag::Headless;
+			return SDL_WINDOW_HIDDEN;
+		}
+
 		Uint32 flags = SDL_WINDOW_OPENGL;
 		if (mode.fullscreen)
 		{
@@ -1,5 +1,6 @@
 #pragma once
 #include "unicore/platform/Display.hpp"
+#include "unicore/system/Delegate.hpp"
 #if defined(UNICORE_USE_SDL2)
 #include "SDL2Utils.hpp"
 
@@ -22,14 +23,17 @@ namespace unicore
 
 		UC_NODISCARD void* native_handle() const override;
 		UC_NODISCARD SDL_Window* handle() const { return _handle; }
+		UC_NODISCARD bool headless() const { return _headless; }
 
 		bool on_event(const SDL_Event& evt) override;
 
 	protected:
 		Logger& _logger;
 		SDL2Looper& _looper;
+		DelegateHandle _listener;
 		SDL_Window* _handle;
 		DisplayMode _mode;
+		bool _headless;
 
 		void update_mode();
 
@@ -45,22 +45,19 @@ namespace unicore
 				break;
 			}
 
-			for (const auto listener : _listeners)
-			{
-				if (listener->on_event(evt))
-					break;
-			}
+			_listeners.invoke_until(evt);
 		}
 	}
 
-	void SDL2Looper::add_listener(SDL2EventListener* listener)
+	DelegateHandle SDL2Looper::add_listener(SDL2EventListener* listener)
 	{
-		_listeners.insert(listener);
+		return _listeners.add(
+			Delegate<Bool(const SDL_Event&)>::bind<&SDL2EventListener::on_event>(listener));
 	}
 
-	void SDL2Looper::remove_listener(SDL2EventListener* listener)
+	void SDL2Looper::remove_listener(DelegateHandle handle)
 	{
-		_listeners.erase(listener);
+		_listeners.remove(handle);
 	}
 }
 #endif
\ No newline at end of file
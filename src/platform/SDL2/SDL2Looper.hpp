@@ -1,5 +1,6 @@
 #pragma once
 #include "unicore/platform/Looper.hpp"
+#include "unicore/system/Delegate.hpp"
 #if defined(UNICORE_USE_SDL2)
 #include "SDL2Utils.hpp"
 
@@ -18,13 +19,13 @@ namespace unicore
 
 		void poll_events();
 
-		void add_listener(SDL2EventListener* listener);
-		void remove_listener(SDL2EventListener* listener);
+		DelegateHandle add_listener(SDL2EventListener* listener);
+		void remove_listener(DelegateHandle handle);
 
 	protected:
 		Logger& _logger;
 		bool _running = true;
-		Set<SDL2EventListener*> _listeners;
+		DelegateList<Bool(const SDL_Event&)> _listeners;
 	};
 }
 #endif
\ No newline at end of file
@@ -1,18 +1,17 @@
 #include "SDL2Renderer.hpp"
 #if defined(UNICORE_USE_SDL2)
 #include "unicore/io/Logger.hpp"
+#include "unicore/math/Math.hpp"
+#include "unicore/system/Profiler.hpp"
+#include "unicore/system/FrameArena.hpp"
+#include "unicore/renderer/PixelConvert.hpp"
 #include "SDL2Texture.hpp"
 #include "SDL2Display.hpp"
 
 namespace unicore
 {
-	static List<SDL_Point> s_points;
-	static List<SDL_FPoint> s_points_f;
-
-	static List<SDL_Rect> s_rects;
-	static List<SDL_FRect> s_rects_f;
-
-	static std::vector<SDL_Vertex> s_vertices;
+	// SDL_PIXELFORMAT_ABGR8888 used by create_texture
+	static constexpr auto s_texture_format = pixel_format_abgr;
 
 	SDL2Renderer::SDL2Renderer(Logger& logger, SDL2Display& display)
 		: _logger(logger)
@@ -22,7 +21,21 @@ namespace unicore
 	{
 		SDL_Init(SDL_INIT_VIDEO);
 
-		_renderer = SDL_CreateRenderer(_display.handle(), -1, SDL_RENDERER_ACCELERATED);
+		if (_display.headless())
+		{
+			// Software renderer into surface of display size, nothing is presented
+			const auto& size = _display.size();
+			_surface = SDL_CreateRGBSurfaceWithFormat(0,
+				Math::max(size.x, 1), Math::max(size.y, 1), 32, SDL_PIXELFORMAT_ABGR8888);
+			if (!_surface)
+				UC_LOG_ERROR(_logger) << SDL_GetError();
+
+			_renderer = _surface ? SDL_CreateSoftwareRenderer(_surface) : nullptr;
+		}
+		else
+		{
+			_renderer = SDL_CreateRenderer(_display.handle(), -1, SDL_RENDERER_ACCELERATED);
+		}
 
 		SDL_RendererInfo info;
 		if (SDL_GetRendererInfo(_renderer, &info) == 0)
@@ -43,6 +56,9 @@ namespace unicore
 	SDL2Renderer::~SDL2Renderer()
 	{
 		SDL_DestroyRenderer(_renderer);
+
+		if (_surface)
+			SDL_FreeSurface(_surface);
 	}
 
 	Shared<Texture> SDL2Renderer::create_texture(Surface& surface)
@@ -88,30 +104,23 @@ namespace unicore
 	{
 		if (const auto tex = dynamic_cast<SDL2DynamicTexture*>(&texture))
 		{
-#if 1
-			SDL_Rect r;
-			const auto prect = rect.has_value() ? &SDL2Utils::convert(rect.value(), r) : nullptr;
+			if (rect.has_value())
+				return upload_texture_rect(*tex, surface, rect.value());
 
-			// TODO: Pass surface pitch from format
-			// The pixel data must be in the pixel format of the texture. Use SDL_QueryTexture() to query the pixel format of the texture.
-			if (SDL_UpdateTexture(tex->handle(), prect, surface.data(), surface.size().x * 4) == 0)
-				return true;
-
-			UC_LOG_ERROR(_logger) << SDL_GetError();
-			return false;
-#else
-			int pitch;
-			void* buffer;
-			if (SDL_LockTexture(tex->handle(), nullptr, &buffer, &pitch) == 0)
+			// Stream only changed areas of DynamicSurface,
+			// dirty rects are left for other textures and the caller
+			if (const auto dynamic_surface = dynamic_cast<const DynamicSurface*>(&surface))
 			{
-				Memory::copy(buffer, surface.data(), surface.size().area() * 4);
-				SDL_UnlockTexture(tex->handle());
+				for (const auto& dirty : dynamic_surface->dirty_rects())
+				{
+					if (!upload_texture_rect(*tex, surface, dirty))
+						return false;
+				}
+
 				return true;
 			}
 
-			UC_LOG_ERROR(_logger) << SDL_GetError();
-			return false;
-#endif
+			return upload_texture_rect(*tex, surface, surface.rect());
 		}
 
 		UC_LOG_ERROR(_logger) << "Invalid texture type";
@@ -120,7 +129,7 @@ namespace unicore
 
 	Shared<TargetTexture> SDL2Renderer::create_target_texture(const Vector2i& size)
 	{
-		auto tex = create_texture(size, SDL_TEXTUREACCESS_STREAMING);
+		auto tex = create_texture(size, SDL_TEXTUREACCESS_TARGET);
 		if (!tex)
 		{
 			UC_LOG_ERROR(_logger) << "Failed to create target texture";
@@ -132,6 +141,18 @@ namespace unicore
 
 	bool SDL2Renderer::set_target(const Shared<TargetTexture>& texture)
 	{
+		if (!texture)
+		{
+			if (SDL_SetRenderTarget(_renderer, nullptr) == 0)
+			{
+				_target = nullptr;
+				return true;
+			}
+
+			UC_LOG_ERROR(_logger) << SDL_GetError();
+			return false;
+		}
+
 		if (const auto tex = std::dynamic_pointer_cast<SDL2TargetTexture>(texture))
 		{
 			if (SDL_SetRenderTarget(_renderer, tex->handle()) == 0)
@@ -155,7 +176,8 @@ namespace unicore
 
 	bool SDL2Renderer::begin_frame()
 	{
-		if (_display.size() != _size)
+		// Offscreen surface keeps size of display at creation
+		if (!_surface && _display.size() != _size)
 		{
 			UC_LOG_DEBUG(_logger) << "Resized";
 			update_size();
@@ -165,7 +187,8 @@ namespace unicore
 
 		set_clip(std::nullopt);
 		set_draw_color(ColorConst4b::White);
-		_draw_calls = 0;
+		_stats = {};
+		_last_texture = nullptr;
 
 		return true;
 	}
@@ -175,6 +198,29 @@ namespace unicore
 		SDL_RenderPresent(_renderer);
 	}
 
+	bool SDL2Renderer::read_pixels(Surface& surface)
+	{
+		const auto& size = surface.size();
+		if (size != _size)
+		{
+			UC_LOG_ERROR(_logger) << "Invalid surface size " << size;
+			return false;
+		}
+
+		if (surface.format() != s_texture_format)
+		{
+			UC_LOG_ERROR(_logger) << "Invalid surface format";
+			return false;
+		}
+
+		if (SDL_RenderReadPixels(_renderer, nullptr,
+			SDL_PIXELFORMAT_ABGR8888, surface.data(), size.x * 4) == 0)
+			return true;
+
+		UC_LOG_ERROR(_logger) << SDL_GetError();
+		return false;
+	}
+
 	void SDL2Renderer::clear(const Color4b& color)
 	{
 		SDL_SetRenderDrawColor(_renderer,
@@ -244,54 +290,62 @@ namespace unicore
 	void SDL2Renderer::draw_pointi(const Vector2i& p)
 	{
 		SDL_RenderDrawPoint(_renderer, p.x, p.y);
-		_draw_calls++;
+		add_draw_call(1);
 	}
 
 	void SDL2Renderer::draw_pointf(const Vector2f& p)
 	{
 		SDL_RenderDrawPointF(_renderer, p.x, p.y);
-		_draw_calls++;
+		add_draw_call(1);
 	}
 
 	void SDL2Renderer::draw_pointsi(const Vector2i* points, unsigned count)
 	{
-		SDL2Utils::convert(points, count, s_points);
-		SDL_RenderDrawPoints(_renderer, s_points.data(), static_cast<int>(count));
-		_draw_calls++;
+		ArenaScope scope;
+		ArenaList<SDL_Point> sdl_points;
+		SDL2Utils::convert(points, count, sdl_points);
+		SDL_RenderDrawPoints(_renderer, sdl_points.data(), static_cast<int>(count));
+		add_draw_call(count);
 	}
 
 	void SDL2Renderer::draw_pointsf(const Vector2f* points, unsigned count)
 	{
-		SDL2Utils::convert(points, count, s_points_f);
-		SDL_RenderDrawPointsF(_renderer, s_points_f.data(), static_cast<int>(count));
-		_draw_calls++;
+		ArenaScope scope;
+		ArenaList<SDL_FPoint> sdl_points;
+		SDL2Utils::convert(points, count, sdl_points);
+		SDL_RenderDrawPointsF(_renderer, sdl_points.data(), static_cast<int>(count));
+		add_draw_call(count);
 	}
 
 	// DRAW LINES /////////////////////////////////////////////////////////////////
 	void SDL2Renderer::draw_linei(const Vector2i& p1, const Vector2i& p2)
 	{
 		SDL_RenderDrawLine(_renderer, p1.x, p1.y, p2.x, p2.y);
-		_draw_calls++;
+		add_draw_call(2);
 	}
 
 	void SDL2Renderer::draw_linef(const Vector2f& p1, const Vector2f& p2)
 	{
 		SDL_RenderDrawLineF(_renderer, p1.x, p1.y, p2.x, p2.y);
-		_draw_calls++;
+		add_draw_call(2);
 	}
 
 	void SDL2Renderer::draw_poly_linei(const Vector2i* points, unsigned count)
 	{
-		SDL2Utils::convert(points, count, s_points);
-		SDL_RenderDrawLines(_renderer, s_points.data(), static_cast<int>(count));
-		_draw_calls++;
+		ArenaScope scope;
+		ArenaList<SDL_Point> sdl_points;
+		SDL2Utils::convert(points, count, sdl_points);
+		SDL_RenderDrawLines(_renderer, sdl_points.data(), static_cast<int>(count));
+		add_draw_call(count);
 	}
 
 	void SDL2Renderer::draw_poly_linef(const Vector2f* points, unsigned count)
 	{
-		SDL2Utils::convert(points, count, s_points_f);
-		SDL_RenderDrawLinesF(_renderer, s_points_f.data(), static_cast<int>(count));
-		_draw_calls++;
+		ArenaScope scope;
+		ArenaList<SDL_FPoint> sdl_points;
+		SDL2Utils::convert(points, count, sdl_points);
+		SDL_RenderDrawLinesF(_renderer, sdl_points.data(), static_cast<int>(count));
+		add_draw_call(count);
 	}
 
 	// DRAW RECTS /////////////////////////////////////////////////////////////////
@@ -301,7 +355,7 @@ namespace unicore
 		SDL2Utils::convert(rect, sdl_rect);
 		if (!filled) SDL_RenderDrawRect(_renderer, &sdl_rect);
 		else SDL_RenderFillRect(_renderer, &sdl_rect);
-		_draw_calls++;
+		add_draw_call(4);
 	}
 
 	void SDL2Renderer::draw_rectf(const Rectf& rect, bool filled)
@@ -310,38 +364,45 @@ namespace unicore
 		SDL2Utils::convert(rect, sdl_rect);
 		if (!filled) SDL_RenderDrawRectF(_renderer, &sdl_rect);
 		else SDL_RenderFillRectF(_renderer, &sdl_rect);
-		_draw_calls++;
+		add_draw_call(4);
 	}
 
 	void SDL2Renderer::draw_rectsi(const Recti* rects, unsigned count, bool filled)
 	{
-		SDL2Utils::convert(rects, count, s_rects);
+		ArenaScope scope;
+		ArenaList<SDL_Rect> sdl_rects;
+		SDL2Utils::convert(rects, count, sdl_rects);
 		if (!filled)
-			SDL_RenderDrawRects(_renderer, s_rects.data(), static_cast<int>(count));
+			SDL_RenderDrawRects(_renderer, sdl_rects.data(), static_cast<int>(count));
 		else
-			SDL_RenderFillRects(_renderer, s_rects.data(), static_cast<int>(count));
-		_draw_calls++;
+			SDL_RenderFillRects(_renderer, sdl_rects.data(), static_cast<int>(count));
+		add_draw_call(count * 4);
 	}
 
 	void SDL2Renderer::draw_rectsf(const Rectf* rects, unsigned count, bool filled)
 	{
-		SDL2Utils::convert(rects, count, s_rects_f);
+		ArenaScope scope;
+		ArenaList<SDL_FRect> sdl_rects;
+		SDL2Utils::convert(rects, count, sdl_rects);
 		if (!filled)
-			SDL_RenderDrawRectsF(_renderer, s_rects_f.data(), static_cast<int>(count));
+			SDL_RenderDrawRectsF(_renderer, sdl_rects.data(), static_cast<int>(count));
 		else
-			SDL_RenderFillRectsF(_renderer, s_rects_f.data(), static_cast<int>(count));
-		_draw_calls++;
+			SDL_RenderFillRectsF(_renderer, sdl_rects.data(), static_cast<int>(count));
+		add_draw_call(count * 4);
 	}
 
 	// DRAW TRIANGLES /////////////////////////////////////////////////////////////
 	void SDL2Renderer::draw_trianglesf(
 		const VertexColor2f* vertices, unsigned num_vertices)
 	{
-		s_vertices.resize(num_vertices);
+		UC_PROFILE_SCOPE("SDL2Renderer::draw_trianglesf");
+
+		ArenaScope scope;
+		ArenaList<SDL_Vertex> sdl_vertices(num_vertices);
 		for (size_t i = 0; i < num_vertices; i++)
 		{
 			const auto& vertex = vertices[i];
-			auto& [position, color, uv] = s_vertices[i];
+			auto& [position, color, uv] = sdl_vertices[i];
 
 			position.x = vertex.pos.x;
 			position.y = vertex.pos.y;
@@ -353,26 +414,29 @@ namespace unicore
 
 		const auto result = SDL_RenderGeometry(
 			_renderer, nullptr,
-			s_vertices.data(), static_cast<int>(num_vertices),
+			sdl_vertices.data(), static_cast<int>(num_vertices),
 			nullptr, 0
 		);
 		if (result != 0)
 			UC_LOG_ERROR(_logger) << SDL_GetError();
 
-		_draw_calls++;
+		add_draw_call(num_vertices);
 	}
 
 	void SDL2Renderer::draw_trianglesf(const VertexColorTexture2f* vertices,
 		unsigned num_vertices, const Texture* texture)
 	{
+		UC_PROFILE_SCOPE("SDL2Renderer::draw_trianglesf");
+
 		const auto tex = dynamic_cast<const SDL2BaseTexture*>(texture);
 		const auto tex_handle = tex ? tex->handle() : nullptr;
 
-		s_vertices.resize(num_vertices);
+		ArenaScope scope;
+		ArenaList<SDL_Vertex> sdl_vertices(num_vertices);
 		for (size_t i = 0; i < num_vertices; i++)
 		{
 			const auto& vertex = vertices[i];
-			auto& [position, color, uv] = s_vertices[i];
+			auto& [position, color, uv] = sdl_vertices[i];
 
 			position.x = vertex.pos.x;
 			position.y = vertex.pos.y;
@@ -386,13 +450,13 @@ namespace unicore
 
 		const auto result = SDL_RenderGeometry(
 			_renderer, tex_handle,
-			s_vertices.data(), static_cast<int>(num_vertices),
+			sdl_vertices.data(), static_cast<int>(num_vertices),
 			nullptr, 0
 		);
 		if (result != 0)
 			UC_LOG_ERROR(_logger) << SDL_GetError();
 
-		_draw_calls++;
+		add_draw_call(num_vertices, tex_handle);
 	}
 
 	// COPY TEXTURE ///////////////////////////////////////////////////////////////
@@ -408,7 +472,7 @@ namespace unicore
 
 			if (result == 0)
 			{
-				_draw_calls++;
+				add_draw_call(4, tex->handle());
 				return true;
 			}
 
@@ -431,7 +495,7 @@ namespace unicore
 
 			if (result == 0)
 			{
-				_draw_calls++;
+				add_draw_call(4, tex->handle());
 				return true;
 			}
 
@@ -460,7 +524,7 @@ namespace unicore
 
 			if (result == 0)
 			{
-				_draw_calls++;
+				add_draw_call(4, tex->handle());
 				return true;
 			}
 
@@ -490,7 +554,7 @@ namespace unicore
 
 			if (result == 0)
 			{
-				_draw_calls++;
+				add_draw_call(4, tex->handle());
 				return true;
 			}
 
@@ -542,6 +606,18 @@ namespace unicore
 		SDL_RenderGetLogicalSize(_renderer, &_logical_size.x, &_logical_size.y);
 	}
 
+	void SDL2Renderer::add_draw_call(unsigned vertices, SDL_Texture* texture)
+	{
+		_stats.draw_calls++;
+		_stats.vertices += vertices;
+
+		if (texture != _last_texture)
+		{
+			_stats.texture_switches++;
+			_last_texture = texture;
+		}
+	}
+
 	SDL_Texture* SDL2Renderer::create_texture(const Vector2i& size, SDL_TextureAccess access) const
 	{
 		const auto tex = SDL_CreateTexture(_renderer,
@@ -556,6 +632,40 @@ namespace unicore
 		return tex;
 	}
 
+	bool SDL2Renderer::upload_texture_rect(SDL2DynamicTexture& texture,
+		const Surface& surface, const Recti& rect) const
+	{
+		const auto clipped = surface.get_clip_rect(rect)
+			.intersection({ VectorConst2i::Zero, texture.size() });
+		if (!clipped.has_value())
+			return true;
+
+		const auto& r = clipped.value();
+
+		SDL_Rect sdl_rect;
+		void* pixels;
+		int pitch;
+		if (SDL_LockTexture(texture.handle(), &SDL2Utils::convert(r, sdl_rect), &pixels, &pitch) != 0)
+		{
+			UC_LOG_ERROR(_logger) << SDL_GetError();
+			return false;
+		}
+
+		const auto width = surface.size().x;
+		const auto src = static_cast<const UInt32*>(surface.data()) + r.pos.y * width + r.pos.x;
+		auto dest = static_cast<UInt8*>(pixels);
+
+		// Locked area starts at rect with pitch of the whole texture
+		for (int y = 0; y < r.size.y; y++, dest += pitch)
+		{
+			PixelConvert::convert(s_texture_format, reinterpret_cast<UInt32*>(dest),
+				surface.format(), src + y * width, r.size.x);
+		}
+
+		SDL_UnlockTexture(texture.handle());
+		return true;
+	}
+
 	SDL_RendererFlip SDL2Renderer::convert_flip(sdl2::RenderFlip flags)
 	{
 		int value = SDL_FLIP_NONE;
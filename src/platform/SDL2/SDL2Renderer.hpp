@@ -9,6 +9,7 @@ namespace unicore
 {
 	class Display;
 	class SDL2Display;
+	class SDL2DynamicTexture;
 	class SDL2TargetTexture;
 
 	class SDL2Renderer : public sdl2::Pipeline
@@ -20,7 +21,7 @@ namespace unicore
 		UC_TYPE_DELETE_MOVE_COPY(SDL2Renderer);
 
 		UC_NODISCARD const Vector2i& screen_size() const override { return _size; }
-		UC_NODISCARD uint32_t draw_calls() const override { return _draw_calls; }
+		UC_NODISCARD const RendererStats& stats() const override { return _stats; }
 
 		Shared<Texture> create_texture(Surface& surface) override;
 
@@ -34,6 +35,8 @@ namespace unicore
 		bool begin_frame() override;
 		void end_frame() override;
 
+		bool read_pixels(Surface& surface) override;
+
 		void clear(const Color4b& color) override;
 
 		// STATES
@@ -102,6 +105,7 @@ namespace unicore
 		Logger& _logger;
 		SDL2Display& _display;
 		SDL_Renderer* _renderer;
+		SDL_Surface* _surface = nullptr;
 		Vector2i _size = VectorConst2i::Zero;
 
 		// STATES
@@ -109,7 +113,8 @@ namespace unicore
 		Optional<Recti> _clip_rect;
 		Vector2f _scale;
 		Vector2i _logical_size;
-		uint32_t _draw_calls = 0;
+		RendererStats _stats;
+		SDL_Texture* _last_texture = nullptr;
 		Color4b _color = ColorConst4b::White;
 		Shared<TargetTexture> _target;
 
@@ -118,7 +123,10 @@ namespace unicore
 		void update_viewport();
 		void update_logical_size();
 
+		void add_draw_call(unsigned vertices, SDL_Texture* texture = nullptr);
+
 		UC_NODISCARD SDL_Texture* create_texture(const Vector2i& size, SDL_TextureAccess access) const;
+		bool upload_texture_rect(SDL2DynamicTexture& texture, const Surface& surface, const Recti& rect) const;
 
 		static SDL_RendererFlip convert_flip(sdl2::RenderFlip flags);
 	};
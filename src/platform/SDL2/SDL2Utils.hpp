@@ -65,28 +65,32 @@ namespace unicore
 			return dst;
 		}
 
-		static void convert(const Vector2i* src, size_t count, List<SDL_Point>& dst)
+		template<typename TAlloc>
+		static void convert(const Vector2i* src, size_t count, std::vector<SDL_Point, TAlloc>& dst)
 		{
 			dst.resize(count);
 			for (size_t i = 0; i < count; i++)
 				convert(src[i], dst[i]);
 		}
 
-		static void convert(const Vector2f* src, size_t count, List<SDL_FPoint>& dst)
+		template<typename TAlloc>
+		static void convert(const Vector2f* src, size_t count, std::vector<SDL_FPoint, TAlloc>& dst)
 		{
 			dst.resize(count);
 			for (size_t i = 0; i < count; i++)
 				convert(src[i], dst[i]);
 		}
 
-		static void convert(const Recti* src, size_t count, List<SDL_Rect>& dst)
+		template<typename TAlloc>
+		static void convert(const Recti* src, size_t count, std::vector<SDL_Rect, TAlloc>& dst)
 		{
 			dst.resize(count);
 			for (size_t i = 0; i < count; i++)
 				convert(src[i], dst[i]);
 		}
 
-		static void convert(const Rectf* src, size_t count, List<SDL_FRect>& dst)
+		template<typename TAlloc>
+		static void convert(const Rectf* src, size_t count, std::vector<SDL_FRect, TAlloc>& dst)
 		{
 			dst.resize(count);
 			for (size_t i = 0; i < count; i++)
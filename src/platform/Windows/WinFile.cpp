@@ -1,5 +1,6 @@
 #include "WinFile.hpp"
 #if defined(UNICORE_PLATFORM_WINDOWS)
+#include "unicore/resource/BinaryData.hpp"
 
 namespace unicore
 {
@@ -65,6 +66,26 @@ namespace unicore
 		return result;
 	}
 
+	Shared<BasicBinaryData> WinFile::map()
+	{
+		const auto file_size = size();
+		if (file_size <= 0)
+			return ReadFile::map();
+
+		const auto mapping = CreateFileMappingW(_handle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+		if (mapping == nullptr)
+			return ReadFile::map();
+
+		// View keeps mapping object alive
+		const auto data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+		CloseHandle(mapping);
+		if (data == nullptr)
+			return ReadFile::map();
+
+		const Shared<void> owner(data, [](void* ptr) { UnmapViewOfFile(ptr); });
+		return std::make_shared<BinaryDataView>(data, static_cast<size_t>(file_size), owner);
+	}
+
 	bool WinFile::write(const void* buffer, size_t size, size_t* bytes_written)
 	{
 		DWORD count;
@@ -18,14 +18,14 @@ namespace unicore
 	{
 	}
 
-	bool WinFileProvider::exists(const Path& path) const
+	bool WinFileProvider::exists(PathView path) const
 	{
 		const auto native_path = to_native_path(path);
 		const auto flags = GetFileAttributesW(native_path.c_str());
 		return flags != INVALID_FILE_ATTRIBUTES ? true : false;
 	}
 
-	Optional<FileStats> WinFileProvider::stats(const Path& path) const
+	Optional<FileStats> WinFileProvider::stats(PathView path) const
 	{
 		const auto native_path = to_native_path(path);
 
@@ -107,7 +107,7 @@ namespace unicore
 		return false;
 	}
 
-	Shared<ReadFile> WinFileProvider::open_read(const Path& path)
+	Shared<ReadFile> WinFileProvider::open_read(PathView path)
 	{
 		const auto native_path = to_native_path(path);
 
@@ -160,9 +160,9 @@ namespace unicore
 		return Path::Empty;
 	}
 
-	std::wstring WinFileProvider::to_native_path(const Path& path) const
+	std::wstring WinFileProvider::to_native_path(PathView path) const
 	{
-		return Unicode::to_wcs((_current_dir / path).native_path());
+		return Unicode::to_wcs(Path::combine_native(_current_dir, path));
 	}
 
 	DateTime WinFileProvider::to_datetime(FILETIME const& ft)
@@ -13,8 +13,8 @@ namespace unicore
 		explicit WinFileProvider(Logger& logger);
 		WinFileProvider(Logger& logger, const Path& current_dir);
 
-		UC_NODISCARD bool exists(const Path& path) const override;
-		UC_NODISCARD Optional<FileStats> stats(const Path& path) const override;
+		UC_NODISCARD bool exists(PathView path) const override;
+		UC_NODISCARD Optional<FileStats> stats(PathView path) const override;
 
 		uint16_t enumerate_entries(const Path& path, StringView search_pattern,
 			List<String>& name_list, const EnumerateOptions& options) const override;
@@ -22,7 +22,7 @@ namespace unicore
 		bool create_directory(const Path& path) override;
 		bool delete_directory(const Path& path, bool recursive) override;
 
-		Shared<ReadFile> open_read(const Path& path) override;
+		Shared<ReadFile> open_read(PathView path) override;
 		Shared<WriteFile> create_new(const Path& path) override;
 
 		bool delete_file(const Path& path) override;
@@ -32,7 +32,7 @@ namespace unicore
 		Path _current_dir;
 
 		UC_NODISCARD Path get_current_dir() const;
-		UC_NODISCARD std::wstring to_native_path(const Path& path) const;
+		UC_NODISCARD std::wstring to_native_path(PathView path) const;
 
 		static DateTime to_datetime(FILETIME const& ft);
 		static FileType get_file_type(DWORD attributes);
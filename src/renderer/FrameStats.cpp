@@ -0,0 +1,154 @@
+#include "unicore/renderer/FrameStats.hpp"
+#include "unicore/math/Math.hpp"
+#include "unicore/system/StringBuilder.hpp"
+#include "unicore/io/FileProvider.hpp"
+#include "unicore/io/File.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace unicore
+{
+	static Double to_milliseconds(const TimeSpan& time)
+	{
+		return static_cast<Double>(time.data().count()) / 1000000.0;
+	}
+
+	FrameStats::FrameStats(UInt32 capacity)
+	{
+		set_capacity(capacity);
+	}
+
+	void FrameStats::set_capacity(UInt32 capacity)
+	{
+		_samples.resize(Math::max(capacity, 1u));
+		_sorted.reserve(_samples.size());
+		clear();
+	}
+
+	const FrameSample& FrameStats::get(UInt32 index) const
+	{
+		return _samples[(_first + index) % _samples.size()];
+	}
+
+	void FrameStats::add(const FrameSample& sample)
+	{
+		const auto capacity = static_cast<UInt32>(_samples.size());
+		if (_size < capacity)
+		{
+			_samples[(_first + _size) % capacity] = sample;
+			_size++;
+		}
+		else
+		{
+			_samples[_first] = sample;
+			_first = (_first + 1) % capacity;
+		}
+
+		_total++;
+	}
+
+	void FrameStats::clear()
+	{
+		_first = 0;
+		_size = 0;
+		_total = 0;
+	}
+
+	Float FrameStats::fps() const
+	{
+		TimeSpan time = TimeSpanConst::Zero;
+		for (UInt32 i = 0; i < _size; i++)
+			time += get(i).interval;
+
+		return time > TimeSpanConst::Zero
+			? static_cast<Float>(_size / time.total_seconds()) : 0;
+	}
+
+	FrameStats::Summary FrameStats::summary(Field field) const
+	{
+		if (_size == 0)
+			return {};
+
+		_sorted.clear();
+		TimeSpan total = TimeSpanConst::Zero;
+		for (UInt32 i = 0; i < _size; i++)
+		{
+			const auto& value = get(i).*field;
+			_sorted.push_back(value);
+			total += value;
+		}
+
+		std::sort(_sorted.begin(), _sorted.end());
+
+		// Nearest rank
+		const auto percentile = [this](UInt32 percent)
+		{
+			const auto rank = (static_cast<UInt64>(_sorted.size()) * percent + 99) / 100;
+			return _sorted[rank > 0 ? rank - 1 : 0];
+		};
+
+		Summary result;
+		result.min = _sorted.front();
+		result.avg = TimeSpan(total.data() / _size);
+		result.p50 = percentile(50);
+		result.p95 = percentile(95);
+		result.p99 = percentile(99);
+		result.max = _sorted.back();
+		return result;
+	}
+
+	void FrameStats::histogram(Histogram& buckets, Field field) const
+	{
+		buckets.fill(0);
+		for (UInt32 i = 0; i < _size; i++)
+			buckets[bucket_index(get(i).*field)]++;
+	}
+
+	TimeSpan FrameStats::bucket_limit(UInt32 index)
+	{
+		const auto scale = std::pow(2.0, static_cast<Double>(index) / 2);
+		return TimeSpan::from_duration(HistogramBase.data() * scale);
+	}
+
+	UInt32 FrameStats::bucket_index(const TimeSpan& time)
+	{
+		if (time < HistogramBase)
+			return 0;
+
+		const auto ratio = static_cast<Double>(time.data().count()) /
+			static_cast<Double>(HistogramBase.data().count());
+		const auto index = static_cast<UInt32>(std::floor(std::log2(ratio) * 2)) + 1;
+		return Math::min(index, HistogramSize - 1);
+	}
+
+	Bool FrameStats::write_csv(WriteFileProvider& provider, const Path& path) const
+	{
+		const auto file = provider.create_new(path);
+		if (!file)
+			return false;
+
+		StringBuilder builder;
+		builder << "frame,interval_ms,frame_ms,update_ms,draw_ms,draw_calls,vertices,texture_switches\n";
+
+		const auto first_frame = _total - _size;
+		for (UInt32 i = 0; i < _size; i++)
+		{
+			const auto& sample = get(i);
+
+			builder << (first_frame + i) << ',';
+			builder.append_float(to_milliseconds(sample.interval), 3);
+			builder << ',';
+			builder.append_float(to_milliseconds(sample.frame), 3);
+			builder << ',';
+			builder.append_float(to_milliseconds(sample.update), 3);
+			builder << ',';
+			builder.append_float(to_milliseconds(sample.draw), 3);
+			builder << ',' << sample.render.draw_calls
+				<< ',' << sample.render.vertices
+				<< ',' << sample.render.texture_switches << '\n';
+		}
+
+		file->write(builder.c_str(), builder.size());
+		return file->flush();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include "unicore/renderer/FrameStatsGraph.hpp"
+#include "unicore/math/Math.hpp"
+
+namespace unicore
+{
+	void FrameStatsGraph::draw(PrimitiveBatch& batch, const FrameStats& stats, const Rectf& rect) const
+	{
+		const auto count = stats.size();
+		if (count == 0 || max_time <= TimeSpanConst::Zero)
+			return;
+
+		const auto base = rect.pos.y + rect.size.y;
+		const auto bar_width = rect.size.x / static_cast<Float>(stats.capacity());
+		const auto offset = rect.pos.x + rect.size.x - bar_width * static_cast<Float>(count);
+
+		const auto to_height = [&](const TimeSpan& time)
+		{
+			const auto value = static_cast<Float>(time.total_seconds() / max_time.total_seconds());
+			return Math::clamp_01(value) * rect.size.y;
+		};
+
+		// Parts are drawn one after another, so every color goes to single batch
+		const auto draw_part = [&](const Color4b& color, const auto& get_range)
+		{
+			batch.set_color(color);
+			for (UInt32 i = 0; i < count; i++)
+			{
+				const auto [from, to] = get_range(stats.get(i));
+				const auto y0 = base - to_height(from);
+				const auto y1 = base - to_height(to);
+				if (y0 - y1 < 0.5f)
+					continue;
+
+				const auto x0 = offset + bar_width * static_cast<Float>(i);
+				const auto x1 = x0 + Math::max(bar_width - 1, 1.f);
+				batch.draw_quad({ x0, y1 }, { x1, y1 }, { x1, y0 }, { x0, y0 });
+			}
+		};
+
+		draw_part(update_color, [](const FrameSample& sample)
+		{
+			return std::make_pair(TimeSpanConst::Zero, sample.update);
+		});
+		draw_part(draw_color, [](const FrameSample& sample)
+		{
+			return std::make_pair(sample.update, sample.update + sample.draw);
+		});
+		draw_part(other_color, [](const FrameSample& sample)
+		{
+			return std::make_pair(sample.update + sample.draw, sample.frame);
+		});
+
+		if (budget > TimeSpanConst::Zero && budget <= max_time)
+		{
+			const auto y = base - to_height(budget);
+			batch.set_color(budget_color);
+			batch.draw_line(Vector2f(rect.pos.x, y), Vector2f(rect.pos.x + rect.size.x, y));
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,223 @@
+#include "unicore/renderer/PixelConvert.hpp"
+#include "unicore/system/Memory.hpp"
+#if defined(UNICORE_CPU_SSE2)
+#	include <emmintrin.h>
+#elif defined(UNICORE_CPU_NEON)
+#	include <arm_neon.h>
+#endif
+
+namespace unicore::PixelConvert
+{
+	static_assert(sizeof(Color4b) == sizeof(UInt32));
+
+	static constexpr UInt32 swizzle_pixel(
+		const Format& dest_format, const Format& src_format, UInt32 value)
+	{
+		return
+			(((value >> src_format.r_shift) & 0xFF) << dest_format.r_shift) |
+			(((value >> src_format.g_shift) & 0xFF) << dest_format.g_shift) |
+			(((value >> src_format.b_shift) & 0xFF) << dest_format.b_shift) |
+			(((value >> src_format.a_shift) & 0xFF) << dest_format.a_shift);
+	}
+
+	// Exact round(x * a / 255) for x, a in [0..255]
+	static constexpr UInt32 mul_div255(UInt32 x, UInt32 a)
+	{
+		const auto t = x * a + 128;
+		return (t + (t >> 8)) >> 8;
+	}
+
+	static constexpr UInt32 premultiply_pixel(const Format& format, UInt32 value)
+	{
+		const auto a = (value >> format.a_shift) & 0xFF;
+		return
+			(mul_div255((value >> format.r_shift) & 0xFF, a) << format.r_shift) |
+			(mul_div255((value >> format.g_shift) & 0xFF, a) << format.g_shift) |
+			(mul_div255((value >> format.b_shift) & 0xFF, a) << format.b_shift) |
+			(a << format.a_shift);
+	}
+
+	void copy(UInt32* dest, const UInt32* src, Size count)
+	{
+		Memory::copy(dest, src, count * sizeof(UInt32));
+	}
+
+	void fill(UInt32* dest, UInt32 value, Size count)
+	{
+		Size i = 0;
+#if defined(UNICORE_CPU_SSE2)
+		const auto v = _mm_set1_epi32(static_cast<int>(value));
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), v);
+#elif defined(UNICORE_CPU_NEON)
+		const auto v = vdupq_n_u32(value);
+		for (; i + 4 <= count; i += 4)
+			vst1q_u32(dest + i, v);
+#endif
+		for (; i < count; i++)
+			dest[i] = value;
+	}
+
+	void convert(const Format& dest_format, UInt32* dest,
+		const Format& src_format, const UInt32* src, Size count)
+	{
+		if (dest_format == src_format)
+		{
+			copy(dest, src, count);
+			return;
+		}
+
+		Size i = 0;
+#if defined(UNICORE_CPU_SSE2)
+		const auto mask = _mm_set1_epi32(0xFF);
+		const auto sr = _mm_cvtsi32_si128(src_format.r_shift);
+		const auto sg = _mm_cvtsi32_si128(src_format.g_shift);
+		const auto sb = _mm_cvtsi32_si128(src_format.b_shift);
+		const auto sa = _mm_cvtsi32_si128(src_format.a_shift);
+		const auto dr = _mm_cvtsi32_si128(dest_format.r_shift);
+		const auto dg = _mm_cvtsi32_si128(dest_format.g_shift);
+		const auto db = _mm_cvtsi32_si128(dest_format.b_shift);
+		const auto da = _mm_cvtsi32_si128(dest_format.a_shift);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+			const auto r = _mm_sll_epi32(_mm_and_si128(_mm_srl_epi32(v, sr), mask), dr);
+			const auto g = _mm_sll_epi32(_mm_and_si128(_mm_srl_epi32(v, sg), mask), dg);
+			const auto b = _mm_sll_epi32(_mm_and_si128(_mm_srl_epi32(v, sb), mask), db);
+			const auto a = _mm_sll_epi32(_mm_and_si128(_mm_srl_epi32(v, sa), mask), da);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i),
+				_mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, a)));
+		}
+#elif defined(UNICORE_CPU_NEON)
+		// Components are whole bytes, so a shift selects a byte lane
+		for (; i + 16 <= count; i += 16)
+		{
+			const auto v = vld4q_u8(reinterpret_cast<const UInt8*>(src + i));
+			uint8x16x4_t out;
+			out.val[dest_format.r_shift / 8] = v.val[src_format.r_shift / 8];
+			out.val[dest_format.g_shift / 8] = v.val[src_format.g_shift / 8];
+			out.val[dest_format.b_shift / 8] = v.val[src_format.b_shift / 8];
+			out.val[dest_format.a_shift / 8] = v.val[src_format.a_shift / 8];
+			vst4q_u8(reinterpret_cast<UInt8*>(dest + i), out);
+		}
+#endif
+		for (; i < count; i++)
+			dest[i] = swizzle_pixel(dest_format, src_format, src[i]);
+	}
+
+	void to_colors(const Format& format,
+		const UInt32* src, Color4b* dest, Size count)
+	{
+		convert(color4b_format, reinterpret_cast<UInt32*>(dest), format, src, count);
+	}
+
+	void from_colors(const Format& format,
+		const Color4b* src, UInt32* dest, Size count)
+	{
+		convert(format, dest, color4b_format, reinterpret_cast<const UInt32*>(src), count);
+	}
+
+	void expand_alpha(const Format& format, const UInt8* alpha,
+		UInt32* dest, Size count, const Color4b& color)
+	{
+		const auto rgb = Color4b(color.r, color.g, color.b, 0).to_format(format);
+
+		Size i = 0;
+#if defined(UNICORE_CPU_SSE2)
+		const auto zero = _mm_setzero_si128();
+		const auto base = _mm_set1_epi32(static_cast<int>(rgb));
+		const auto shift = _mm_cvtsi32_si128(format.a_shift);
+
+		for (; i + 16 <= count; i += 16)
+		{
+			const auto a8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(alpha + i));
+			const auto lo = _mm_unpacklo_epi8(a8, zero);
+			const auto hi = _mm_unpackhi_epi8(a8, zero);
+			const __m128i a32[4] = {
+				_mm_unpacklo_epi16(lo, zero), _mm_unpackhi_epi16(lo, zero),
+				_mm_unpacklo_epi16(hi, zero), _mm_unpackhi_epi16(hi, zero),
+			};
+
+			for (int j = 0; j < 4; j++)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i + j * 4),
+					_mm_or_si128(base, _mm_sll_epi32(a32[j], shift)));
+			}
+		}
+#elif defined(UNICORE_CPU_NEON)
+		uint8x16x4_t out;
+		out.val[format.r_shift / 8] = vdupq_n_u8(color.r);
+		out.val[format.g_shift / 8] = vdupq_n_u8(color.g);
+		out.val[format.b_shift / 8] = vdupq_n_u8(color.b);
+
+		for (; i + 16 <= count; i += 16)
+		{
+			out.val[format.a_shift / 8] = vld1q_u8(alpha + i);
+			vst4q_u8(reinterpret_cast<UInt8*>(dest + i), out);
+		}
+#endif
+		for (; i < count; i++)
+			dest[i] = rgb | (static_cast<UInt32>(alpha[i]) << format.a_shift);
+	}
+
+	void premultiply(const Format& format, UInt32* data, Size count)
+	{
+		Size i = 0;
+#if defined(UNICORE_CPU_SSE2)
+		const auto zero = _mm_setzero_si128();
+		const auto mask = _mm_set1_epi32(0xFF);
+		const auto round = _mm_set1_epi16(128);
+		const auto shift = _mm_cvtsi32_si128(format.a_shift);
+		// Alpha lane of every pixel unpacked to 16 bit is multiplied by 255
+		const auto alpha_lane = _mm_set1_epi64x(
+			static_cast<Int64>(0xFFFFull << (format.a_shift / 8 * 16)));
+		const auto alpha_keep = _mm_and_si128(alpha_lane, _mm_set1_epi16(255));
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+
+			auto a = _mm_and_si128(_mm_srl_epi32(v, shift), mask);
+			a = _mm_or_si128(a, _mm_slli_epi32(a, 16));
+
+			const __m128i mult[2] = {
+				_mm_or_si128(_mm_andnot_si128(alpha_lane, _mm_unpacklo_epi32(a, a)), alpha_keep),
+				_mm_or_si128(_mm_andnot_si128(alpha_lane, _mm_unpackhi_epi32(a, a)), alpha_keep),
+			};
+			__m128i x[2] = { _mm_unpacklo_epi8(v, zero), _mm_unpackhi_epi8(v, zero) };
+
+			for (int j = 0; j < 2; j++)
+			{
+				const auto t = _mm_add_epi16(_mm_mullo_epi16(x[j], mult[j]), round);
+				x[j] = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+			}
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(data + i),
+				_mm_packus_epi16(x[0], x[1]));
+		}
+#elif defined(UNICORE_CPU_NEON)
+		const unsigned channels[3] = {
+			format.r_shift / 8u, format.g_shift / 8u, format.b_shift / 8u };
+
+		for (; i + 16 <= count; i += 16)
+		{
+			auto v = vld4q_u8(reinterpret_cast<const UInt8*>(data + i));
+			const auto a = v.val[format.a_shift / 8];
+
+			for (const auto c : channels)
+			{
+				const auto lo = vmull_u8(vget_low_u8(v.val[c]), vget_low_u8(a));
+				const auto hi = vmull_u8(vget_high_u8(v.val[c]), vget_high_u8(a));
+				v.val[c] = vcombine_u8(
+					vraddhn_u16(lo, vrshrq_n_u16(lo, 8)),
+					vraddhn_u16(hi, vrshrq_n_u16(hi, 8)));
+			}
+
+			vst4q_u8(reinterpret_cast<UInt8*>(data + i), v);
+		}
+#endif
+		for (; i < count; i++)
+			data[i] = premultiply_pixel(format, data[i]);
+	}
+}
\ No newline at end of file
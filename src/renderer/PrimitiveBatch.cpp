@@ -1,15 +1,17 @@
 #include "unicore/renderer/PrimitiveBatch.hpp"
 #include "unicore/math/ShapePrimitive.hpp"
 #include "unicore/renderer/Font.hpp"
+#include "unicore/system/FrameArena.hpp"
 
 namespace unicore
 {
-	static List<Vector2f> s_points;
-	static List<VertexColor2f> s_verts;
 	static List<QuadColor2f> s_quads;
 
 	void PrimitiveBatch::render(sdl2::PipelineRender& renderer) const
 	{
+		ArenaScope scope;
+		ArenaList<VertexColor2f> verts;
+
 		for (const auto& batch : _batches)
 		{
 			renderer.set_draw_color(batch.color);
@@ -40,13 +42,13 @@ namespace unicore
 				break;
 
 			case BatchType::Triangles:
-				s_verts.resize(batch.count);
+				verts.resize(batch.count);
 				for (unsigned i = 0; i < batch.count; i++)
 				{
-					s_verts[i].pos = _points[batch.start + i];
-					s_verts[i].col = batch.color;
+					verts[i].pos = _points[batch.start + i];
+					verts[i].col = batch.color;
 				}
-				renderer.draw_trianglesf(s_verts.data(), batch.count);
+				renderer.draw_trianglesf(verts.data(), batch.count);
 				break;
 
 			default:
@@ -172,11 +174,16 @@ namespace unicore
 
 	PrimitiveBatch& PrimitiveBatch::draw_poly_line(const List<Vector2f>& points, bool closed)
 	{
-		if (points.size() > 1)
+		return draw_poly_line(points.data(), static_cast<unsigned>(points.size()), closed);
+	}
+
+	PrimitiveBatch& PrimitiveBatch::draw_poly_line(const Vector2f* points, unsigned count, bool closed)
+	{
+		if (count > 1)
 		{
 			set_type(BatchType::Line);
 
-			for (unsigned i = 0; i + 1 < points.size(); i++)
+			for (unsigned i = 0; i + 1 < count; i++)
 			{
 				_points.push_back(transform * points[i]);
 				_points.push_back(transform * points[i + 1]);
@@ -185,8 +192,8 @@ namespace unicore
 
 			if (closed)
 			{
-				_points.push_back(transform * points.back());
-				_points.push_back(transform * points.front());
+				_points.push_back(transform * points[count - 1]);
+				_points.push_back(transform * points[0]);
 				_current.count += 2;
 			}
 		}
@@ -199,17 +206,15 @@ namespace unicore
 		unsigned i0, i1;
 		Vector2f dir, perpendicular;
 
-		PathEdge(const List<Vector2f>& points, unsigned index)
-			: i0(index), i1((index + 1) % points.size())
+		PathEdge(const Vector2f* points, unsigned count, unsigned index)
+			: i0(index), i1((index + 1) % count)
 			, dir((points[i1] - points[i0]).normalized())
 			, perpendicular(dir.perpendicular())
 		{
 		}
 	};
 
-	static List<PathEdge> s_path;
-
-	static int clamp_path_index(const List<PathEdge>& path, int index, bool closed)
+	static int clamp_path_index(const ArenaList<PathEdge>& path, int index, bool closed)
 	{
 		const int count = static_cast<int>(path.size());
 		if (index < 0)
@@ -227,8 +232,8 @@ namespace unicore
 		return index;
 	}
 
-	static void draw_path_segment(PrimitiveBatch& graphics, const List<Vector2f>& points,
-		const PrimitiveBatchLineStyle& style, const List<PathEdge>& path, unsigned index, bool closed)
+	static void draw_path_segment(PrimitiveBatch& graphics, const Vector2f* points,
+		const PrimitiveBatchLineStyle& style, const ArenaList<PathEdge>& path, unsigned index, bool closed)
 	{
 		auto& edge = path[index];
 		const auto p0 = points[edge.i0];
@@ -277,18 +282,25 @@ namespace unicore
 
 	PrimitiveBatch& PrimitiveBatch::draw_path(const List<Vector2f>& points, const PrimitiveBatchLineStyle& style, bool closed)
 	{
-		if (points.size() >= 2)
+		return draw_path(points.data(), static_cast<unsigned>(points.size()), style, closed);
+	}
+
+	PrimitiveBatch& PrimitiveBatch::draw_path(const Vector2f* points, unsigned count, const PrimitiveBatchLineStyle& style, bool closed)
+	{
+		if (count >= 2)
 		{
-			s_path.clear();
+			ArenaScope scope;
+			ArenaList<PathEdge> path;
+			path.reserve(count);
 
-			for (unsigned i = 0; i + 1 < points.size(); i++)
-				s_path.emplace_back(points, i);
+			for (unsigned i = 0; i + 1 < count; i++)
+				path.emplace_back(points, count, i);
 
 			if (closed)
-				s_path.emplace_back(points, points.size() - 1);
+				path.emplace_back(points, count, count - 1);
 
-			for (unsigned i = 0; i < s_path.size(); i++)
-				draw_path_segment(*this, points, style, s_path, i, closed);
+			for (unsigned i = 0; i < path.size(); i++)
+				draw_path_segment(*this, points, style, path, i, closed);
 		}
 
 		return *this;
@@ -331,37 +343,34 @@ namespace unicore
 		if (radius == 0)
 			return draw_point(center);
 
-		s_points.clear();
-		ShapePrimitive::circle(s_points, center, radius, segments);
+		ArenaScope scope;
+		ArenaList<Vector2f> points;
+		ShapePrimitive::circle(points, center, radius, segments);
 
-		return !filled
-			? draw_poly_line(s_points, true)
-			: draw_convex_poly(s_points);
+		return draw_shape(points, filled);
 	}
 
 	PrimitiveBatch& PrimitiveBatch::draw_ellipse(const Vector2f& center, const Vector2f& radius, bool filled, unsigned segments)
 	{
-		s_points.clear();
-		ShapePrimitive::ellipse(s_points, center, radius, segments);
+		ArenaScope scope;
+		ArenaList<Vector2f> points;
+		ShapePrimitive::ellipse(points, center, radius, segments);
 
-		return !filled
-			? draw_poly_line(s_points, true)
-			: draw_convex_poly(s_points);
+		return draw_shape(points, filled);
 	}
 
 	PrimitiveBatch& PrimitiveBatch::draw_star(const Vector2f& center, unsigned count, float radius, bool filled)
 	{
 		if (count >= 2)
 		{
-			s_points.clear();
-			ShapePrimitive::star(s_points, center, count, radius);
-
+			ArenaScope scope;
+			ArenaList<Vector2f> points;
 			if (filled)
-				s_points.insert(s_points.begin(), center);
+				points.push_back(center);
+
+			ShapePrimitive::star(points, center, count, radius);
 
-			return !filled
-				? draw_poly_line(s_points, true)
-				: draw_convex_poly(s_points);
+			return draw_shape(points, filled);
 		}
 
 		return *this;
@@ -371,28 +380,31 @@ namespace unicore
 		const Vector2f& p0, const Vector2f& p1, const Vector2f& p2,
 		unsigned segments)
 	{
-		s_points.clear();
-		ShapePrimitive::bezier3(s_points, p0, p1, p2, segments);
+		ArenaScope scope;
+		ArenaList<Vector2f> points;
+		ShapePrimitive::bezier3(points, p0, p1, p2, segments);
 
-		return draw_poly_line(s_points, false);
+		return draw_poly_line(points.data(), static_cast<unsigned>(points.size()), false);
 	}
 
 	PrimitiveBatch& PrimitiveBatch::draw_curve(
 		const Vector2f& p0, const Vector2f& p1,
 		const Vector2f& p2, const Vector2f& p3, unsigned segments)
 	{
-		s_points.clear();
-		ShapePrimitive::bezier4(s_points, p0, p1, p2, p3, segments);
+		ArenaScope scope;
+		ArenaList<Vector2f> points;
+		ShapePrimitive::bezier4(points, p0, p1, p2, p3, segments);
 
-		return draw_poly_line(s_points, false);
+		return draw_poly_line(points.data(), static_cast<unsigned>(points.size()), false);
 	}
 
 	PrimitiveBatch& PrimitiveBatch::draw_spline(const Vector2f* points, unsigned count, unsigned segments)
 	{
-		s_points.clear();
-		ShapePrimitive::spline(s_points, points, count, segments);
+		ArenaScope scope;
+		ArenaList<Vector2f> curve;
+		ShapePrimitive::spline(curve, points, count, segments);
 
-		return draw_poly_line(s_points, false);
+		return draw_poly_line(curve.data(), static_cast<unsigned>(curve.size()), false);
 	}
 
 	PrimitiveBatch& PrimitiveBatch::draw_triangle(const Vector2f& p0, const Vector2f& p1, const Vector2f& p2)
@@ -440,7 +452,12 @@ namespace unicore
 
 	PrimitiveBatch& PrimitiveBatch::draw_convex_poly(const List<Vector2f>& points)
 	{
-		for (unsigned i = 0; i + 2 < points.size(); i += 1)
+		return draw_convex_poly(points.data(), static_cast<unsigned>(points.size()));
+	}
+
+	PrimitiveBatch& PrimitiveBatch::draw_convex_poly(const Vector2f* points, unsigned count)
+	{
+		for (unsigned i = 0; i + 2 < count; i += 1)
 			draw_triangle(points[0], points[i + 1], points[i + 2]);
 
 		return *this;
@@ -471,10 +488,10 @@ namespace unicore
 		}
 		else
 		{
-			static List<TextLine> lines;
-			static List<Vector2f> offsets;
+			ArenaScope scope;
+			ArenaList<TextLineView> lines;
+			ArenaList<Vector2f> offsets;
 
-			lines.clear();
 			TextBlock::parse_lines(text, lines);
 			TextBlock::calc_line_size(font, lines);
 
@@ -488,6 +505,14 @@ namespace unicore
 	}
 
 	// ============================================================================
+	PrimitiveBatch& PrimitiveBatch::draw_shape(const ArenaList<Vector2f>& points, bool filled)
+	{
+		const auto count = static_cast<unsigned>(points.size());
+		return !filled
+			? draw_poly_line(points.data(), count, true)
+			: draw_convex_poly(points.data(), count);
+	}
+
 	void PrimitiveBatch::set_type(BatchType type)
 	{
 		if (_current.type != type)
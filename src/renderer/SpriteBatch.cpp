@@ -2,6 +2,9 @@
 #include "unicore/renderer/Font.hpp"
 #include "unicore/renderer/Texture.hpp"
 #include "unicore/renderer/Sprite.hpp"
+#include "unicore/system/Profiler.hpp"
+#include "unicore/system/MemoryTracker.hpp"
+#include "unicore/system/FrameArena.hpp"
 
 namespace unicore
 {
@@ -9,6 +12,24 @@ namespace unicore
 	static List<QuadColor2f> s_quad_list;
 	static Dictionary<Shared<Texture>, List<QuadColorTexture2f>> s_quad_dict;
 
+	// Quad lists are kept between calls, print with same font does not allocate
+	static void begin_quad_dict()
+	{
+		for (auto& [tex, quad_list] : s_quad_dict)
+			quad_list.clear();
+	}
+
+	// Textures that are not used by last text are released
+	static void end_quad_dict()
+	{
+		for (auto it = s_quad_dict.begin(); it != s_quad_dict.end();)
+		{
+			if (it->second.empty())
+				it = s_quad_dict.erase(it);
+			else ++it;
+		}
+	}
+
 	static void convert(const VertexColor2f& from, VertexColorTexture2f& to)
 	{
 		to.pos = from.pos;
@@ -17,6 +38,8 @@ namespace unicore
 
 	void SpriteBatch::render(sdl2::PipelineRender& renderer) const
 	{
+		UC_PROFILE_SCOPE("SpriteBatch::render");
+
 		for (const auto& batch : _batches)
 		{
 			renderer.draw_trianglesf(&_vertices[batch.start],
@@ -26,6 +49,8 @@ namespace unicore
 
 	void SpriteBatch::render(ogl1::Geometry& renderer) const
 	{
+		UC_PROFILE_SCOPE("SpriteBatch::render");
+
 		renderer.begin(ogl1::RenderMode::Triangles);
 
 		for (const auto& batch : _batches)
@@ -48,12 +73,14 @@ namespace unicore
 
 	SpriteBatch& SpriteBatch::flush()
 	{
+		UC_MEMORY_SCOPE(MemoryCategory::Renderer);
+
 		if (_current.count > 0)
 		{
 			_batches.push_back(_current);
 
 			_current = {};
-			_current.start = static_cast<UInt16>(_vertices.size());
+			_current.start = static_cast<UInt32>(_vertices.size());
 		}
 
 		return *this;
@@ -64,6 +91,8 @@ namespace unicore
 		const VertexColorTexture2f& v0, const VertexColorTexture2f& v1, const VertexColorTexture2f& v2,
 		const Shared<Texture>& texture)
 	{
+		UC_MEMORY_SCOPE(MemoryCategory::Renderer);
+
 		set_texture(texture);
 
 		_vertices.push_back(v0);
@@ -77,6 +106,8 @@ namespace unicore
 	SpriteBatch& SpriteBatch::draw_tri(const VertexColorTexture2f* arr,
 		const Shared<Texture>& texture)
 	{
+		UC_MEMORY_SCOPE(MemoryCategory::Renderer);
+
 		set_texture(texture);
 
 		_vertices.push_back(arr[0]);
@@ -93,6 +124,8 @@ namespace unicore
 		const VertexColorTexture2f& v2, const VertexColorTexture2f& v3,
 		const Shared<Texture>& texture)
 	{
+		UC_MEMORY_SCOPE(MemoryCategory::Renderer);
+
 		set_texture(texture);
 
 		_vertices.push_back(v0);
@@ -110,6 +143,8 @@ namespace unicore
 	SpriteBatch& SpriteBatch::draw_quad(const VertexColorTexture2f* arr,
 		const Shared<Texture>& texture)
 	{
+		UC_MEMORY_SCOPE(MemoryCategory::Renderer);
+
 		set_texture(texture);
 
 		_vertices.push_back(arr[0]);
@@ -375,9 +410,11 @@ namespace unicore
 	SpriteBatch& SpriteBatch::print(const Shared<Font>& font,
 		const Vector2f& pos, StringView32 text, const Color4b& color)
 	{
+		UC_MEMORY_SCOPE(MemoryCategory::Text);
+
 		if (const auto textured = std::dynamic_pointer_cast<TexturedFont>(font))
 		{
-			s_quad_dict.clear();
+			begin_quad_dict();
 			textured->generate(pos, text, color, s_quad_dict);
 
 			for (const auto& [tex, quad_list] : s_quad_dict)
@@ -385,6 +422,8 @@ namespace unicore
 				for (const auto& quad : quad_list)
 					draw_quad(quad.v, tex);
 			}
+
+			end_quad_dict();
 		}
 
 		if (const auto geometry = std::dynamic_pointer_cast<GeometryFont>(font))
@@ -409,9 +448,11 @@ namespace unicore
 	SpriteBatch& SpriteBatch::print(const Shared<Font>& font,
 		const Transform2f& tr, StringView32 text, const Color4b& color)
 	{
+		UC_MEMORY_SCOPE(MemoryCategory::Text);
+
 		if (const auto textured = std::dynamic_pointer_cast<TexturedFont>(font))
 		{
-			s_quad_dict.clear();
+			begin_quad_dict();
 			textured->generate(VectorConst2f::Zero, text, color, s_quad_dict);
 
 			for (auto& [tex, quad_list] : s_quad_dict)
@@ -425,6 +466,8 @@ namespace unicore
 					draw_quad(quad.v, tex);
 				}
 			}
+
+			end_quad_dict();
 		}
 
 		if (const auto geometry = std::dynamic_pointer_cast<GeometryFont>(font))
@@ -454,7 +497,8 @@ namespace unicore
 	SpriteBatch& SpriteBatch::print(const TextBlock& block,
 		const Vector2f& pos, TextAlign align, const Color4b& color)
 	{
-		static List<Vector2f> offset;
+		ArenaScope scope;
+		ArenaList<Vector2f> offset;
 
 		TextBlock::calc_align_offset(block.lines(), align, offset);
 
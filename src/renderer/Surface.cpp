@@ -1,4 +1,6 @@
 #include "unicore/renderer/Surface.hpp"
+#include "unicore/renderer/PixelConvert.hpp"
+#include "unicore/resource/BinaryData.hpp"
 
 namespace unicore
 {
@@ -7,6 +9,14 @@ namespace unicore
 	{
 	}
 
+	Surface::Surface(const Vector2i& size, const Shared<BasicBinaryData>& data, Size offset)
+		: _size(size)
+		, _chunk(const_cast<Byte*>(data->data_as<Byte>()) + offset,
+			static_cast<Size>(size.area()) * 4, nullptr)
+		, _source(data)
+	{
+	}
+
 	bool Surface::get(int x, int y, Color4b& value) const
 	{
 		if (x >= 0 && x < _size.x && y >= 0 && y < _size.y)
@@ -14,7 +24,7 @@ namespace unicore
 			const auto offset = calc_offset(x, y);
 			const auto data = static_cast<const uint8_t*>(_chunk.data());
 			const auto ptr = reinterpret_cast<const uint32_t*>(&data[offset]);
-			value = Color4b::from_format(pixel_format_abgr, ptr[0]);
+			value = Color4b::from_format(format(), ptr[0]);
 			return true;
 		}
 
@@ -29,8 +39,7 @@ namespace unicore
 		const auto data = static_cast<const UInt32*>(_chunk.data());
 
 		const auto offset = y * _size.x + x;
-		for (unsigned i = 0; i < lng; i++)
-			dest[i] = Color4b::from_format(pixel_format_abgr, data[offset + i]);
+		PixelConvert::to_colors(format(), data + offset, dest, lng);
 		return lng;
 	}
 
@@ -41,21 +50,38 @@ namespace unicore
 		const auto lng = Math::min<unsigned>(lng_, _size.y - y);
 		const auto data = static_cast<const UInt32*>(_chunk.data());
 
+		const auto surface_format = format();
 		const auto offset = y * _size.x + x;
 		for (unsigned i = 0; i < lng; i++)
-			dest[i] = Color4b::from_format(pixel_format_abgr, data[offset + _size.x * i]);
+			dest[i] = Color4b::from_format(surface_format, data[offset + _size.x * i]);
 		return lng;
 	}
 
+	static bool dirty_contains(const Recti& a, const Recti& b)
+	{
+		return
+			b.min_x() >= a.min_x() && b.max_x() <= a.max_x() &&
+			b.min_y() >= a.min_y() && b.max_y() <= a.max_y();
+	}
+
+	static Recti dirty_union(const Recti& a, const Recti& b)
+	{
+		return Recti::from_min_max(
+			{ Math::min(a.min_x(), b.min_x()), Math::min(a.min_y(), b.min_y()) },
+			{ Math::max(a.max_x(), b.max_x()), Math::max(a.max_y(), b.max_y()) });
+	}
+
 	// DynamicSurface /////////////////////////////////////////////////////////////
 	DynamicSurface::DynamicSurface(int width, int height)
 		: Surface({ width, height }, MemoryChunk(width* height * 4))
 	{
+		mark_dirty();
 	}
 
 	DynamicSurface::DynamicSurface(const Vector2i& size)
 		: Surface(size, MemoryChunk(size.area() * 4))
 	{
+		mark_dirty();
 	}
 
 	bool DynamicSurface::set(int x, int y, Color4b value)
@@ -65,7 +91,8 @@ namespace unicore
 			const auto offset = calc_offset(x, y);
 			const auto data = static_cast<uint8_t*>(_chunk.data());
 			const auto ptr = reinterpret_cast<uint32_t*>(&data[offset]);
-			ptr[0] = value.to_format(pixel_format_abgr);
+			ptr[0] = value.to_format(format());
+			mark_dirty({ x, y, 1, 1 });
 			return true;
 		}
 
@@ -79,10 +106,9 @@ namespace unicore
 		const auto lng = Math::min<unsigned>(lng_, _size.x - x);
 		const auto data = static_cast<UInt32*>(_chunk.data());
 
-		const auto color = value.to_format(pixel_format_abgr);
 		const auto offset = y * _size.x + x;
-		for (unsigned i = 0; i < lng; i++)
-			data[offset + i] = color;
+		PixelConvert::fill(data + offset, value.to_format(format()), lng);
+		mark_dirty({ x, y, static_cast<int>(lng), 1 });
 		return lng;
 	}
 
@@ -93,10 +119,11 @@ namespace unicore
 		const auto lng = Math::min<unsigned>(lng_, _size.y - y);
 		const auto data = static_cast<UInt32*>(_chunk.data());
 
-		const auto color = value.to_format(pixel_format_abgr);
+		const auto color = value.to_format(format());
 		const auto offset = y * _size.x + x;
 		for (unsigned i = 0; i < lng; i++)
 			data[offset + _size.x * i] = color;
+		mark_dirty({ x, y, 1, static_cast<int>(lng) });
 		return lng;
 	}
 
@@ -108,8 +135,8 @@ namespace unicore
 		const auto data = static_cast<UInt32*>(_chunk.data());
 
 		const auto offset = y * _size.x + x;
-		for (unsigned i = 0; i < lng; i++)
-			data[offset + i] = src[i].to_format(pixel_format_abgr);
+		PixelConvert::from_colors(format(), src, data + offset, lng);
+		mark_dirty({ x, y, static_cast<int>(lng), 1 });
 		return lng;
 	}
 
@@ -120,9 +147,85 @@ namespace unicore
 		const auto lng = Math::min<unsigned>(lng_, _size.y - y);
 		const auto data = static_cast<UInt32*>(_chunk.data());
 
+		const auto surface_format = format();
 		const auto offset = y * _size.x + x;
 		for (unsigned i = 0; i < lng; i++)
-			data[offset + _size.x * i] = src[i].to_format(pixel_format_abgr);
+			data[offset + _size.x * i] = src[i].to_format(surface_format);
+		mark_dirty({ x, y, 1, static_cast<int>(lng) });
 		return lng;
 	}
+
+	void DynamicSurface::blit(const Surface& src, const Vector2i& pos)
+	{
+		blit(src, { VectorConst2i::Zero, src.size() }, pos);
+	}
+
+	void DynamicSurface::blit(const Surface& src, const Recti& src_rect, const Vector2i& pos)
+	{
+		UC_ASSERT(&src != this);
+
+		const auto area = src.get_clip_rect(src_rect);
+		Recti rect{ pos + (area.pos - src_rect.pos), area.size };
+		Surface::clip_rect(rect);
+		if (rect.size.x <= 0 || rect.size.y <= 0)
+			return;
+
+		const auto offset = rect.pos - pos + src_rect.pos;
+		const auto src_data = static_cast<const UInt32*>(src.data());
+		const auto dest_data = static_cast<UInt32*>(_chunk.data());
+
+		for (int y = 0; y < rect.size.y; y++)
+		{
+			PixelConvert::convert(
+				format(), dest_data + (rect.pos.y + y) * _size.x + rect.pos.x,
+				src.format(), src_data + (offset.y + y) * src.size().x + offset.x,
+				rect.size.x);
+		}
+
+		mark_dirty(rect);
+	}
+
+	void DynamicSurface::mark_dirty()
+	{
+		_dirty_rects.clear();
+		_dirty_rects.push_back(Surface::rect());
+	}
+
+	void DynamicSurface::mark_dirty(const Recti& rect)
+	{
+		auto r = Surface::get_clip_rect(rect);
+		if (r.size.x <= 0 || r.size.y <= 0)
+			return;
+
+		for (const auto& dirty : _dirty_rects)
+		{
+			if (dirty_contains(dirty, r))
+				return;
+		}
+
+		// Merge while the union does not add more area than the overlap
+		for (auto it = _dirty_rects.begin(); it != _dirty_rects.end();)
+		{
+			const auto merged = dirty_union(*it, r);
+			if (merged.size.area() <= it->size.area() + r.size.area())
+			{
+				r = merged;
+				_dirty_rects.erase(it);
+				it = _dirty_rects.begin();
+			}
+			else ++it;
+		}
+
+		_dirty_rects.push_back(r);
+
+		if (_dirty_rects.size() > MaxDirtyRects)
+		{
+			auto bounds = _dirty_rects.front();
+			for (const auto& dirty : _dirty_rects)
+				bounds = dirty_union(bounds, dirty);
+
+			_dirty_rects.clear();
+			_dirty_rects.push_back(bounds);
+		}
+	}
 }
\ No newline at end of file
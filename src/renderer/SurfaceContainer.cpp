@@ -0,0 +1,284 @@
+#include "unicore/renderer/SurfaceContainer.hpp"
+#include "unicore/io/File.hpp"
+#include "unicore/io/Logger.hpp"
+#include "unicore/resource/BinaryData.hpp"
+#include "unicore/renderer/PixelConvert.hpp"
+#include "unicore/system/Lz4.hpp"
+
+namespace unicore::SurfaceContainer
+{
+	static bool error(Logger* logger, StringView message)
+	{
+		if (logger)
+			UC_LOG_ERROR(logger) << message;
+		return false;
+	}
+
+	static constexpr UInt64 align_offset(UInt64 offset)
+	{
+		return (offset + alignment - 1) / alignment * alignment;
+	}
+
+	static SurfaceFormat get_format(const Header& header)
+	{
+		return { header.format[0], header.format[1], header.format[2], header.format[3] };
+	}
+
+	static bool is_valid_format(const SurfaceFormat& format)
+	{
+		// Every component is a distinct whole byte
+		unsigned mask = 0;
+		for (const auto shift : { format.r_shift, format.g_shift, format.b_shift, format.a_shift })
+		{
+			if (shift % 8 != 0 || shift > 24)
+				return false;
+			mask |= 1u << (shift / 8);
+		}
+		return mask == 0xF;
+	}
+
+	static const Level* get_levels(const Header& header)
+	{
+		return reinterpret_cast<const Level*>(&header + 1);
+	}
+
+	// Box filter, odd last row/column is folded into previous one
+	static List<Color4b> make_level(const List<Color4b>& src,
+		const Vector2i& src_size, const Vector2i& size)
+	{
+		List<Color4b> dest(size.area());
+
+		for (int y = 0; y < size.y; y++)
+		{
+			const auto y0 = Math::min(y * 2, src_size.y - 1);
+			const auto y1 = Math::min(y * 2 + 1, src_size.y - 1);
+
+			for (int x = 0; x < size.x; x++)
+			{
+				const auto x0 = Math::min(x * 2, src_size.x - 1);
+				const auto x1 = Math::min(x * 2 + 1, src_size.x - 1);
+
+				const Color4b* samples[4] = {
+					&src[y0 * src_size.x + x0], &src[y0 * src_size.x + x1],
+					&src[y1 * src_size.x + x0], &src[y1 * src_size.x + x1],
+				};
+
+				unsigned r = 2, g = 2, b = 2, a = 2;
+				for (const auto c : samples)
+				{
+					r += c->r;
+					g += c->g;
+					b += c->b;
+					a += c->a;
+				}
+
+				dest[y * size.x + x] = Color4b(r / 4, g / 4, b / 4, a / 4);
+			}
+		}
+
+		return dest;
+	}
+
+	bool write(WriteFile& file, const Surface& surface,
+		const WriteOptions& options, Logger* logger)
+	{
+		const auto& size = surface.size();
+		if (size.x <= 0 || size.y <= 0)
+			return error(logger, "Empty surface");
+
+		if (!is_valid_format(options.format))
+			return error(logger, "Invalid format");
+
+		// Levels are built from Color4b, then stored in options.format
+		List<List<Color4b>> pixels;
+		List<Vector2i> sizes;
+
+		pixels.emplace_back(size.area());
+		PixelConvert::to_colors(surface.format(),
+			static_cast<const UInt32*>(surface.data()), pixels.back().data(), pixels.back().size());
+		sizes.push_back(size);
+
+		while (options.mipmaps && sizes.size() < max_levels && sizes.back() != Vector2i(1))
+		{
+			const auto& prev = sizes.back();
+			const Vector2i next(Math::max(prev.x / 2, 1), Math::max(prev.y / 2, 1));
+			pixels.push_back(make_level(pixels.back(), prev, next));
+			sizes.push_back(next);
+		}
+
+		const auto level_count = static_cast<UInt8>(sizes.size());
+
+		Header header{};
+		header.magic = magic;
+		header.version = version;
+		header.compression = options.compression;
+		header.level_count = level_count;
+		header.format[0] = options.format.r_shift;
+		header.format[1] = options.format.g_shift;
+		header.format[2] = options.format.b_shift;
+		header.format[3] = options.format.a_shift;
+		header.width = static_cast<UInt32>(size.x);
+		header.height = static_cast<UInt32>(size.y);
+
+		List<Level> levels(level_count);
+		List<MemoryChunk> data;
+
+		auto offset = align_offset(sizeof(Header) + sizeof(Level) * level_count);
+		for (UInt8 i = 0; i < level_count; i++)
+		{
+			const auto count = pixels[i].size();
+			MemoryChunk raw(count * sizeof(UInt32));
+			PixelConvert::from_colors(options.format,
+				pixels[i].data(), static_cast<UInt32*>(raw.data()), count);
+
+			if (options.compression == Compression::Lz4)
+			{
+				MemoryChunk compressed(Lz4::compress_bound(raw.size()));
+				const auto compressed_size = Lz4::compress(
+					raw.data(), raw.size(), compressed.data(), compressed.size());
+				if (compressed_size == 0)
+					return error(logger, "Compression failed");
+
+				MemoryChunk packed(compressed_size);
+				Memory::copy(packed.data(), compressed.data(), compressed_size);
+				raw = std::move(packed);
+			}
+
+			levels[i].width = static_cast<UInt32>(sizes[i].x);
+			levels[i].height = static_cast<UInt32>(sizes[i].y);
+			levels[i].offset = offset;
+			levels[i].size = raw.size();
+
+			offset = align_offset(offset + raw.size());
+			data.push_back(std::move(raw));
+		}
+
+		static constexpr Byte padding[alignment] = {};
+		UInt64 position = sizeof(Header) + sizeof(Level) * level_count;
+
+		if (!file.write(&header, sizeof(Header)) ||
+			!file.write(levels.data(), sizeof(Level) * level_count))
+			return error(logger, "Write failed");
+
+		for (UInt8 i = 0; i < level_count; i++)
+		{
+			if (!file.write(padding, levels[i].offset - position) || !file.write(data[i]))
+				return error(logger, "Write failed");
+			position = levels[i].offset + levels[i].size;
+		}
+
+		return true;
+	}
+
+	const Header* read_header(const BasicBinaryData& data, Logger* logger)
+	{
+		if (data.size() < sizeof(Header))
+		{
+			error(logger, "Invalid size");
+			return nullptr;
+		}
+
+		const auto header = data.data_as<Header>();
+		if (header->magic != magic || header->version != version)
+		{
+			error(logger, "Invalid signature or version");
+			return nullptr;
+		}
+
+		if (header->compression != Compression::None &&
+			header->compression != Compression::Lz4)
+		{
+			error(logger, "Unknown compression");
+			return nullptr;
+		}
+
+		if (header->level_count == 0 || header->level_count > max_levels ||
+			data.size() < sizeof(Header) + sizeof(Level) * header->level_count)
+		{
+			error(logger, "Invalid level count");
+			return nullptr;
+		}
+
+		if (!is_valid_format(get_format(*header)))
+		{
+			error(logger, "Invalid format");
+			return nullptr;
+		}
+
+		const auto levels = get_levels(*header);
+		for (UInt8 i = 0; i < header->level_count; i++)
+		{
+			const auto& level = levels[i];
+			const auto raw_size = static_cast<UInt64>(level.width) * level.height * 4;
+
+			if (level.width == 0 || level.height == 0 ||
+				level.width > static_cast<UInt32>(std::numeric_limits<int>::max()) ||
+				level.height > static_cast<UInt32>(std::numeric_limits<int>::max()) ||
+				level.offset % alignment != 0 ||
+				level.offset > data.size() || level.size > data.size() - level.offset ||
+				(header->compression == Compression::None && level.size != raw_size))
+			{
+				error(logger, "Invalid level");
+				return nullptr;
+			}
+		}
+
+		if (levels[0].width != header->width || levels[0].height != header->height)
+		{
+			error(logger, "Invalid level");
+			return nullptr;
+		}
+
+		return header;
+	}
+
+	Shared<Surface> load(const Shared<BasicBinaryData>& data, unsigned level, Logger* logger)
+	{
+		const auto header = read_header(*data, logger);
+		if (!header)
+			return nullptr;
+
+		if (level >= header->level_count)
+		{
+			error(logger, "Invalid level index");
+			return nullptr;
+		}
+
+		const auto& info = get_levels(*header)[level];
+		const Vector2i size(static_cast<int>(info.width), static_cast<int>(info.height));
+		const auto format = get_format(*header);
+		const auto stored = data->data_as<Byte>() + info.offset;
+		const auto count = static_cast<Size>(info.width) * info.height;
+
+		// BaseSurface::format() is the layout of every Surface
+		constexpr SurfaceFormat surface_format = pixel_format_abgr;
+
+		if (header->compression == Compression::None)
+		{
+			if (format == surface_format)
+				return std::make_shared<Surface>(size, data, static_cast<Size>(info.offset));
+
+			MemoryChunk chunk(count * sizeof(UInt32));
+			PixelConvert::convert(surface_format, static_cast<UInt32*>(chunk.data()),
+				format, reinterpret_cast<const UInt32*>(stored), count);
+			return std::make_shared<Surface>(size, std::move(chunk));
+		}
+
+		MemoryChunk chunk(count * sizeof(UInt32));
+		if (!Lz4::decompress(stored, static_cast<Size>(info.size), chunk.data(), chunk.size()))
+		{
+			error(logger, "Decompression failed");
+			return nullptr;
+		}
+
+		if (format != surface_format)
+		{
+			MemoryChunk converted(chunk.size());
+			PixelConvert::convert(surface_format, static_cast<UInt32*>(converted.data()),
+				format, static_cast<const UInt32*>(chunk.data()), count);
+			chunk = std::move(converted);
+		}
+
+		return std::make_shared<Surface>(size, std::move(chunk));
+	}
+}
\ No newline at end of file
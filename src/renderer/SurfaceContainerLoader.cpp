@@ -0,0 +1,31 @@
+#include "unicore/renderer/SurfaceContainerLoader.hpp"
+#include "unicore/io/File.hpp"
+#include "unicore/resource/BinaryData.hpp"
+#include "unicore/resource/ResourceCache.hpp"
+
+namespace unicore
+{
+	// SurfaceContainerLoader /////////////////////////////////////////////////////
+	Shared<Resource> SurfaceContainerLoader::load(const Context& context)
+	{
+		const auto file = context.cache.load<ReadFile>(context.path);
+		if (!file) return nullptr;
+
+		const auto data = file->map();
+		if (!data) return nullptr;
+
+		return SurfaceContainer::load(data, 0, context.logger);
+	}
+
+	// DynamicSurfaceContainerLoader //////////////////////////////////////////////
+	Shared<Resource> DynamicSurfaceContainerLoader::load(const Context& context)
+	{
+		const auto surface = context.cache.load<Surface>(context.path);
+		if (!surface)
+			return nullptr;
+
+		auto dynamic_surface = std::make_shared<DynamicSurface>(surface->size());
+		Memory::copy(dynamic_surface->data(), surface->data(), surface->size_bytes());
+		return dynamic_surface;
+	}
+}
\ No newline at end of file
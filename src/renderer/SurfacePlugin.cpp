@@ -2,6 +2,7 @@
 #include "unicore/resource/ResourceCache.hpp"
 #include "unicore/renderer/SolidSizeLoader.hpp"
 #include "unicore/renderer/SpriteListTileSetLoader.hpp"
+#include "unicore/renderer/SurfaceContainerLoader.hpp"
 
 namespace unicore
 {
@@ -14,6 +15,8 @@ namespace unicore
 			cache->add_loader(std::make_shared<SurfaceSizeSurfaceLoader>());
 			cache->add_loader(std::make_shared<DynamicSurfaceSolidSizeLoader>());
 			cache->add_loader(std::make_shared<SpriteListTileSetLoader>());
+			cache->add_loader(std::make_shared<SurfaceContainerLoader>());
+			cache->add_loader(std::make_shared<DynamicSurfaceContainerLoader>());
 		}
 	}
 }
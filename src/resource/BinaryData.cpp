@@ -43,4 +43,14 @@ namespace unicore
 	{
 		return sizeof(DynamicBinaryData) + _data.size();
 	}
+
+	// BinaryDataView /////////////////////////////////////////////////////////////
+	BinaryDataView::BinaryDataView(const void* data, size_t size, const Shared<void>& owner)
+		: _data(data), _size(size), _owner(owner)
+	{}
+
+	size_t BinaryDataView::get_system_memory_use() const
+	{
+		return sizeof(BinaryDataView);
+	}
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "unicore/resource/ResourceCache.hpp"
 #include "unicore/system/Memory.hpp"
+#include "unicore/system/Profiler.hpp"
+#include "unicore/system/MemoryTracker.hpp"
 #include "unicore/io/Logger.hpp"
 #include "unicore/io/FileProvider.hpp"
 #include "unicore/resource/RendererResource.hpp"
@@ -9,8 +11,8 @@ namespace unicore
 {
 	struct FromPath
 	{
-		explicit FromPath(const Path& path_) : path(path_) {}
-		const Path& path;
+		explicit FromPath(PathView path_) : path(path_) {}
+		PathView path;
 	};
 
 	struct WithOptions
@@ -41,6 +43,7 @@ namespace unicore
 	void ResourceCache::unload_all()
 	{
 		_cached.clear();
+		_paths.clear();
 		_resources.clear();
 	}
 
@@ -55,6 +58,7 @@ namespace unicore
 				{
 					UC_LOG_DEBUG(_logger) << "Unload resource "
 						<< info.resource->type() << " from " << info.path;
+					_paths.erase(info.resource.get());
 					jt = cached.erase(jt);
 				}
 				else ++jt;
@@ -71,22 +75,18 @@ namespace unicore
 
 	Optional<Path> ResourceCache::find_path(const Resource& resource) const
 	{
-		for (const auto& it : _cached)
-		{
-			for (const auto& jt : it.second)
-			{
-				auto& info = jt.second;
-				if (info.resource.get() == &resource)
-					return info.path;
-			}
-		}
+		if (const auto it = _paths.find(&resource); it != _paths.end())
+			return it->second;
 
 		return std::nullopt;
 	}
 
-	Shared<Resource> ResourceCache::load_raw(const Path& path,
+	Shared<Resource> ResourceCache::load_raw(PathView path,
 		TypeConstRef type, const ResourceOptions* options, ResourceCacheFlags flags)
 	{
+		UC_PROFILE_SCOPE("ResourceCache::load_raw");
+		UC_MEMORY_SCOPE(MemoryCategory::Resource);
+
 		const auto logger = !flags.has(ResourceCacheFlag::Quiet) ? &_logger : nullptr;
 
 		const auto loaders_it = _loaders.find(&type);
@@ -98,7 +98,8 @@ namespace unicore
 
 		// TODO: Implement loading stack for prevent recursive loading
 		const auto& loaders = loaders_it->second;
-		const auto extension = path.extension();
+		// PathView hash is precomputed, hash can collide,
+		// so cached entry is verified by path
 		const size_t hash = make_hash(path, options);
 
 		for (const auto& loader : loaders)
@@ -111,10 +112,11 @@ namespace unicore
 
 			if (const auto it = _cached.find(loader.get()); it != _cached.end())
 			{
-				for (const auto& [h, info] : it->second)
+				if (const auto jt = it->second.find(hash); jt != it->second.end())
 				{
-					auto res_type = info.resource->type();
-					if (hash == h && res_type.is_derived_from(type))
+					const auto& info = jt->second;
+					const auto& res_type = info.resource->type();
+					if (PathView(info.path) == path && res_type.is_derived_from(type))
 					{
 						UC_LOG_DEBUG(_logger) << "Get from cache " << res_type
 							<< FromPath(path) << WithOptions(options);
@@ -133,8 +135,9 @@ namespace unicore
 				_resources.push_back(resource);
 				if (resource->cache_policy() == ResourceCachePolicy::CanCache)
 				{
-					CachedInfo info{ resource, path, loader.get() };
-					_cached[loader.get()].emplace(hash, info);
+					CachedInfo info{ resource, Path(path), loader.get() };
+					if (_cached[loader.get()].emplace(hash, info).second)
+						_paths[resource.get()] = info.path;
 
 					UC_LOG_DEBUG(_logger) << "Added " << resource->type()
 						<< FromPath(path) << WithOptions(options);
@@ -232,7 +235,7 @@ namespace unicore
 		return lhs->priority() < rhs->priority();
 	}
 
-	size_t ResourceCache::make_hash(const Path& path, const ResourceOptions* options)
+	size_t ResourceCache::make_hash(PathView path, const ResourceOptions* options)
 	{
 		return options
 			? Hash::make(path, options->hash())
@@ -0,0 +1,214 @@
+#include "unicore/system/Atom.hpp"
+#include "unicore/system/StringBuilder.hpp"
+#include "unicore/system/Memory.hpp"
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
+namespace unicore
+{
+	namespace
+	{
+		struct AtomEntry
+		{
+			StringView str;
+			HashString hash;
+			// Next atom with the same hash
+			UInt32 next = 0;
+		};
+
+		// Entries are allocated in fixed blocks and never move,
+		// so string of atom is read without lock
+		class AtomTable
+		{
+		public:
+			static constexpr UInt32 BlockSize = 1024;
+			static constexpr UInt32 MaxBlocks = 4096;
+			static constexpr Size ChunkSize = 16 * 1024;
+
+			AtomTable()
+			{
+				add({}, HashString::calc({}));
+			}
+
+			UC_NODISCARD const AtomEntry& get(UInt32 id) const
+			{
+				const auto block = _blocks[id / BlockSize].load(std::memory_order_acquire);
+				return block[id % BlockSize];
+			}
+
+			UC_NODISCARD Size count() const
+			{
+				std::shared_lock lock(_mutex);
+				return _count;
+			}
+
+			Bool find(StringView str, UInt32& id) const
+			{
+				const auto hash = HashString::calc(str);
+
+				std::shared_lock lock(_mutex);
+				return find(str, hash, id);
+			}
+
+			UInt32 intern(StringView str)
+			{
+				const auto hash = HashString::calc(str);
+
+				UInt32 id;
+				{
+					std::shared_lock lock(_mutex);
+					if (find(str, hash, id))
+						return id;
+				}
+
+				std::unique_lock lock(_mutex);
+				// Can be added by other thread between locks
+				if (find(str, hash, id))
+					return id;
+
+				return add(str, hash);
+			}
+
+		protected:
+			mutable std::shared_mutex _mutex;
+			std::atomic<AtomEntry*> _blocks[MaxBlocks] = {};
+			UInt32 _count = 0;
+
+			// First atom for each hash, collisions are chained with AtomEntry::next
+			HashDictionary<HashString, UInt32> _lookup;
+
+			List<Unique<Char[]>> _chunks;
+			List<Unique<Char[]>> _large_chunks;
+			Size _chunk_used = ChunkSize;
+
+			Bool find(StringView str, HashString hash, UInt32& id) const
+			{
+				const auto it = _lookup.find(hash);
+				if (it == _lookup.end())
+					return false;
+
+				for (auto index = it->second; ; index = get(index).next)
+				{
+					if (get(index).str == str)
+					{
+						id = index;
+						return true;
+					}
+
+					// Empty string is the first atom, it never ends up in chain
+					if (get(index).next == 0)
+						return false;
+				}
+			}
+
+			UInt32 add(StringView str, HashString hash)
+			{
+				const auto id = _count;
+				const auto block_index = id / BlockSize;
+				if (block_index >= MaxBlocks)
+				{
+					UC_ASSERT_ALWAYS_MSG("Atom table is full");
+					return 0;
+				}
+
+				auto block = _blocks[block_index].load(std::memory_order_relaxed);
+				if (block == nullptr)
+				{
+					block = new AtomEntry[BlockSize];
+					_blocks[block_index].store(block, std::memory_order_release);
+				}
+
+				auto& entry = block[id % BlockSize];
+				entry.str = store(str);
+				entry.hash = hash;
+
+				if (const auto [it, inserted] = _lookup.try_emplace(hash, id); !inserted)
+				{
+					// Append to collision chain
+					auto index = it->second;
+					while (get(index).next != 0)
+						index = get(index).next;
+					block_entry(index).next = id;
+				}
+
+				_count++;
+				return id;
+			}
+
+			AtomEntry& block_entry(UInt32 id)
+			{
+				return _blocks[id / BlockSize].load(std::memory_order_relaxed)[id % BlockSize];
+			}
+
+			StringView store(StringView str)
+			{
+				if (str.empty())
+					return {};
+
+				if (str.size() > ChunkSize / 4)
+				{
+					_large_chunks.push_back(std::make_unique<Char[]>(str.size()));
+					Memory::copy(_large_chunks.back().get(), str.data(), str.size());
+					return { _large_chunks.back().get(), str.size() };
+				}
+
+				if (_chunk_used + str.size() > ChunkSize)
+				{
+					_chunks.push_back(std::make_unique<Char[]>(ChunkSize));
+					_chunk_used = 0;
+				}
+
+				const auto data = _chunks.back().get() + _chunk_used;
+				Memory::copy(data, str.data(), str.size());
+				_chunk_used += str.size();
+				return { data, str.size() };
+			}
+		};
+
+		AtomTable& get_table()
+		{
+			// Never destroyed, atoms can be used by other static objects
+			static const auto table = new AtomTable();
+			return *table;
+		}
+	}
+
+	const Atom Atom::Empty;
+
+	Atom::Atom(StringView str)
+		: _id(!str.empty() ? get_table().intern(str) : 0)
+	{
+	}
+
+	StringView Atom::str() const
+	{
+		return _id != 0 ? get_table().get(_id).str : StringView();
+	}
+
+	HashString Atom::hash() const
+	{
+		return get_table().get(_id).hash;
+	}
+
+	Optional<Atom> Atom::find(StringView str)
+	{
+		if (str.empty())
+			return Empty;
+
+		if (UInt32 id; get_table().find(str, id))
+			return Atom(id);
+
+		return std::nullopt;
+	}
+
+	Size Atom::count()
+	{
+		return get_table().count();
+	}
+
+	UNICODE_STRING_BUILDER_FORMAT(const Atom&)
+	{
+		return builder << value.str();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include "unicore/system/FixedStepScheduler.hpp"
+#include "unicore/math/Math.hpp"
+
+namespace unicore
+{
+	FixedStepScheduler::FixedStepScheduler(const TimeSpan& step, unsigned max_steps)
+		: _step(step > TimeSpanConst::Zero ? step : DefaultStep)
+		, _max_steps(Math::max(1u, max_steps))
+	{
+	}
+
+	void FixedStepScheduler::set_step(const TimeSpan& step)
+	{
+		if (step > TimeSpanConst::Zero)
+			_step = step;
+	}
+
+	void FixedStepScheduler::set_max_steps(unsigned count)
+	{
+		_max_steps = Math::max(1u, count);
+	}
+
+	Float FixedStepScheduler::alpha() const
+	{
+		return static_cast<Float>(
+			static_cast<Double>(_accumulator.data().count()) /
+			static_cast<Double>(_step.data().count()));
+	}
+
+	unsigned FixedStepScheduler::update()
+	{
+		const auto now = Timer::now();
+		const auto elapsed = _last_time.has_value() ? now - _last_time.value() : TimeSpanConst::Zero;
+		_last_time = now;
+
+		return advance(elapsed);
+	}
+
+	unsigned FixedStepScheduler::advance(const TimeSpan& elapsed)
+	{
+		if (elapsed > TimeSpanConst::Zero)
+			_accumulator += elapsed;
+
+		// Integer nanoseconds, same input always gives same steps
+		const auto count = static_cast<UInt64>(_accumulator.data() / _step.data());
+		_accumulator = TimeSpan(_accumulator.data() % _step.data());
+
+		const auto steps = static_cast<unsigned>(Math::min<UInt64>(count, _max_steps));
+		if (count > steps)
+			_dropped += TimeSpan(_step.data() * static_cast<Int64>(count - steps));
+
+		_tick += steps;
+		return steps;
+	}
+
+	void FixedStepScheduler::reset()
+	{
+		_accumulator = TimeSpanConst::Zero;
+		_dropped = TimeSpanConst::Zero;
+		_tick = 0;
+		_last_time = std::nullopt;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include "unicore/system/FrameArena.hpp"
+#include "unicore/system/Memory.hpp"
+#include "unicore/math/Math.hpp"
+
+namespace unicore
+{
+	FrameArena::FrameArena(Size block_size)
+		: _block_size(block_size)
+	{
+	}
+
+	FrameArena::~FrameArena()
+	{
+		for (const auto& block : _blocks)
+			Memory::free(block.data);
+	}
+
+	void* FrameArena::allocate(Size size, Size align)
+	{
+		while (true)
+		{
+			if (_block < _blocks.size())
+			{
+				const auto& block = _blocks[_block];
+				const auto base = reinterpret_cast<uintptr_t>(block.data);
+				const auto start = ((base + _offset + align - 1) & ~(align - 1)) - base;
+				if (start + size <= block.size)
+				{
+					_offset = start + size;
+					return block.data + start;
+				}
+
+				// Left after rewind or reset
+				if (_block + 1 < _blocks.size())
+				{
+					_block++;
+					_offset = 0;
+					continue;
+				}
+			}
+
+			const auto block_size = Math::max(_block_size, size + align);
+			const auto data = static_cast<Byte*>(UC_ALLOC(block_size));
+			_blocks.push_back({ data, block_size });
+			_block = _blocks.size() - 1;
+			_offset = 0;
+		}
+	}
+
+	void FrameArena::deallocate(void* ptr, Size size)
+	{
+		if (_block >= _blocks.size())
+			return;
+
+		const auto data = _blocks[_block].data;
+		const auto bytes = static_cast<Byte*>(ptr);
+		if (bytes >= data && bytes + size == data + _offset)
+		{
+			update_peak();
+			_offset = static_cast<Size>(bytes - data);
+		}
+	}
+
+	void FrameArena::rewind(const Marker& marker)
+	{
+		update_peak();
+
+		_block = marker.block;
+		_offset = marker.offset;
+	}
+
+	void FrameArena::reset()
+	{
+		update_peak();
+
+		// One block of whole capacity, next frame fits without growing
+		if (_blocks.size() > 1)
+		{
+			const auto size = capacity();
+			for (const auto& block : _blocks)
+				Memory::free(block.data);
+			_blocks.clear();
+
+			_blocks.push_back({ static_cast<Byte*>(UC_ALLOC(size)), size });
+		}
+
+		_block = 0;
+		_offset = 0;
+	}
+
+	Size FrameArena::used() const
+	{
+		if (_blocks.empty())
+			return 0;
+
+		Size size = _offset;
+		for (Size i = 0; i < _block; i++)
+			size += _blocks[i].size;
+		return size;
+	}
+
+	Size FrameArena::capacity() const
+	{
+		Size size = 0;
+		for (const auto& block : _blocks)
+			size += block.size;
+		return size;
+	}
+
+	Size FrameArena::peak() const
+	{
+		return Math::max(_peak, used());
+	}
+
+	FrameArena& FrameArena::current()
+	{
+		thread_local FrameArena arena;
+		return arena;
+	}
+
+	void FrameArena::update_peak()
+	{
+		_peak = Math::max(_peak, used());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,387 @@
+#include "unicore/system/JobSystem.hpp"
+#include "unicore/system/ThreadPool.hpp"
+#include "unicore/system/Profiler.hpp"
+#include "unicore/io/Logger.hpp"
+#include "unicore/math/Math.hpp"
+#include <deque>
+
+namespace unicore
+{
+	struct JobSystem::Job
+	{
+		// Guards generation change on finish and dependents
+		std::mutex mutex;
+		std::atomic<UInt32> generation{ 1 };
+		// Unfinished dependencies + 1 until job is submitted
+		std::atomic<UInt32> dependencies{ 0 };
+		List<UInt32> dependents;
+		Action<> func;
+		Bool main_thread = false;
+		UInt32 next_free = NoJob;
+	};
+
+	struct JobSystem::Worker
+	{
+		std::mutex mutex;
+		// Owner takes jobs from back, other threads steal from front
+		std::deque<UInt32> jobs;
+		std::thread thread;
+	};
+
+	static thread_local const JobSystem* s_current_system = nullptr;
+	static thread_local UInt32 s_current_worker = 0;
+
+	JobSystem::JobSystem(unsigned thread_count)
+		: _main_thread(std::this_thread::get_id())
+	{
+		if (thread_count == 0)
+			thread_count = ThreadPool::hardware_concurrency();
+
+		for (unsigned i = 1; i < thread_count; i++)
+			_workers.push_back(make_unique<Worker>());
+
+		for (UInt32 i = 0; i < _workers.size(); i++)
+			_workers[i]->thread = std::thread([this, i] { worker_loop(i); });
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard lock(_sleep_mutex);
+			_stop = true;
+		}
+		_sleep_cv.notify_all();
+
+		for (const auto& worker : _workers)
+			worker->thread.join();
+
+		for (auto& block : _blocks)
+			delete[] block.load(std::memory_order_relaxed);
+	}
+
+	void JobSystem::register_module(const ModuleContext& context)
+	{
+		Module::register_module(context);
+
+		_logger = context.logger;
+		UC_LOG_DEBUG(_logger) << "Started with " << worker_count() << " workers";
+	}
+
+	void JobSystem::unregister_module(const ModuleContext& context)
+	{
+		Module::unregister_module(context);
+
+		_logger = nullptr;
+	}
+
+	JobHandle JobSystem::schedule(Action<> func, std::initializer_list<JobHandle> dependencies)
+	{
+		const auto index = create_job(std::move(func), false);
+		for (const auto& dependency : dependencies)
+			add_dependency(index, dependency);
+		return submit(index);
+	}
+
+	JobHandle JobSystem::schedule_main(Action<> func, std::initializer_list<JobHandle> dependencies)
+	{
+		const auto index = create_job(std::move(func), true);
+		for (const auto& dependency : dependencies)
+			add_dependency(index, dependency);
+		return submit(index);
+	}
+
+	JobHandle JobSystem::schedule_for(UInt32 count, UInt32 batch_size,
+		RangeAction func, std::initializer_list<JobHandle> dependencies)
+	{
+		// Batches share one copy of func, completion job owns it
+		const auto shared = std::make_shared<RangeAction>(std::move(func));
+		const auto range_func = shared.get();
+
+		const auto done = create_job([shared] {}, false);
+
+		if (batch_size == 0)
+			batch_size = Math::max(1u, count / ((worker_count() + 1) * 4));
+
+		for (UInt32 begin = 0; begin < count; begin += batch_size)
+		{
+			const auto end = begin + Math::min(batch_size, count - begin);
+			const auto index = create_job([range_func, begin, end] { (*range_func)(begin, end); }, false);
+			for (const auto& dependency : dependencies)
+				add_dependency(index, dependency);
+
+			add_dependency(done, submit(index));
+		}
+
+		return submit(done);
+	}
+
+	void JobSystem::parallel_for(UInt32 count, UInt32 batch_size, const RangeAction& func)
+	{
+		if (count == 0)
+			return;
+
+		if (_workers.empty())
+		{
+			func(0, count);
+			return;
+		}
+
+		if (batch_size == 0)
+			batch_size = Math::max(1u, count / ((worker_count() + 1) * 4));
+
+		const auto done = create_job(nullptr, false);
+		for (UInt32 begin = 0; begin < count; begin += batch_size)
+		{
+			const auto end = begin + Math::min(batch_size, count - begin);
+			const auto index = create_job([&func, begin, end] { func(begin, end); }, false);
+			add_dependency(done, submit(index));
+		}
+
+		wait(submit(done));
+	}
+
+	Bool JobSystem::is_complete(JobHandle handle) const
+	{
+		return !handle.valid() ||
+			get_job(handle.index).generation.load(std::memory_order_acquire) != handle.generation;
+	}
+
+	void JobSystem::wait(JobHandle handle)
+	{
+		const auto worker = s_current_system == this ? Optional<UInt32>(s_current_worker) : std::nullopt;
+		const auto main_thread = std::this_thread::get_id() == _main_thread;
+
+		while (!is_complete(handle))
+		{
+			if (main_thread && dispatch_main() > 0)
+				continue;
+
+			if (!execute_next(worker))
+				std::this_thread::yield();
+		}
+	}
+
+	Size JobSystem::dispatch_main()
+	{
+		List<UInt32> jobs;
+		{
+			std::lock_guard lock(_main_mutex);
+			if (_main_queue.empty())
+				return 0;
+
+			jobs.swap(_main_queue);
+		}
+
+		for (const auto index : jobs)
+			execute(index);
+
+		return jobs.size();
+	}
+
+	JobSystem::Job& JobSystem::get_job(UInt32 index) const
+	{
+		return _blocks[index / BlockSize].load(std::memory_order_acquire)[index % BlockSize];
+	}
+
+	UInt32 JobSystem::create_job(Action<> func, Bool main_thread)
+	{
+		UInt32 index = NoJob;
+
+		while (true)
+		{
+			{
+				std::lock_guard lock(_alloc_mutex);
+				if (_free_job != NoJob)
+				{
+					index = _free_job;
+					_free_job = get_job(index).next_free;
+					break;
+				}
+
+				if (_job_count < BlockSize * MaxBlocks)
+				{
+					index = _job_count++;
+					if (index % BlockSize == 0)
+						_blocks[index / BlockSize].store(new Job[BlockSize], std::memory_order_release);
+					break;
+				}
+			}
+
+			// All slots are busy, help to finish some jobs
+			const auto worker = s_current_system == this ? Optional<UInt32>(s_current_worker) : std::nullopt;
+			if (!execute_next(worker))
+				std::this_thread::yield();
+		}
+
+		auto& job = get_job(index);
+		job.func = std::move(func);
+		job.main_thread = main_thread;
+		job.dependencies.store(1, std::memory_order_relaxed);
+		return index;
+	}
+
+	void JobSystem::free_job(UInt32 index)
+	{
+		std::lock_guard lock(_alloc_mutex);
+		get_job(index).next_free = _free_job;
+		_free_job = index;
+	}
+
+	void JobSystem::add_dependency(UInt32 index, JobHandle dependency)
+	{
+		if (!dependency.valid())
+			return;
+
+		auto& other = get_job(dependency.index);
+		std::lock_guard lock(other.mutex);
+		if (other.generation.load(std::memory_order_relaxed) != dependency.generation)
+			return;
+
+		get_job(index).dependencies.fetch_add(1, std::memory_order_relaxed);
+		other.dependents.push_back(index);
+	}
+
+	JobHandle JobSystem::submit(UInt32 index)
+	{
+		auto& job = get_job(index);
+		// Job can be finished and reused right after submit
+		const JobHandle handle{ index, job.generation.load(std::memory_order_relaxed) };
+
+		if (job.dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			enqueue(index);
+
+		return handle;
+	}
+
+	void JobSystem::enqueue(UInt32 index)
+	{
+		if (get_job(index).main_thread)
+		{
+			std::lock_guard lock(_main_mutex);
+			_main_queue.push_back(index);
+			return;
+		}
+
+		if (_workers.empty())
+		{
+			execute(index);
+			return;
+		}
+
+		const auto worker_index = s_current_system == this
+			? s_current_worker
+			: _next_worker.fetch_add(1, std::memory_order_relaxed) % worker_count();
+
+		auto& worker = *_workers[worker_index];
+		{
+			std::lock_guard lock(worker.mutex);
+			worker.jobs.push_back(index);
+		}
+
+		_queued.fetch_add(1);
+		if (_sleeping.load() > 0)
+		{
+			std::lock_guard lock(_sleep_mutex);
+			_sleep_cv.notify_one();
+		}
+	}
+
+	UInt32 JobSystem::pop_job(Optional<UInt32> worker)
+	{
+		if (worker.has_value())
+		{
+			auto& own = *_workers[worker.value()];
+			std::lock_guard lock(own.mutex);
+			if (!own.jobs.empty())
+			{
+				const auto index = own.jobs.back();
+				own.jobs.pop_back();
+				_queued.fetch_sub(1);
+				return index;
+			}
+		}
+
+		const auto count = worker_count();
+		const auto start = worker.has_value() ? worker.value() + 1 : 0;
+		for (UInt32 i = 0; i < count; i++)
+		{
+			auto& other = *_workers[(start + i) % count];
+			std::lock_guard lock(other.mutex);
+			if (!other.jobs.empty())
+			{
+				const auto index = other.jobs.front();
+				other.jobs.pop_front();
+				_queued.fetch_sub(1);
+				return index;
+			}
+		}
+
+		return NoJob;
+	}
+
+	void JobSystem::execute(UInt32 index)
+	{
+		auto& job = get_job(index);
+		if (job.func)
+		{
+			UC_PROFILE_SCOPE("Job");
+			job.func();
+			job.func = nullptr;
+		}
+
+		finish(index);
+	}
+
+	void JobSystem::finish(UInt32 index)
+	{
+		auto& job = get_job(index);
+		{
+			std::lock_guard lock(job.mutex);
+			auto generation = job.generation.load(std::memory_order_relaxed) + 1;
+			if (generation == 0)
+				generation = 1;
+			job.generation.store(generation, std::memory_order_release);
+		}
+
+		// Dependents list is not changed after generation is updated
+		for (const auto dependent : job.dependents)
+		{
+			if (get_job(dependent).dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				enqueue(dependent);
+		}
+		job.dependents.clear();
+
+		free_job(index);
+	}
+
+	Bool JobSystem::execute_next(Optional<UInt32> worker)
+	{
+		const auto index = pop_job(worker);
+		if (index == NoJob)
+			return false;
+
+		execute(index);
+		return true;
+	}
+
+	void JobSystem::worker_loop(UInt32 worker)
+	{
+		s_current_system = this;
+		s_current_worker = worker;
+		UC_PROFILE_THREAD(StringBuilder::format("Worker {}", worker));
+
+		while (true)
+		{
+			if (execute_next(worker))
+				continue;
+
+			std::unique_lock lock(_sleep_mutex);
+			_sleeping.fetch_add(1);
+			_sleep_cv.wait(lock, [this] { return _stop || _queued.load() > 0; });
+			_sleeping.fetch_sub(1);
+
+			if (_stop)
+				return;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,192 @@
+#include "unicore/system/Lz4.hpp"
+#include "unicore/system/Memory.hpp"
+
+namespace unicore::Lz4
+{
+	static constexpr Size MinMatch = 4;
+	// Last literals and match start limits required by the format
+	static constexpr Size LastLiterals = 5;
+	static constexpr Size MatchFindLimit = 12;
+	static constexpr Size MaxOffset = 65535;
+	static constexpr unsigned HashLog = 12;
+	// Search step grows after this many misses in a row
+	static constexpr unsigned SkipTrigger = 6;
+
+	static UInt32 read32(const Byte* ptr)
+	{
+		UInt32 value;
+		Memory::copy(&value, ptr, sizeof(value));
+		return value;
+	}
+
+	static constexpr UInt32 hash(UInt32 value)
+	{
+		return (value * 2654435761u) >> (32 - HashLog);
+	}
+
+	static Byte* write_length(Byte* op, Size length)
+	{
+		for (; length >= 255; length -= 255)
+			*op++ = 255;
+		*op++ = static_cast<Byte>(length);
+		return op;
+	}
+
+	static bool read_length(const Byte*& ip, const Byte* end, Size& length)
+	{
+		Byte value;
+		do
+		{
+			if (ip >= end)
+				return false;
+
+			value = *ip++;
+			length += value;
+		} while (value == 255);
+
+		return true;
+	}
+
+	static Byte* write_literals(Byte* op, const Byte* literals, Size count, Byte*& token)
+	{
+		token = op++;
+		*token = static_cast<Byte>((count >= 15 ? 15 : count) << 4);
+		if (count >= 15)
+			op = write_length(op, count - 15);
+
+		Memory::copy(op, literals, count);
+		return op + count;
+	}
+
+	Size compress_bound(Size size)
+	{
+		return size + size / 255 + 16;
+	}
+
+	Size compress(const void* src, Size size, void* dest, Size capacity)
+	{
+		if (capacity < compress_bound(size))
+			return 0;
+
+		const auto start = static_cast<const Byte*>(src);
+		const auto end = start + size;
+		auto op = static_cast<Byte*>(dest);
+		auto anchor = start;
+
+		if (size >= MatchFindLimit)
+		{
+			List<UInt32> table(1 << HashLog, 0);
+			const auto match_find_limit = end - MatchFindLimit;
+			const auto match_limit = end - LastLiterals;
+
+			auto ip = start;
+			unsigned misses = 0;
+			while (ip < match_find_limit)
+			{
+				const auto sequence = read32(ip);
+				auto& entry = table[hash(sequence)];
+				auto ref = start + entry;
+				entry = static_cast<UInt32>(ip - start);
+
+				if (ref >= ip || static_cast<Size>(ip - ref) > MaxOffset || read32(ref) != sequence)
+				{
+					ip += 1 + (misses++ >> SkipTrigger);
+					continue;
+				}
+				misses = 0;
+
+				while (ip > anchor && ref > start && ip[-1] == ref[-1])
+				{
+					ip--;
+					ref--;
+				}
+
+				Size length = MinMatch;
+				while (ip + length < match_limit && ip[length] == ref[length])
+					length++;
+
+				Byte* token;
+				op = write_literals(op, anchor, static_cast<Size>(ip - anchor), token);
+
+				const auto offset = static_cast<Size>(ip - ref);
+				*op++ = static_cast<Byte>(offset & 0xFF);
+				*op++ = static_cast<Byte>(offset >> 8);
+
+				const auto match = length - MinMatch;
+				*token |= static_cast<Byte>(match >= 15 ? 15 : match);
+				if (match >= 15)
+					op = write_length(op, match - 15);
+
+				ip += length;
+				anchor = ip;
+			}
+		}
+
+		Byte* token;
+		op = write_literals(op, anchor, static_cast<Size>(end - anchor), token);
+		return static_cast<Size>(op - static_cast<Byte*>(dest));
+	}
+
+	bool decompress(const void* src, Size size, void* dest, Size dest_size)
+	{
+		auto ip = static_cast<const Byte*>(src);
+		const auto end = ip + size;
+		const auto out_start = static_cast<Byte*>(dest);
+		const auto out_end = out_start + dest_size;
+		auto op = out_start;
+
+		while (ip < end)
+		{
+			const auto token = *ip++;
+
+			Size literals = token >> 4;
+			if (literals == 15 && !read_length(ip, end, literals))
+				return false;
+
+			if (literals > static_cast<Size>(end - ip) ||
+				literals > static_cast<Size>(out_end - op))
+				return false;
+
+			Memory::copy(op, ip, literals);
+			op += literals;
+			ip += literals;
+
+			// Last sequence has literals only
+			if (ip == end)
+				break;
+
+			if (end - ip < 2)
+				return false;
+
+			const Size offset = ip[0] | (ip[1] << 8);
+			ip += 2;
+
+			if (offset == 0 || offset > static_cast<Size>(op - out_start))
+				return false;
+
+			Size length = token & 15;
+			if (length == 15 && !read_length(ip, end, length))
+				return false;
+
+			length += MinMatch;
+			if (length > static_cast<Size>(out_end - op))
+				return false;
+
+			const auto ref = op - offset;
+			if (offset >= length)
+			{
+				Memory::copy(op, ref, length);
+				op += length;
+			}
+			else
+			{
+				// Overlapping match repeats last offset bytes
+				for (Size i = 0; i < length; i++)
+					op[i] = ref[i];
+				op += length;
+			}
+		}
+
+		return op == out_end;
+	}
+}
\ No newline at end of file
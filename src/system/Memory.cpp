@@ -4,19 +4,51 @@
 
 namespace unicore
 {
-	// TODO: Debug leak detection
 	void* Memory::alloc(size_t size)
 	{
-		return std::malloc(size);
+		const auto ptr = std::malloc(size);
+		if constexpr (MemoryTracker::enabled)
+		{
+			if (ptr)
+				MemoryTracker::add(ptr, size);
+		}
+		return ptr;
+	}
+
+	void* Memory::alloc(size_t size, const MemorySite& site)
+	{
+		const auto ptr = std::malloc(size);
+		if constexpr (MemoryTracker::enabled)
+		{
+			if (ptr)
+				MemoryTracker::add(ptr, size, site);
+		}
+		return ptr;
 	}
 
 	void* Memory::realloc(void* ptr, size_t size)
 	{
-		return std::realloc(ptr, size);
+		if constexpr (MemoryTracker::enabled)
+		{
+			// Removed before realloc, freed address can be taken by other thread
+			if (ptr)
+				MemoryTracker::remove(ptr);
+
+			const auto result = std::realloc(ptr, size);
+			if (result)
+				MemoryTracker::add(result, size);
+			return result;
+		}
+		else return std::realloc(ptr, size);
 	}
 
 	void Memory::free(void* ptr)
 	{
+		if constexpr (MemoryTracker::enabled)
+		{
+			if (ptr)
+				MemoryTracker::remove(ptr);
+		}
 		std::free(ptr);
 	}
 
@@ -52,9 +84,8 @@ namespace unicore
 	}
 
 	MemoryChunk::MemoryChunk(size_t size)
-		: MemoryChunk(Memory::alloc(size), size, &Memory::free)
+		: MemoryChunk(size > 0 ? Memory::alloc(size) : nullptr, size, &Memory::free)
 	{
-		_data = size > 0 ? static_cast<uint8_t*>(UC_ALLOC(size)) : nullptr;
 	}
 
 	MemoryChunk::MemoryChunk(void* data, size_t size, Memory::FreeFunc free)
@@ -82,6 +113,7 @@ namespace unicore
 
 			_data = Memory::alloc(other.size());
 			_size = other.size();
+			_free = &Memory::free;
 
 			Memory::copy(_data, other._data, _size);
 		}
@@ -0,0 +1,354 @@
+#include "unicore/system/MemoryTracker.hpp"
+#include "unicore/math/Math.hpp"
+#include "unicore/system/Memory.hpp"
+#include "unicore/io/Logger.hpp"
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+namespace unicore
+{
+	namespace
+	{
+		struct Entry
+		{
+			Size size;
+			MemorySite site;
+		};
+
+		struct SiteKey
+		{
+			const char* file;
+			UInt32 line;
+			MemoryCategory category;
+
+			bool operator==(const SiteKey& other) const
+			{
+				return file == other.file && line == other.line && category == other.category;
+			}
+		};
+
+		struct SiteKeyHash
+		{
+			size_t operator()(const SiteKey& key) const
+			{
+				return std::hash<const void*>()(key.file) ^ (key.line * 31 + static_cast<UInt32>(key.category));
+			}
+		};
+
+		struct Registry
+		{
+			std::mutex mutex;
+			std::unordered_map<void*, Entry> live;
+
+			MemoryCounters total;
+			Array<MemoryCounters, MemoryCategoryCount> categories;
+
+			MemoryCounters frame;
+			Array<MemoryCounters, MemoryCategoryCount> frame_categories;
+
+			MemoryCounters last_frame;
+			Array<MemoryCounters, MemoryCategoryCount> last_frame_categories;
+		};
+
+		// Set while registry is locked. Allocations of tracker itself
+		// are not tracked and lock is never taken recursively.
+		thread_local Bool s_busy = false;
+		thread_local const MemorySite* s_scope = nullptr;
+
+		Registry& get_registry()
+		{
+			// Never destroyed and created without operator new,
+			// it is called from inside of operator new
+			alignas(Registry) static Byte storage[sizeof(Registry)];
+			static const auto registry = []
+			{
+				// Containers can allocate in constructor
+				const auto busy = std::exchange(s_busy, true);
+				const auto result = new (storage) Registry();
+				s_busy = busy;
+				return result;
+			}();
+			return *registry;
+		}
+
+		const MemorySite DefaultSite{};
+
+		class RegistryLock
+		{
+		public:
+			explicit RegistryLock(Registry& registry)
+				: _lock(registry.mutex)
+			{
+				s_busy = true;
+			}
+
+			~RegistryLock()
+			{
+				s_busy = false;
+			}
+
+		protected:
+			std::lock_guard<std::mutex> _lock;
+		};
+
+		void count_alloc(MemoryCounters& counters, Size size)
+		{
+			counters.alloc_count++;
+			counters.alloc_bytes += size;
+			counters.used_bytes += size;
+			counters.peak_bytes = Math::max(counters.peak_bytes, counters.used_bytes);
+		}
+
+		void count_free(MemoryCounters& counters, Size size)
+		{
+			counters.free_count++;
+			counters.free_bytes += size;
+			counters.used_bytes -= Math::min<UInt64>(counters.used_bytes, size);
+		}
+
+		void internal_remove(Registry& registry, std::unordered_map<void*, Entry>::iterator it)
+		{
+			const auto size = it->second.size;
+			const auto category = static_cast<UInt8>(it->second.site.category);
+
+			count_free(registry.total, size);
+			count_free(registry.categories[category], size);
+			count_free(registry.frame, size);
+			count_free(registry.frame_categories[category], size);
+
+			registry.live.erase(it);
+		}
+
+		// Frame peak starts from used memory at frame start
+		void begin_frame(MemoryCounters& frame, const MemoryCounters& total)
+		{
+			frame = {};
+			frame.used_bytes = total.used_bytes;
+			frame.peak_bytes = total.used_bytes;
+		}
+	}
+
+	const char* memory_category_name(MemoryCategory category)
+	{
+		switch (category)
+		{
+		case MemoryCategory::General: return "General";
+		case MemoryCategory::Resource: return "Resource";
+		case MemoryCategory::Renderer: return "Renderer";
+		case MemoryCategory::Text: return "Text";
+		case MemoryCategory::Logger: return "Logger";
+		case MemoryCategory::UI: return "UI";
+		}
+
+		return "Unknown";
+	}
+
+	// MemoryTracker //////////////////////////////////////////////////////////////
+	void MemoryTracker::add(void* ptr, Size size)
+	{
+		add(ptr, size, s_scope ? *s_scope : DefaultSite);
+	}
+
+	void MemoryTracker::add(void* ptr, Size size, const MemorySite& site)
+	{
+		if (!enabled || s_busy)
+			return;
+
+		auto& registry = get_registry();
+		RegistryLock lock(registry);
+
+		// Address was freed without Memory::free
+		if (const auto it = registry.live.find(ptr); it != registry.live.end())
+			internal_remove(registry, it);
+
+		const auto category = static_cast<UInt8>(site.category);
+		count_alloc(registry.total, size);
+		count_alloc(registry.categories[category], size);
+		count_alloc(registry.frame, size);
+		count_alloc(registry.frame_categories[category], size);
+
+		registry.live.emplace(ptr, Entry{ size, site });
+	}
+
+	void MemoryTracker::remove(void* ptr)
+	{
+		if (!enabled || s_busy)
+			return;
+
+		auto& registry = get_registry();
+		RegistryLock lock(registry);
+
+		if (const auto it = registry.live.find(ptr); it != registry.live.end())
+			internal_remove(registry, it);
+	}
+
+	MemoryCounters MemoryTracker::total()
+	{
+		auto& registry = get_registry();
+		RegistryLock lock(registry);
+		return registry.total;
+	}
+
+	MemoryCounters MemoryTracker::category(MemoryCategory category)
+	{
+		auto& registry = get_registry();
+		RegistryLock lock(registry);
+		return registry.categories[static_cast<UInt8>(category)];
+	}
+
+	void MemoryTracker::mark_frame()
+	{
+		auto& registry = get_registry();
+		RegistryLock lock(registry);
+
+		registry.last_frame = registry.frame;
+		registry.last_frame_categories = registry.frame_categories;
+
+		begin_frame(registry.frame, registry.total);
+		for (UInt8 i = 0; i < MemoryCategoryCount; i++)
+			begin_frame(registry.frame_categories[i], registry.categories[i]);
+	}
+
+	MemoryCounters MemoryTracker::last_frame()
+	{
+		auto& registry = get_registry();
+		RegistryLock lock(registry);
+		return registry.last_frame;
+	}
+
+	MemoryCounters MemoryTracker::last_frame(MemoryCategory category)
+	{
+		auto& registry = get_registry();
+		RegistryLock lock(registry);
+		return registry.last_frame_categories[static_cast<UInt8>(category)];
+	}
+
+	void MemoryTracker::collect_live(List<SiteInfo>& sites)
+	{
+		const auto start = sites.size();
+
+		{
+			auto& registry = get_registry();
+			RegistryLock lock(registry);
+
+			std::unordered_map<SiteKey, Size, SiteKeyHash> indices;
+			for (const auto& it : registry.live)
+			{
+				const auto& entry = it.second;
+				const SiteKey key{ entry.site.file, entry.site.line, entry.site.category };
+
+				const auto result = indices.emplace(key, sites.size());
+				if (result.second)
+					sites.push_back({ entry.site, 0, 0 });
+
+				auto& info = sites[result.first->second];
+				info.count++;
+				info.bytes += entry.size;
+			}
+		}
+
+		std::sort(sites.begin() + start, sites.end(),
+			[](const SiteInfo& a, const SiteInfo& b) { return a.bytes > b.bytes; });
+	}
+
+	UInt64 MemoryTracker::dump_leaks(Logger& logger)
+	{
+		List<SiteInfo> sites;
+		collect_live(sites);
+
+		UInt64 count = 0;
+		UInt64 bytes = 0;
+		for (const auto& info : sites)
+		{
+			UC_LOG_WARNING(logger) << "Live " << MemorySize{ info.bytes }
+				<< " in " << info.count << " allocations ("
+				<< memory_category_name(info.site.category) << ") at "
+				<< (info.site.file ? info.site.file : "<unknown>") << ":" << info.site.line;
+
+			count += info.count;
+			bytes += info.bytes;
+		}
+
+		if (count > 0)
+			UC_LOG_WARNING(logger) << "Total live " << MemorySize{ bytes } << " in " << count << " allocations";
+
+		return count;
+	}
+
+	// MemoryScope ////////////////////////////////////////////////////////////////
+	MemoryScope::MemoryScope(const MemorySite& site)
+		: _site(site), _prev(s_scope)
+	{
+		s_scope = &_site;
+	}
+
+	MemoryScope::~MemoryScope()
+	{
+		s_scope = _prev;
+	}
+}
+
+#if defined(UNICORE_USE_MEMORY_TRACKING)
+// Replaced global allocation functions, allocation gets site of current
+// MemoryScope. Aligned versions are left to the standard library.
+void* operator new(std::size_t size)
+{
+	const auto ptr = std::malloc(size > 0 ? size : 1);
+	if (!ptr)
+		throw std::bad_alloc();
+
+	unicore::MemoryTracker::add(ptr, size);
+	return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	const auto ptr = std::malloc(size > 0 ? size : 1);
+	if (ptr)
+		unicore::MemoryTracker::add(ptr, size);
+	return ptr;
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+	return operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	if (ptr)
+		unicore::MemoryTracker::remove(ptr);
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	operator delete(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	operator delete(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+	operator delete(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+	operator delete(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+	operator delete(ptr);
+}
+#endif
\ No newline at end of file
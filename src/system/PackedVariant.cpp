@@ -0,0 +1,457 @@
+#include "unicore/system/PackedVariant.hpp"
+#include "unicore/system/StringHelper.hpp"
+#include "unicore/system/Unicode.hpp"
+
+namespace unicore
+{
+	template<typename T>
+	struct PackedVariant::BoxValue : Box
+	{
+		T value;
+
+		explicit BoxValue(const T& value)
+			: value(value)
+		{
+		}
+	};
+
+	const PackedVariant PackedVariant::Empty;
+
+	template<typename T>
+	const T& PackedVariant::read_boxed() const
+	{
+		return static_cast<const BoxValue<T>*>(box())->value;
+	}
+
+	template<typename T>
+	void PackedVariant::set_boxed(Type type, const T& value)
+	{
+		Box* ptr = new BoxValue<T>(value);
+		std::memcpy(_data, &ptr, sizeof(Box*));
+		_length = BoxedLength;
+		_type = type;
+	}
+
+	template const Recti& PackedVariant::read_boxed<Recti>() const;
+	template const Rectf& PackedVariant::read_boxed<Rectf>() const;
+	template const Color4f& PackedVariant::read_boxed<Color4f>() const;
+
+	PackedVariant::PackedVariant(const Char* value)
+		: PackedVariant(StringView(value))
+	{
+	}
+
+	PackedVariant::PackedVariant(StringView value)
+	{
+		if (value.size() <= InlineSize)
+		{
+			std::memcpy(_data, value.data(), value.size());
+			_length = static_cast<UInt8>(value.size());
+			_type = Type::String;
+		}
+		else set_boxed(Type::String, String(value));
+	}
+
+	PackedVariant::PackedVariant(const Char32* value)
+		: PackedVariant(StringView32(value))
+	{
+	}
+
+	PackedVariant::PackedVariant(StringView32 value)
+	{
+		set_boxed(Type::String32, String32(value));
+	}
+
+	PackedVariant::PackedVariant(const Recti& value)
+	{
+		set_boxed(Type::Recti, value);
+	}
+
+	PackedVariant::PackedVariant(const Rectf& value)
+	{
+		set_boxed(Type::Rectf, value);
+	}
+
+	PackedVariant::PackedVariant(const Color4f& value)
+	{
+		set_boxed(Type::Color4f, value);
+	}
+
+	PackedVariant::PackedVariant(const Shared<Object>& value)
+	{
+		set_boxed(Type::Object, value);
+	}
+
+	PackedVariant::PackedVariant(const Variant& value)
+	{
+		std::visit([this](const auto& item)
+		{
+			using T = std::decay_t<decltype(item)>;
+
+			if constexpr (std::is_same_v<T, String>)
+				*this = PackedVariant(StringView(item));
+			else if constexpr (std::is_same_v<T, String32>)
+				*this = PackedVariant(StringView32(item));
+			else *this = PackedVariant(item);
+		}, value.data());
+	}
+
+	void PackedVariant::release()
+	{
+		if (!is_boxed())
+			return;
+
+		const auto ptr = box();
+		if (ptr->references.fetch_sub(1, std::memory_order_acq_rel) != 1)
+			return;
+
+		switch (_type)
+		{
+		case Type::String:
+			delete static_cast<BoxValue<String>*>(ptr);
+			break;
+
+		case Type::String32:
+			delete static_cast<BoxValue<String32>*>(ptr);
+			break;
+
+		case Type::Recti:
+			delete static_cast<BoxValue<Recti>*>(ptr);
+			break;
+
+		case Type::Rectf:
+			delete static_cast<BoxValue<Rectf>*>(ptr);
+			break;
+
+		case Type::Color4f:
+			delete static_cast<BoxValue<Color4f>*>(ptr);
+			break;
+
+		case Type::Object:
+			delete static_cast<BoxValue<Shared<Object>>*>(ptr);
+			break;
+
+		default:
+			UC_ASSERT_ALWAYS_MSG("Invalid boxed type");
+			break;
+		}
+	}
+
+	template<typename Func>
+	decltype(auto) PackedVariant::visit(Func func) const
+	{
+		switch (_type)
+		{
+		case Type::Bool: return func(read_inline<Bool>());
+		case Type::Int: return func(read_inline<Int>());
+		case Type::Int64: return func(read_inline<Int64>());
+		case Type::Float: return func(read_inline<Float>());
+		case Type::Double: return func(read_inline<Double>());
+		case Type::String: return func(is_boxed()
+			? StringView(read_boxed<String>())
+			: StringView(reinterpret_cast<const Char*>(_data), _length));
+		case Type::String32: return func(StringView32(read_boxed<String32>()));
+		case Type::Vector2i: return func(read_inline<Vector2i>());
+		case Type::Vector2f: return func(read_inline<Vector2f>());
+		case Type::Vector3i: return func(read_inline<Vector3i>());
+		case Type::Vector3f: return func(read_inline<Vector3f>());
+		case Type::Rangei: return func(read_inline<Rangei>());
+		case Type::Rangef: return func(read_inline<Rangef>());
+		case Type::Recti: return func(read_boxed<Recti>());
+		case Type::Rectf: return func(read_boxed<Rectf>());
+		case Type::Color3b: return func(read_inline<Color3b>());
+		case Type::Color3f: return func(read_inline<Color3f>());
+		case Type::Color4b: return func(read_inline<Color4b>());
+		case Type::Color4f: return func(read_boxed<Color4f>());
+		case Type::Object: return func(read_boxed<Shared<Object>>());
+		}
+
+		UC_ASSERT_ALWAYS_MSG("Invalid type");
+		return func(false);
+	}
+
+	Variant PackedVariant::to_variant() const
+	{
+		return visit([](const auto& value) { return Variant(value); });
+	}
+
+	// BOOL //////////////////////////////////////////////////////////////////////
+	Bool PackedVariant::try_get_bool(Bool& value) const
+	{
+		if (_type == Type::Bool)
+		{
+			value = read_inline<Bool>();
+			return true;
+		}
+
+		if (Int64 i; try_get_integral(i) && (i == 0 || i == 1))
+		{
+			value = i == 1;
+			return true;
+		}
+
+		if (StringView str; try_get_string(str))
+		{
+			if (StringHelper::equals(str, "true", true))
+			{
+				value = true;
+				return true;
+			}
+
+			if (StringHelper::equals(str, "false", true))
+			{
+				value = false;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	Bool PackedVariant::get_bool(Bool default_value) const
+	{
+		Bool value;
+		return try_get_bool(value) ? value : default_value;
+	}
+
+	// NUMBERS ///////////////////////////////////////////////////////////////////
+	bool PackedVariant::try_get_int(Int& value) const
+	{
+		if (try_get_integral(value))
+			return true;
+
+		if (Float f; try_get_floating_point(f))
+		{
+			value = static_cast<Int>(f);
+			return true;
+		}
+
+		return false;
+	}
+
+	Int PackedVariant::get_int(Int default_value) const
+	{
+		Int value;
+		return try_get_int(value) ? value : default_value;
+	}
+
+	bool PackedVariant::try_get_int64(Int64& value) const
+	{
+		if (try_get_integral(value))
+			return true;
+
+		if (Double d; try_get_floating_point(d))
+		{
+			value = static_cast<Int64>(d);
+			return true;
+		}
+
+		return false;
+	}
+
+	Int64 PackedVariant::get_int64(Int64 default_value) const
+	{
+		Int64 value;
+		return try_get_int64(value) ? value : default_value;
+	}
+
+	bool PackedVariant::try_get_float(Float& value) const
+	{
+		if (try_get_floating_point(value))
+			return true;
+
+		if (Int64 i; try_get_integral(i))
+		{
+			value = static_cast<Float>(i);
+			return true;
+		}
+
+		return false;
+	}
+
+	Float PackedVariant::get_float(Float default_value) const
+	{
+		Float value;
+		return try_get_float(value) ? value : default_value;
+	}
+
+	bool PackedVariant::try_get_double(Double& value) const
+	{
+		if (try_get_floating_point(value))
+			return true;
+
+		if (Int64 i; try_get_integral(i))
+		{
+			value = static_cast<Double>(i);
+			return true;
+		}
+
+		return false;
+	}
+
+	Double PackedVariant::get_double(Double default_value) const
+	{
+		Double value;
+		return try_get_double(value) ? value : default_value;
+	}
+
+	// STRING ////////////////////////////////////////////////////////////////////
+	bool PackedVariant::try_get_string(StringView& value) const
+	{
+		if (_type != Type::String)
+			return false;
+
+		if (is_boxed())
+			value = read_boxed<String>();
+		else value = StringView(reinterpret_cast<const Char*>(_data), _length);
+		return true;
+	}
+
+	bool PackedVariant::try_get_string(String& value) const
+	{
+		if (StringView view; try_get_string(view))
+		{
+			value = view;
+			return true;
+		}
+
+		if (StringView32 view; try_get_string32(view))
+		{
+			value = Unicode::to_utf8(view);
+			return true;
+		}
+
+		if (Int64 i; try_get_integral(i))
+		{
+			value = std::to_string(i);
+			return true;
+		}
+
+		if (Double d; try_get_floating_point(d))
+		{
+			value = std::to_string(d);
+			return true;
+		}
+
+		return false;
+	}
+
+	String PackedVariant::get_string(StringView default_value) const
+	{
+		String str;
+		return try_get_string(str) ? str : String(default_value);
+	}
+
+	bool PackedVariant::try_get_string32(StringView32& value) const
+	{
+		if (_type != Type::String32)
+			return false;
+
+		value = read_boxed<String32>();
+		return true;
+	}
+
+	bool PackedVariant::try_get_string32(String32& value) const
+	{
+		if (StringView32 view; try_get_string32(view))
+		{
+			value = view;
+			return true;
+		}
+
+		if (StringView view; try_get_string(view))
+		{
+			value = Unicode::to_utf32(view);
+			return true;
+		}
+
+		if (Int64 i; try_get_integral(i))
+		{
+			value = Unicode::to_utf32(std::to_string(i));
+			return true;
+		}
+
+		if (Double d; try_get_floating_point(d))
+		{
+			value = Unicode::to_utf32(std::to_string(d));
+			return true;
+		}
+
+		return false;
+	}
+
+	String32 PackedVariant::get_string32(StringView32 default_value) const
+	{
+		String32 str;
+		return try_get_string32(str) ? str : String32(default_value);
+	}
+
+	// OBJECT ////////////////////////////////////////////////////////////////////
+	bool PackedVariant::try_get_object(Shared<Object>& value) const
+	{
+		if (_type != Type::Object)
+			return false;
+
+		value = read_boxed<Shared<Object>>();
+		return true;
+	}
+
+	Shared<Object> PackedVariant::get_object(const Shared<Object>& default_value) const
+	{
+		Shared<Object> value;
+		return try_get_object(value) ? value : default_value;
+	}
+
+	// COMPARE ///////////////////////////////////////////////////////////////////
+	Bool PackedVariant::equals(const PackedVariant& other) const
+	{
+		if (_type != other._type || _length != other._length)
+			return false;
+
+		if (is_boxed() && box() == other.box())
+			return true;
+
+		return visit([&other](const auto& value)
+		{
+			using T = std::decay_t<decltype(value)>;
+
+			if constexpr (std::is_same_v<T, StringView>)
+			{
+				StringView str;
+				return other.try_get_string(str) && str == value;
+			}
+			else if constexpr (std::is_same_v<T, StringView32>)
+			{
+				StringView32 str;
+				return other.try_get_string32(str) && str == value;
+			}
+			else if constexpr (std::is_same_v<T, Shared<Object>>)
+				return other.read_boxed<Shared<Object>>() == value;
+			else if constexpr (is_inline<T>())
+				return other.read_inline<T>() == value;
+			else return other.read_boxed<T>() == value;
+		});
+	}
+
+	Bool PackedVariant::equals(const Variant& other) const
+	{
+		if (other.data().index() != static_cast<Size>(_type))
+			return false;
+
+		return visit([&other](const auto& value)
+		{
+			using T = std::decay_t<decltype(value)>;
+
+			if constexpr (std::is_same_v<T, StringView>)
+				return StringView(std::get<String>(other.data())) == value;
+			else if constexpr (std::is_same_v<T, StringView32>)
+				return StringView32(std::get<String32>(other.data())) == value;
+			else return std::get<T>(other.data()) == value;
+		});
+	}
+
+	UNICODE_STRING_BUILDER_FORMAT(const PackedVariant&)
+	{
+		return builder << value.to_variant();
+	}
+}
\ No newline at end of file
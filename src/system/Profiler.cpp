@@ -0,0 +1,249 @@
+#include "unicore/system/Profiler.hpp"
+#include "unicore/system/StringBuilder.hpp"
+#include "unicore/io/FileProvider.hpp"
+#include "unicore/io/File.hpp"
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+
+namespace unicore
+{
+	namespace
+	{
+		// Fields are atomic, reader can copy slot while owner thread overwrites it
+		struct ZoneSlot
+		{
+			std::atomic<const char*> name{ nullptr };
+			std::atomic<Int64> begin{ 0 };
+			std::atomic<Int64> end{ 0 };
+			std::atomic<UInt32> depth{ 0 };
+		};
+
+		struct ThreadData
+		{
+			UInt32 index = 0;
+			String name;
+			UInt32 depth = 0;
+
+			Unique<ZoneSlot[]> zones = std::make_unique<ZoneSlot[]>(Profiler::ZoneCapacity);
+			std::atomic<UInt64> written{ 0 };
+		};
+
+		struct Registry
+		{
+			const Timer start = Timer::now();
+
+			std::mutex mutex;
+			List<Unique<ThreadData>> threads;
+
+			std::atomic<Int64> frames[Profiler::FrameCapacity] = {};
+			std::atomic<UInt64> frame_count{ 0 };
+		};
+
+		Registry& get_registry()
+		{
+			// Never destroyed, zones can be recorded by static objects
+			static const auto registry = new Registry();
+			return *registry;
+		}
+
+		thread_local ThreadData* s_thread = nullptr;
+
+		ThreadData& get_thread()
+		{
+			if (s_thread == nullptr)
+			{
+				auto& registry = get_registry();
+				std::lock_guard lock(registry.mutex);
+
+				auto data = make_unique<ThreadData>();
+				data->index = static_cast<UInt32>(registry.threads.size());
+				data->name = StringBuilder::format("Thread {}", data->index);
+
+				s_thread = data.get();
+				registry.threads.push_back(std::move(data));
+			}
+
+			return *s_thread;
+		}
+
+		void append_json_string(StringBuilder& builder, StringView str)
+		{
+			builder << '"';
+			for (const auto c : str)
+			{
+				switch (c)
+				{
+				case '"': builder << "\\\""; break;
+				case '\\': builder << "\\\\"; break;
+				case '\n': builder << "\\n"; break;
+				default:
+					if (static_cast<UInt8>(c) < 0x20)
+						builder << ' ';
+					else builder << c;
+					break;
+				}
+			}
+			builder << '"';
+		}
+	}
+
+	Int64 Profiler::now()
+	{
+		return (Timer::now() - get_registry().start).data().count();
+	}
+
+	UInt32 Profiler::enter()
+	{
+		return get_thread().depth++;
+	}
+
+	void Profiler::leave(const char* name, Int64 begin, UInt32 depth)
+	{
+		const auto end = now();
+
+		auto& thread = get_thread();
+		thread.depth = depth;
+
+		const auto index = thread.written.load(std::memory_order_relaxed);
+		auto& slot = thread.zones[index % ZoneCapacity];
+		slot.name.store(name, std::memory_order_relaxed);
+		slot.begin.store(begin, std::memory_order_relaxed);
+		slot.end.store(end, std::memory_order_relaxed);
+		slot.depth.store(depth, std::memory_order_relaxed);
+		thread.written.store(index + 1, std::memory_order_release);
+	}
+
+	void Profiler::mark_frame()
+	{
+		auto& registry = get_registry();
+		const auto index = registry.frame_count.fetch_add(1, std::memory_order_relaxed);
+		registry.frames[index % FrameCapacity].store(now(), std::memory_order_release);
+	}
+
+	void Profiler::set_thread_name(StringView name)
+	{
+		auto& thread = get_thread();
+
+		std::lock_guard lock(get_registry().mutex);
+		thread.name = name;
+	}
+
+	void Profiler::collect(List<Zone>& zones, Int64 time)
+	{
+		auto& registry = get_registry();
+		std::lock_guard lock(registry.mutex);
+
+		for (const auto& thread : registry.threads)
+		{
+			const auto written = thread->written.load(std::memory_order_acquire);
+			const auto first = written > ZoneCapacity ? written - ZoneCapacity : 0;
+			const auto start = zones.size();
+
+			for (auto index = first; index < written; index++)
+			{
+				const auto& slot = thread->zones[index % ZoneCapacity];
+				const Zone zone{
+					slot.name.load(std::memory_order_relaxed),
+					slot.begin.load(std::memory_order_relaxed),
+					slot.end.load(std::memory_order_relaxed),
+					slot.depth.load(std::memory_order_relaxed),
+					thread->index };
+
+				// Skip slot that was overwritten while copying
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (thread->written.load(std::memory_order_relaxed) > index + ZoneCapacity)
+					continue;
+
+				if (zone.end >= time)
+					zones.push_back(zone);
+			}
+
+			std::sort(zones.begin() + start, zones.end(),
+				[](const Zone& a, const Zone& b) { return a.begin < b.begin; });
+		}
+	}
+
+	void Profiler::collect_frames(List<Int64>& frames)
+	{
+		auto& registry = get_registry();
+		const auto count = registry.frame_count.load(std::memory_order_acquire);
+		const auto first = count > FrameCapacity ? count - FrameCapacity : 0;
+
+		for (auto index = first; index < count; index++)
+			frames.push_back(registry.frames[index % FrameCapacity].load(std::memory_order_acquire));
+	}
+
+	void Profiler::collect_threads(List<String>& names)
+	{
+		auto& registry = get_registry();
+		std::lock_guard lock(registry.mutex);
+
+		for (const auto& thread : registry.threads)
+			names.push_back(thread->name);
+	}
+
+	Bool Profiler::write_chrome_trace(WriteFileProvider& provider, const Path& path)
+	{
+		const auto file = provider.create_new(path);
+		if (!file)
+			return false;
+
+		List<Zone> zones;
+		List<Int64> frames;
+		List<String> threads;
+		collect(zones);
+		collect_frames(frames);
+		collect_threads(threads);
+
+		StringBuilder builder;
+		Bool first = true;
+
+		const auto begin_event = [&]
+		{
+			builder << (first ? "\n" : ",\n");
+			first = false;
+
+			// Write by chunks, trace can be large
+			if (builder.size() >= 64 * 1024)
+			{
+				file->write(builder.c_str(), builder.size());
+				builder.clear();
+			}
+		};
+
+		builder << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+		for (UInt32 i = 0; i < threads.size(); i++)
+		{
+			begin_event();
+			builder << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << i << ",\"args\":{\"name\":";
+			append_json_string(builder, threads[i]);
+			builder << "}}";
+		}
+
+		for (const auto& zone : zones)
+		{
+			begin_event();
+			builder << "{\"name\":";
+			append_json_string(builder, zone.name);
+			builder << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << zone.thread << ",\"ts\":";
+			builder.append_float(static_cast<Double>(zone.begin) / 1000, 3);
+			builder << ",\"dur\":";
+			builder.append_float(static_cast<Double>(zone.end - zone.begin) / 1000, 3);
+			builder << '}';
+		}
+
+		for (const auto frame : frames)
+		{
+			begin_event();
+			builder << "{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":";
+			builder.append_float(static_cast<Double>(frame) / 1000, 3);
+			builder << '}';
+		}
+
+		builder << "\n]}\n";
+		file->write(builder.c_str(), builder.size());
+		return file->flush();
+	}
+}
\ No newline at end of file
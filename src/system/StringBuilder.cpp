@@ -1,55 +1,171 @@
 #include "unicore/system/StringBuilder.hpp"
 #include "unicore/system/Unicode.hpp"
+#include "unicore/system/Memory.hpp"
+#include <cstdio>
 
 namespace unicore
 {
+	StringBuilder::StringBuilder(const StringBuilder& other)
+		: StringBuilder()
+	{
+		append(other.view());
+	}
+
 	StringBuilder::StringBuilder(StringBuilder&& other) noexcept
-		: data(std::move(other.data))
+		: StringBuilder()
+	{
+		*this = std::move(other);
+	}
+
+	StringBuilder::~StringBuilder()
 	{
+		release();
+	}
+
+	void StringBuilder::clear()
+	{
+		_size = 0;
+		_data[0] = 0;
+	}
+
+	void StringBuilder::reserve(Size capacity)
+	{
+		if (capacity + 1 <= _capacity)
+			return;
+
+		const auto data = new Char[capacity + 1];
+		Memory::copy(data, _data, _size + 1);
+		release();
+
+		_data = data;
+		_capacity = capacity + 1;
 	}
 
 	void StringBuilder::append(char c)
 	{
-		const char str[] = { c, 0 };
-		append(str);
+		*grow(1) = c;
 	}
 
 	void StringBuilder::append(Char16 c)
 	{
-		const Char16 str[] = { c, 0 };
-		append(str);
+		append(StringView16(&c, 1));
 	}
 
 	void StringBuilder::append(Char32 c)
 	{
-		const Char32 str[] = { c, 0 };
-		append(str);
+		append(StringView32(&c, 1));
 	}
 
 	void StringBuilder::append(StringView text)
 	{
-		data.append(text);
+		if (!text.empty())
+			Memory::copy(grow(text.size()), text.data(), text.size());
 	}
 
 	void StringBuilder::append(StringView16 text)
 	{
-		data.append(Unicode::to_utf8(text));
+		Unicode::write_utf8(text, grow(Unicode::utf8_size(text)));
 	}
 
 	void StringBuilder::append(StringView32 text)
 	{
-		data.append(Unicode::to_utf8(text));
+		Unicode::write_utf8(text, grow(Unicode::utf8_size(text)));
+	}
+
+	void StringBuilder::append_float(Double value, int precision)
+	{
+		// Fixed notation of largest double fits
+		Char buffer[512];
+#if defined(__cpp_lib_to_chars)
+		const auto result = std::to_chars(buffer, buffer + sizeof(buffer),
+			value, std::chars_format::fixed, precision);
+		if (result.ec == std::errc())
+			append(StringView(buffer, result.ptr - buffer));
+#else
+		const auto count = std::snprintf(buffer, sizeof(buffer), "%.*f", precision, value);
+		if (count > 0)
+			append(StringView(buffer, std::min<Size>(count, sizeof(buffer) - 1)));
+#endif
+	}
+
+	void StringBuilder::append_hex(UInt64 value, Size digits)
+	{
+		static constexpr Char HexMap[] = "0123456789abcdef";
+
+		digits = std::min<Size>(digits, 16);
+		auto out = grow(digits);
+		for (Size i = 0; i < digits; i++)
+			out[i] = HexMap[(value >> ((digits - i - 1) * 4)) & 0xF];
+	}
+
+	StringBuilder& StringBuilder::operator=(const StringBuilder& other)
+	{
+		if (this != &other)
+		{
+			clear();
+			append(other.view());
+		}
+
+		return *this;
 	}
 
 	StringBuilder& StringBuilder::operator=(StringBuilder&& other) noexcept
 	{
-		data = std::move(other.data);
+		if (this == &other)
+			return *this;
+
+		if (other._data != other._inline)
+		{
+			release();
+			_data = std::exchange(other._data, other._inline);
+			_size = std::exchange(other._size, 0);
+			_capacity = std::exchange(other._capacity, InlineCapacity);
+			other._inline[0] = 0;
+		}
+		else
+		{
+			clear();
+			append(other.view());
+			other.clear();
+		}
+
 		return *this;
 	}
 
+	Char* StringBuilder::grow(Size count)
+	{
+		if (_size + count + 1 > _capacity)
+			reserve(std::max(_size + count, _capacity * 2));
+
+		const auto ptr = _data + _size;
+		_size += count;
+		_data[_size] = 0;
+		return ptr;
+	}
+
+	void StringBuilder::release()
+	{
+		if (_data != _inline)
+			delete[] _data;
+
+		_data = _inline;
+		_capacity = InlineCapacity;
+	}
+
+	Size StringBuilder::copy_to(Char* buffer, Size buffer_size) const
+	{
+		if (buffer_size == 0)
+			return 0;
+
+		const auto count = std::min(_size, buffer_size - 1);
+		Memory::copy(buffer, _data, count);
+		buffer[count] = 0;
+		return count;
+	}
+
 	UNICODE_STRING_BUILDER_FORMAT(const StringBuilder&)
 	{
-		return builder << value.data;
+		return builder << value.view();
 	}
 
 	UNICODE_STRING_BUILDER_FORMAT(bool)
@@ -106,13 +222,15 @@ namespace unicore
 	UNICODE_STRING_BUILDER_FORMAT(float)
 	{
 		// TODO: Implement precision
-		return builder << StringHelper::print_format("%.2f", value);
+		builder.append_float(value);
+		return builder;
 	}
 
 	UNICODE_STRING_BUILDER_FORMAT(double)
 	{
 		// TODO: Implement precision
-		return builder << StringHelper::print_format("%.2lf", value);
+		builder.append_float(value);
+		return builder;
 	}
 
 	UNICODE_STRING_BUILDER_FORMAT(const std::type_info&)
@@ -1,8 +1,61 @@
 #include "unicore/system/TextBlock.hpp"
 #include "unicore/renderer/Font.hpp"
+#include "unicore/system/MemoryTracker.hpp"
 
 namespace unicore
 {
+	namespace
+	{
+		template<typename TLines>
+		void internal_parse_lines(StringView32 text, TLines& lines)
+		{
+			using LineText = decltype(TLines::value_type::text);
+
+			size_t pos;
+			while ((pos = text.find_first_of(L'\n')) != StringView32::npos)
+			{
+				if (pos > 0)
+					lines.push_back({ LineText(text.substr(0, pos)) });
+				else lines.push_back({ LineText() });
+				text = text.substr(pos + 1);
+			}
+
+			if (!text.empty())
+				lines.push_back({ LineText(text) });
+		}
+
+		template<typename TLines>
+		void internal_calc_line_size(const Font& font, TLines& lines)
+		{
+			for (auto& line : lines)
+				line.size = !line.text.empty() ? font.calc_size(line.text) : Vector2f(0, font.get_height());
+		}
+
+		template<typename TLines, typename TOffsets>
+		void internal_calc_align_offset(const TLines& lines,
+			TextAlign align, TOffsets& offset_list, bool round)
+		{
+			Vector2f total_size = VectorConst2f::Zero;
+			for (const auto& line : lines)
+			{
+				total_size.y += line.size.y;
+				total_size.x = Math::max(total_size.x, line.size.x);
+			}
+
+			auto total_offset = TextBlock::calc_align_offset(total_size, align);
+
+			offset_list.clear();
+			offset_list.reserve(lines.size());
+
+			for (const auto& line : lines)
+			{
+				if (!round) offset_list.push_back(total_offset);
+				else offset_list.push_back({ Math::round(total_offset.x), Math::round(total_offset.y) });
+				total_offset.y += line.size.y;
+			}
+		}
+	}
+
 	TextBlock::TextBlock(const Shared<Font>& font, StringView32 text)
 		: _font(font)
 	{
@@ -12,24 +65,24 @@ namespace unicore
 
 	void TextBlock::parse_lines(StringView32 text_, List<TextLine>& lines)
 	{
-		StringView32 text = text_;
-		size_t pos;
-		while ((pos = text.find_first_of(L'\n')) != StringView32::npos)
-		{
-			if (pos > 0)
-				lines.push_back({ String32(text.substr(0, pos)) });
-			else lines.push_back({ U"" });
-			text = text.substr(pos + 1);
-		}
+		UC_MEMORY_SCOPE(MemoryCategory::Text);
 
-		if (!text.empty())
-			lines.push_back({ String32(text) });
+		internal_parse_lines(text_, lines);
+	}
+
+	void TextBlock::parse_lines(StringView32 text, ArenaList<TextLineView>& lines)
+	{
+		internal_parse_lines(text, lines);
 	}
 
 	void TextBlock::calc_line_size(const Font& font, List<TextLine>& lines)
 	{
-		for (auto& line : lines)
-			line.size = !line.text.empty() ? font.calc_size(line.text) : Vector2f(0, font.get_height());
+		internal_calc_line_size(font, lines);
+	}
+
+	void TextBlock::calc_line_size(const Font& font, ArenaList<TextLineView>& lines)
+	{
+		internal_calc_line_size(font, lines);
 	}
 
 	Vector2f TextBlock::calc_align_offset(const Vector2f& size, TextAlign align)
@@ -88,25 +141,19 @@ namespace unicore
 	void TextBlock::calc_align_offset(const List<TextLine>& lines,
 		TextAlign align, List<Vector2f>& offset_list, bool round)
 	{
-		const auto total_size = std::accumulate(lines.begin(), lines.end(),
-			VectorConst2f::Zero, [](Vector2f size, const TextLine& item)
-			{
-				size.y += item.size.y;
-				size.x = Math::max(size.x, item.size.x);
-				return size;
-			});
-
-		auto total_offset = calc_align_offset(total_size, align);
+		internal_calc_align_offset(lines, align, offset_list, round);
+	}
 
-		offset_list.clear();
-		offset_list.reserve(lines.size());
+	void TextBlock::calc_align_offset(const List<TextLine>& lines,
+		TextAlign align, ArenaList<Vector2f>& offset_list, bool round)
+	{
+		internal_calc_align_offset(lines, align, offset_list, round);
+	}
 
-		for (const auto& line : lines)
-		{
-			if (!round) offset_list.push_back(total_offset);
-			else offset_list.push_back({ Math::round(total_offset.x), Math::round(total_offset.y) });
-			total_offset.y += line.size.y;
-		}
+	void TextBlock::calc_align_offset(const ArenaList<TextLineView>& lines,
+		TextAlign align, ArenaList<Vector2f>& offset_list, bool round)
+	{
+		internal_calc_align_offset(lines, align, offset_list, round);
 	}
 
 	// AlignedTextBlock ///////////////////////////////////////////////////////////
@@ -127,6 +174,8 @@ namespace unicore
 
 	void AlignedTextBlock::update_align()
 	{
+		UC_MEMORY_SCOPE(MemoryCategory::Text);
+
 		calc_align_offset(_lines, _align, _offset_list);
 	}
 }
\ No newline at end of file
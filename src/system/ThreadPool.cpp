@@ -0,0 +1,103 @@
+#include "unicore/system/ThreadPool.hpp"
+#include "unicore/math/Math.hpp"
+
+#if defined(UNICORE_PLATFORM_EMSCRIPTEN) && !defined(__EMSCRIPTEN_PTHREADS__)
+#	define UNICORE_THREAD_POOL_INLINE
+#endif
+
+namespace unicore
+{
+	ThreadPool::ThreadPool(unsigned thread_count)
+	{
+#if !defined(UNICORE_THREAD_POOL_INLINE)
+		if (thread_count == 0)
+			thread_count = hardware_concurrency();
+
+		for (unsigned i = 1; i < thread_count; i++)
+			_threads.emplace_back([this] { worker_loop(); });
+#endif
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard lock(_mutex);
+			_stop = true;
+		}
+		_start_cv.notify_all();
+
+		for (auto& thread : _threads)
+			thread.join();
+	}
+
+	void ThreadPool::parallel_for(unsigned count, const Action<unsigned>& func)
+	{
+		if (count == 0)
+			return;
+
+		if (_threads.empty() || count == 1)
+		{
+			for (unsigned i = 0; i < count; i++)
+				func(i);
+			return;
+		}
+
+		std::lock_guard call_lock(_call_mutex);
+
+		{
+			std::lock_guard lock(_mutex);
+			_func = &func;
+			_count = count;
+			_next = 0;
+			_active = static_cast<unsigned>(_threads.size());
+			_generation++;
+		}
+		_start_cv.notify_all();
+
+		execute();
+
+		std::unique_lock lock(_mutex);
+		_done_cv.wait(lock, [this] { return _active == 0; });
+		_func = nullptr;
+	}
+
+	unsigned ThreadPool::hardware_concurrency()
+	{
+#if defined(UNICORE_THREAD_POOL_INLINE)
+		return 1;
+#else
+		return Math::max(1u, std::thread::hardware_concurrency());
+#endif
+	}
+
+	void ThreadPool::execute()
+	{
+		for (auto index = _next++; index < _count; index = _next++)
+			(*_func)(index);
+	}
+
+	void ThreadPool::worker_loop()
+	{
+		UInt64 generation = 0;
+
+		while (true)
+		{
+			{
+				std::unique_lock lock(_mutex);
+				_start_cv.wait(lock, [&] { return _stop || _generation != generation; });
+				if (_stop)
+					return;
+
+				generation = _generation;
+			}
+
+			execute();
+
+			{
+				std::lock_guard lock(_mutex);
+				_active--;
+			}
+			_done_cv.notify_one();
+		}
+	}
+}
\ No newline at end of file
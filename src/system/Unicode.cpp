@@ -1,177 +1,553 @@
 #include "unicore/system/Unicode.hpp"
-#include <codecvt>
-#include <locale>
+#if defined(UNICORE_CPU_SSE2)
+#	include <emmintrin.h>
+#elif defined(UNICORE_CPU_NEON)
+#	include <arm_neon.h>
+#endif
 
 namespace unicore::Unicode
 {
-	bool try_convert(StringView32 from, String16& to)
+	namespace
 	{
-		if (!from.empty())
+		struct CodePoint
+		{
+			Char32 code;
+			UInt8 length;
+			Bool valid;
+		};
+
+		template<typename T>
+		constexpr UInt32 to_unit(T c)
 		{
-			std::wstring_convert<std::codecvt_utf16<char32_t>, char32_t> conv;
-			std::string bytes = conv.to_bytes(&from.front(), &from.back() + 1);
-			to = std::u16string(reinterpret_cast<const char16_t*>(bytes.c_str()), bytes.length() / sizeof(char16_t));
+			return static_cast<std::make_unsigned_t<T>>(c);
 		}
-		else
+
+		constexpr Bool is_valid_code(UInt32 code)
 		{
-			to = u"";
+			return code < 0xD800 || (code > 0xDFFF && code <= 0x10FFFF);
 		}
 
-		return true;
-	}
+		// Codec is selected by size of character,
+		// so wchar_t is handled as UTF-16 or UTF-32 depending on platform
+		template<typename T, Size = sizeof(T)>
+		struct Codec;
 
-	bool try_convert(StringView32 from, StringW& to)
-	{
-		if (!from.empty())
+		// UTF-8 /////////////////////////////////////////////////////////////////
+		template<typename T>
+		struct Codec<T, 1>
 		{
-			String utf8;
-			return
-				try_convert(from, utf8) &&
-				try_convert(utf8, to);
-		}
+			// Invalid sequence consumes its maximal valid prefix (at least one byte)
+			static CodePoint decode(const T* s, const T* end)
+			{
+				const auto c = to_unit(s[0]);
+				if (c < 0x80)
+					return { c, 1, true };
 
-		to = L"";
-		return true;
-	}
+				UInt8 count;
+				UInt32 code;
+				UInt32 lo = 0x80, hi = 0xBF;
 
-	bool try_convert(StringView32 from, String& to)
-	{
-		if (!from.empty())
+				if (c >= 0xC2 && c <= 0xDF)
+				{
+					count = 1;
+					code = c & 0x1F;
+				}
+				else if (c >= 0xE0 && c <= 0xEF)
+				{
+					count = 2;
+					code = c & 0x0F;
+					if (c == 0xE0) lo = 0xA0; // Overlong
+					else if (c == 0xED) hi = 0x9F; // Surrogates
+				}
+				else if (c >= 0xF0 && c <= 0xF4)
+				{
+					count = 3;
+					code = c & 0x07;
+					if (c == 0xF0) lo = 0x90; // Overlong
+					else if (c == 0xF4) hi = 0x8F; // Above U+10FFFF
+				}
+				else return { 0, 1, false };
+
+				for (UInt8 i = 1; i <= count; i++)
+				{
+					if (s + i >= end)
+						return { 0, i, false };
+
+					const auto b = to_unit(s[i]);
+					if (b < lo || b > hi)
+						return { 0, i, false };
+
+					lo = 0x80;
+					hi = 0xBF;
+					code = (code << 6) | (b & 0x3F);
+				}
+
+				return { code, static_cast<UInt8>(count + 1), true };
+			}
+
+			static UInt8 encode(UInt32 code, T* out)
+			{
+				if (code < 0x80)
+				{
+					out[0] = static_cast<T>(code);
+					return 1;
+				}
+
+				if (code < 0x800)
+				{
+					out[0] = static_cast<T>(0xC0 | (code >> 6));
+					out[1] = static_cast<T>(0x80 | (code & 0x3F));
+					return 2;
+				}
+
+				if (code < 0x10000)
+				{
+					out[0] = static_cast<T>(0xE0 | (code >> 12));
+					out[1] = static_cast<T>(0x80 | ((code >> 6) & 0x3F));
+					out[2] = static_cast<T>(0x80 | (code & 0x3F));
+					return 3;
+				}
+
+				out[0] = static_cast<T>(0xF0 | (code >> 18));
+				out[1] = static_cast<T>(0x80 | ((code >> 12) & 0x3F));
+				out[2] = static_cast<T>(0x80 | ((code >> 6) & 0x3F));
+				out[3] = static_cast<T>(0x80 | (code & 0x3F));
+				return 4;
+			}
+
+			template<typename TFrom>
+			static Size calc_size(const TFrom* s, Size count)
+			{
+				Size size = 0;
+				for (Size i = 0; i < count; i++)
+				{
+					const auto c = to_unit(s[i]);
+					if constexpr (sizeof(TFrom) == 2)
+					{
+						if (c >= 0xD800 && c <= 0xDBFF && i + 1 < count &&
+							to_unit(s[i + 1]) >= 0xDC00 && to_unit(s[i + 1]) <= 0xDFFF)
+						{
+							size += 4;
+							i++;
+							continue;
+						}
+					}
+
+					// Invalid code is replaced with 3 byte ReplacementChar
+					size += 1 + (c >= 0x80) + (c >= 0x800) + (c >= 0x10000 && c <= 0x10FFFF);
+				}
+
+				return size;
+			}
+		};
+
+		// UTF-16 ////////////////////////////////////////////////////////////////
+		template<typename T>
+		struct Codec<T, 2>
+		{
+			static CodePoint decode(const T* s, const T* end)
+			{
+				const auto c = to_unit(s[0]);
+				if (c < 0xD800 || c > 0xDFFF)
+					return { c, 1, true };
+
+				if (c <= 0xDBFF && s + 1 < end)
+				{
+					if (const auto n = to_unit(s[1]); n >= 0xDC00 && n <= 0xDFFF)
+						return { 0x10000 + ((c - 0xD800) << 10) + (n - 0xDC00), 2, true };
+				}
+
+				return { 0, 1, false };
+			}
+
+			static UInt8 encode(UInt32 code, T* out)
+			{
+				if (code < 0x10000)
+				{
+					out[0] = static_cast<T>(code);
+					return 1;
+				}
+
+				code -= 0x10000;
+				out[0] = static_cast<T>(0xD800 + (code >> 10));
+				out[1] = static_cast<T>(0xDC00 + (code & 0x3FF));
+				return 2;
+			}
+
+			template<typename TFrom>
+			static Size calc_size(const TFrom* s, Size count)
+			{
+				if constexpr (sizeof(TFrom) == 4)
+				{
+					Size size = 0;
+					for (Size i = 0; i < count; i++)
+					{
+						const auto c = to_unit(s[i]);
+						size += 1 + (c >= 0x10000 && c <= 0x10FFFF);
+					}
+					return size;
+				}
+				// Every UTF-8 or UTF-16 unit produces at most one unit
+				else return count;
+			}
+		};
+
+		// UTF-32 ////////////////////////////////////////////////////////////////
+		template<typename T>
+		struct Codec<T, 4>
 		{
-			std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> conv;
-			to = conv.to_bytes(&from.front(), &from.back() + 1);
+			static CodePoint decode(const T* s, const T*)
+			{
+				const auto c = to_unit(s[0]);
+				return { c, 1, is_valid_code(c) };
+			}
+
+			static UInt8 encode(UInt32 code, T* out)
+			{
+				out[0] = static_cast<T>(code);
+				return 1;
+			}
+
+			template<typename TFrom>
+			static Size calc_size(const TFrom*, Size count)
+			{
+				return count;
+			}
+		};
+
+		// ASCII /////////////////////////////////////////////////////////////////
+		// Copies leading ASCII characters, returns number of copied characters
+		template<typename TTo, typename TFrom>
+		Size copy_ascii(const TFrom* s, Size count, TTo* out)
+		{
+			Size i = 0;
+#if defined(UNICORE_CPU_SSE2)
+			if constexpr (sizeof(TFrom) == 1 && sizeof(TTo) != 1)
+			{
+				const auto zero = _mm_setzero_si128();
+				for (; i + 16 <= count; i += 16)
+				{
+					const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+					if (_mm_movemask_epi8(v) != 0)
+						break;
+
+					const auto lo = _mm_unpacklo_epi8(v, zero);
+					const auto hi = _mm_unpackhi_epi8(v, zero);
+					auto dest = reinterpret_cast<__m128i*>(out + i);
+					if constexpr (sizeof(TTo) == 2)
+					{
+						_mm_storeu_si128(dest + 0, lo);
+						_mm_storeu_si128(dest + 1, hi);
+					}
+					else
+					{
+						_mm_storeu_si128(dest + 0, _mm_unpacklo_epi16(lo, zero));
+						_mm_storeu_si128(dest + 1, _mm_unpackhi_epi16(lo, zero));
+						_mm_storeu_si128(dest + 2, _mm_unpacklo_epi16(hi, zero));
+						_mm_storeu_si128(dest + 3, _mm_unpackhi_epi16(hi, zero));
+					}
+				}
+			}
+			else if constexpr (sizeof(TFrom) == 2 && sizeof(TTo) == 1)
+			{
+				const auto mask = _mm_set1_epi16(static_cast<short>(0xFF80));
+				const auto zero = _mm_setzero_si128();
+				for (; i + 8 <= count; i += 8)
+				{
+					const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+					if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, mask), zero)) != 0xFFFF)
+						break;
+
+					_mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(v, v));
+				}
+			}
+			else if constexpr (sizeof(TFrom) == 4 && sizeof(TTo) == 1)
+			{
+				const auto mask = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+				const auto zero = _mm_setzero_si128();
+				for (; i + 8 <= count; i += 8)
+				{
+					const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+					const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 4));
+					const auto test = _mm_and_si128(_mm_or_si128(a, b), mask);
+					if (_mm_movemask_epi8(_mm_cmpeq_epi32(test, zero)) != 0xFFFF)
+						break;
+
+					const auto v = _mm_packs_epi32(a, b);
+					_mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(v, v));
+				}
+			}
+#elif defined(UNICORE_CPU_NEON)
+			if constexpr (sizeof(TFrom) == 1 && sizeof(TTo) != 1)
+			{
+				for (; i + 16 <= count; i += 16)
+				{
+					const auto v = vld1q_u8(reinterpret_cast<const UInt8*>(s + i));
+					const auto any = vorr_u8(vget_low_u8(v), vget_high_u8(v));
+					if ((vget_lane_u64(vreinterpret_u64_u8(any), 0) & 0x8080808080808080ULL) != 0)
+						break;
+
+					const auto lo = vmovl_u8(vget_low_u8(v));
+					const auto hi = vmovl_u8(vget_high_u8(v));
+					if constexpr (sizeof(TTo) == 2)
+					{
+						auto dest = reinterpret_cast<UInt16*>(out + i);
+						vst1q_u16(dest + 0, lo);
+						vst1q_u16(dest + 8, hi);
+					}
+					else
+					{
+						auto dest = reinterpret_cast<UInt32*>(out + i);
+						vst1q_u32(dest + 0, vmovl_u16(vget_low_u16(lo)));
+						vst1q_u32(dest + 4, vmovl_u16(vget_high_u16(lo)));
+						vst1q_u32(dest + 8, vmovl_u16(vget_low_u16(hi)));
+						vst1q_u32(dest + 12, vmovl_u16(vget_high_u16(hi)));
+					}
+				}
+			}
+			else if constexpr (sizeof(TFrom) == 2 && sizeof(TTo) == 1)
+			{
+				for (; i + 8 <= count; i += 8)
+				{
+					const auto v = vld1q_u16(reinterpret_cast<const UInt16*>(s + i));
+					const auto test = vandq_u16(v, vdupq_n_u16(0xFF80));
+					const auto any = vorr_u16(vget_low_u16(test), vget_high_u16(test));
+					if (vget_lane_u64(vreinterpret_u64_u16(any), 0) != 0)
+						break;
+
+					vst1_u8(reinterpret_cast<UInt8*>(out + i), vmovn_u16(v));
+				}
+			}
+			else if constexpr (sizeof(TFrom) == 4 && sizeof(TTo) == 1)
+			{
+				for (; i + 8 <= count; i += 8)
+				{
+					const auto a = vld1q_u32(reinterpret_cast<const UInt32*>(s + i));
+					const auto b = vld1q_u32(reinterpret_cast<const UInt32*>(s + i + 4));
+					const auto test = vandq_u32(vorrq_u32(a, b), vdupq_n_u32(0xFFFFFF80));
+					const auto any = vorr_u32(vget_low_u32(test), vget_high_u32(test));
+					if (vget_lane_u64(vreinterpret_u64_u32(any), 0) != 0)
+						break;
+
+					const auto v = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+					vst1_u8(reinterpret_cast<UInt8*>(out + i), vmovn_u16(v));
+				}
+			}
+#endif
+			for (; i < count && to_unit(s[i]) < 0x80; i++)
+				out[i] = static_cast<TTo>(s[i]);
+
+			return i;
 		}
-		else
+
+		// CONVERT ///////////////////////////////////////////////////////////////
+		// Destination must hold Codec<TTo>::calc_size() characters.
+		// Returns end of written text or nullptr on failure.
+		template<typename TFrom, typename TTo>
+		TTo* convert_units(BasicStringView<TFrom> from, TTo* out, ConvertMode mode)
 		{
-			to = "";
+			auto s = from.data();
+			const auto end = s + from.size();
+
+			while (s < end)
+			{
+				if (to_unit(*s) < 0x80)
+				{
+					const auto count = copy_ascii(s, end - s, out);
+					s += count;
+					out += count;
+					continue;
+				}
+
+				const auto point = Codec<TFrom>::decode(s, end);
+				if (point.valid)
+					out += Codec<TTo>::encode(point.code, out);
+				else if (mode == ConvertMode::Replace)
+					out += Codec<TTo>::encode(ReplacementChar, out);
+				else return nullptr;
+
+				s += point.length;
+			}
+
+			return out;
 		}
-		return true;
-	}
 
-	bool try_convert(StringView16 from, String32& to)
-	{
-		if (!from.empty())
+		template<typename TFrom, typename TTo>
+		Bool convert_append(BasicStringView<TFrom> from,
+			BasicString<TTo>& to, ConvertMode mode)
 		{
-			std::wstring_convert<std::codecvt_utf16<char32_t>, char32_t> conv;
-			to = conv.from_bytes(reinterpret_cast<const char*>(from.data()), reinterpret_cast<const char*>(from.data() + from.size()));
+			// Destination is allocated once and trimmed after conversion
+			const auto offset = to.size();
+			to.resize(offset + Codec<TTo>::calc_size(from.data(), from.size()));
+
+			if (const auto end = convert_units(from, to.data() + offset, mode))
+			{
+				to.resize(end - to.data());
+				return true;
+			}
+
+			to.resize(offset);
+			return false;
 		}
-		else
+
+		template<typename TFrom, typename TTo>
+		Bool convert(BasicStringView<TFrom> from, BasicString<TTo>& to)
 		{
-			to = U"";
+			to.clear();
+			return convert_append(from, to, ConvertMode::Strict);
 		}
-		return true;
-	}
 
-	bool try_convert(StringView16 from, StringW& to)
-	{
-		if (!from.empty())
+		template<typename T>
+		Bool validate_units(BasicStringView<T> str)
 		{
-			String str;
-			return
-				try_convert(from, str) &&
-				try_convert(str, to);
+			auto s = str.data();
+			const auto end = s + str.size();
+			while (s < end)
+			{
+				if (to_unit(*s) < 0x80)
+				{
+					s++;
+					continue;
+				}
+
+				const auto point = Codec<T>::decode(s, end);
+				if (!point.valid)
+					return false;
+
+				s += point.length;
+			}
+
+			return true;
 		}
+	}
+
+	// VALIDATE //////////////////////////////////////////////////////////////////
+	Bool validate(StringView str)
+	{
+		return validate_units(str);
+	}
+
+	Bool validate(StringView16 str)
+	{
+		return validate_units(str);
+	}
+
+	Bool validate(StringView32 str)
+	{
+		return validate_units(str);
+	}
+
+	// UTF-8 /////////////////////////////////////////////////////////////////////
+	Size utf8_size(StringView16 from)
+	{
+		return Codec<Char>::calc_size(from.data(), from.size());
+	}
 
-		to = L"";
-		return true;
+	Size utf8_size(StringView32 from)
+	{
+		return Codec<Char>::calc_size(from.data(), from.size());
+	}
+
+	Size write_utf8(StringView16 from, Char* out)
+	{
+		return convert_units(from, out, ConvertMode::Replace) - out;
+	}
+
+	Size write_utf8(StringView32 from, Char* out)
+	{
+		return convert_units(from, out, ConvertMode::Replace) - out;
+	}
+
+	// APPEND ////////////////////////////////////////////////////////////////////
+	Bool append(StringView32 from, String& to, ConvertMode mode)
+	{
+		return convert_append(from, to, mode);
+	}
+
+	Bool append(StringView32 from, String16& to, ConvertMode mode)
+	{
+		return convert_append(from, to, mode);
+	}
+
+	Bool append(StringView16 from, String& to, ConvertMode mode)
+	{
+		return convert_append(from, to, mode);
+	}
+
+	Bool append(StringView16 from, String32& to, ConvertMode mode)
+	{
+		return convert_append(from, to, mode);
+	}
+
+	Bool append(StringView from, String16& to, ConvertMode mode)
+	{
+		return convert_append(from, to, mode);
+	}
+
+	Bool append(StringView from, String32& to, ConvertMode mode)
+	{
+		return convert_append(from, to, mode);
+	}
+
+	// CONVERT ///////////////////////////////////////////////////////////////////
+	bool try_convert(StringView32 from, String16& to)
+	{
+		return convert(from, to);
+	}
+
+	bool try_convert(StringView32 from, StringW& to)
+	{
+		return convert(from, to);
+	}
+
+	bool try_convert(StringView32 from, String& to)
+	{
+		return convert(from, to);
+	}
+
+	bool try_convert(StringView16 from, String32& to)
+	{
+		return convert(from, to);
+	}
+
+	bool try_convert(StringView16 from, StringW& to)
+	{
+		return convert(from, to);
 	}
 
 	bool try_convert(StringView16 from, String& to)
 	{
-		if (!from.empty())
-		{
-			std::wstring_convert<std::codecvt_utf8<char16_t>, char16_t> conv;
-			to = conv.to_bytes(&from.front(), &from.back() + 1);
-		}
-		else
-		{
-			to = "";
-		}
-		return true;
+		return convert(from, to);
 	}
 
 	bool try_convert(StringViewW from, String32& to)
 	{
-		if (!from.empty())
-		{
-			String str;
-			return
-				try_convert(from, str) &&
-				try_convert(str, to);
-		}
-
-		to = U"";
-		return true;
+		return convert(from, to);
 	}
 
 	bool try_convert(StringViewW from, String16& to)
 	{
-		if (!from.empty())
-		{
-			String str;
-			return
-				try_convert(from, str) &&
-				try_convert(str, to);
-		}
-
-		to = u"";
-		return true;
+		return convert(from, to);
 	}
 
 	bool try_convert(StringViewW from, String& to)
 	{
-		if (!from.empty())
-		{
-			static std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>, wchar_t> conv;
-			to = conv.to_bytes(&from.front(), &from.back() + 1);
-		}
-		else
-		{
-			to = "";
-		}
-		return true;
+		return convert(from, to);
 	}
 
 	bool try_convert(StringView from, String32& to)
 	{
-		if (!from.empty())
-		{
-			std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> conv;
-			to = conv.from_bytes(&from.front(), &from.back() + 1);
-		}
-		else
-		{
-			to = U"";
-		}
-		return true;
+		return convert(from, to);
 	}
 
 	bool try_convert(StringView from, String16& to)
 	{
-		if (!from.empty())
-		{
-			std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> conv;
-			to = conv.from_bytes(&from.front(), &from.back() + 1);
-		}
-		else
-		{
-			to = u"";
-		}
-		return true;
+		return convert(from, to);
 	}
 
 	bool try_convert(StringView from, StringW& to)
 	{
-		if (!from.empty())
-		{
-			static std::wstring_convert< std::codecvt_utf8<wchar_t>, wchar_t > conv;
-			to = conv.from_bytes(&from.front(), &from.back() + 1);
-		}
-		else
-		{
-			to = L"";
-		}
-		return true;
+		return convert(from, to);
 	}
 
 	String32 to_utf32(StringView from, StringView32 default_value)
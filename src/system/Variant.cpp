@@ -71,7 +71,7 @@ namespace unicore
 
 			if (StringHelper::equals(str, "false", true))
 			{
-				value = true;
+				value = false;
 				return true;
 			}
 		}
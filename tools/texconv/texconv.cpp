@@ -0,0 +1,88 @@
+// Converts png/tga/jpg images to .uctex surface containers
+// usage: texconv [--none|--lz4] [--mipmaps] input output
+#include "unicore/io/MemoryFile.hpp"
+#include "unicore/renderer/SurfaceContainer.hpp"
+#include <stb_image.h>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+using namespace unicore;
+
+static bool read_file(const char* path, List<Byte>& data)
+{
+	std::ifstream stream(path, std::ios::binary);
+	if (!stream)
+		return false;
+
+	data.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+	return true;
+}
+
+static bool write_file(const char* path, WriteMemoryFile& file)
+{
+	List<Byte> data(static_cast<size_t>(file.size()));
+	file.seek(0, SeekMethod::Begin);
+	if (!file.read(data.data(), data.size(), nullptr))
+		return false;
+
+	std::ofstream stream(path, std::ios::binary);
+	stream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+	return static_cast<bool>(stream);
+}
+
+int main(int argc, char* argv[])
+{
+	SurfaceContainer::WriteOptions options;
+	const char* paths[2] = { nullptr, nullptr };
+	int path_count = 0;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const StringView arg(argv[i]);
+		if (arg == "--none")
+			options.compression = SurfaceContainer::Compression::None;
+		else if (arg == "--lz4")
+			options.compression = SurfaceContainer::Compression::Lz4;
+		else if (arg == "--mipmaps")
+			options.mipmaps = true;
+		else if (path_count < 2)
+			paths[path_count++] = argv[i];
+		else
+			path_count = 3;
+	}
+
+	if (path_count != 2)
+	{
+		std::cerr << "usage: texconv [--none|--lz4] [--mipmaps] input output" << std::endl;
+		return 1;
+	}
+
+	List<Byte> input;
+	if (!read_file(paths[0], input))
+	{
+		std::cerr << "Failed to read " << paths[0] << std::endl;
+		return 1;
+	}
+
+	int w, h, n;
+	const auto pixels = stbi_load_from_memory(input.data(),
+		static_cast<int>(input.size()), &w, &h, &n, 4);
+	if (!pixels)
+	{
+		std::cerr << "Failed to decode " << paths[0] << " - " << stbi_failure_reason() << std::endl;
+		return 1;
+	}
+
+	// stb_image output is r, g, b, a bytes - the Surface layout
+	const Surface surface(Vector2i(w, h), MemoryChunk(pixels, w * h * 4, &stbi_image_free));
+
+	WriteMemoryFile file;
+	if (!SurfaceContainer::write(file, surface, options) || !write_file(paths[1], file))
+	{
+		std::cerr << "Failed to write " << paths[1] << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
\ No newline at end of file